@@ -0,0 +1,336 @@
+
+#include "analytics/Analyzer.h"
+#include "io/fileReader/emptyReader.h"
+#include "io/fileWriter/VTKWriter.h"
+#include "io/fileWriter/emptyWriter.h"
+#include "models/molecules/Membrane.h"
+#include "physics/boundaryConditions/PeriodicBoundary.h"
+#include "physics/forceCal/forceCal.h"
+#include "physics/locationCal/locationCal.h"
+#include "physics/strategy.h"
+#include "physics/thermostat/ThermostatFactory.h"
+#include "physics/velocityCal/velocityCal.h"
+#include "simulation/MixedLJSimulation.h"
+#include "utils/ArrayUtils.h"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <filesystem>
+#include <random>
+#include <spdlog/common.h>
+#include <spdlog/spdlog.h>
+
+/*
+ * Every kernel is run on the same kind of input: a cube of particles, parameterised by
+ *  - the number of particles (first argument),
+ *  - the lattice spacing in hundredths of sigma (second argument), 112 is about the equilibrium
+ *    distance, larger spacings mean fewer particles per cell,
+ *  - the number of particle types (third argument), which differ in mass, epsilon and sigma, so
+ *    the mixing rules are used between different types.
+ */
+
+namespace {
+
+const double cutoff = 2.5;
+
+/**
+ * @brief A mixed Lennard-Jones simulation with a cube of particles, set up for a kernel
+ */
+struct KernelSetup {
+    ParticleContainer particles {}; /**< The particles, referenced by the simulation */
+    PhysicsStrategy strat { location_stroemer_verlet,
+                            velocity_stroemer_verlet,
+                            force_mixed_LJ_gravity_lc };
+    std::unique_ptr<MixedLJSimulation> sim; /**< The simulation */
+};
+
+/**
+ * @brief Generate the particle cube described by the benchmark arguments
+ * @param state The benchmark state with particle count, spacing and type count
+ * @return The particles and the edge length of the cube
+ */
+std::pair<std::vector<Particle>, double> generateCube(const benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    const double spacing = static_cast<double>(state.range(1)) / 100;
+    const auto types = static_cast<int>(state.range(2));
+    const auto side = static_cast<size_t>(std::ceil(std::cbrt(static_cast<double>(n))));
+
+    std::mt19937 random(42);
+    std::normal_distribution<double> velocity(0, 1);
+    std::vector<Particle> particles;
+    particles.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        std::array<double, 3> x { 0.5 + static_cast<double>(i % side) * spacing,
+                                  0.5 + static_cast<double>(i / side % side) * spacing,
+                                  0.5 + static_cast<double>(i / side / side) * spacing };
+        int type = static_cast<int>(i % types) + 1;
+        particles.emplace_back(
+            x,
+            std::array<double, 3> { velocity(random), velocity(random), velocity(random) },
+            1 + 0.5 * (type - 1),
+            type,
+            i);
+    }
+    return { particles, static_cast<double>(side) * spacing + 1 };
+}
+
+/**
+ * @brief Set up a mixed Lennard-Jones simulation with the particle cube
+ * @param state The benchmark state with particle count, spacing and type count
+ * @param boundary The type of all boundaries
+ * @return The setup
+ */
+std::unique_ptr<KernelSetup> makeSetup(
+    const benchmark::State& state, BoundaryType boundary = BoundaryType::OUTFLOW)
+{
+    spdlog::set_level(spdlog::level::off);
+
+    auto setup = std::make_unique<KernelSetup>();
+    auto [particles, size] = generateCube(state);
+    setup->particles = ParticleContainer(particles);
+
+    std::map<unsigned, std::pair<double, double>> LJParams;
+    for (unsigned type = 1; type <= state.range(2); ++type)
+        LJParams[type] = { 5 - 0.5 * (type - 1), 1 + 0.05 * (type - 1) };
+
+    setup->sim = std::make_unique<MixedLJSimulation>(
+        0,
+        0.0005,
+        1,
+        setup->particles,
+        setup->strat,
+        std::make_unique<EmptyFileWriter>(),
+        std::make_unique<EmptyFileReader>(""),
+        std::map<unsigned, bool> {},
+        LJParams,
+        std::array<double, 3> { 0, 0, 0 },
+        std::array<double, 3> { size, size, size },
+        cutoff,
+        BoundaryConfig(boundary, boundary, boundary, boundary, boundary, boundary),
+        std::make_unique<Analyzer>(std::array<size_t, 3> { 1, 1, 1 }, ""),
+        0,
+        thermostatFactory(ThermostatType::CLASSICAL, 40, 40, 5, 3),
+        0,
+        0,
+        0);
+    return setup;
+}
+
+/**
+ * @brief Set up a cell grid with the particle cube
+ * @param state The benchmark state with particle count, spacing and type count
+ * @param container The container to store the particles in
+ * @return The grid
+ */
+std::unique_ptr<CellGrid> makeGrid(const benchmark::State& state, ParticleContainer& container)
+{
+    auto [particles, size] = generateCube(state);
+    container = ParticleContainer(particles);
+    auto grid = std::make_unique<CellGrid>(
+        std::array<double, 3> { 0, 0, 0 }, std::array<double, 3> { size, size, size }, cutoff);
+    grid->addParticlesFromContainer(container);
+    return grid;
+}
+
+/**
+ * @brief The benchmark arguments of all kernels
+ */
+void kernelArgs(benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({ "particles", "spacing", "types" })
+        ->ArgsProduct({ { 1000, 8000, 27000 }, { 112, 150 }, { 1, 4 } });
+}
+
+/**
+ * @brief Membrane which exposes the harmonic forces for benchmarking them in isolation
+ */
+class BenchMembrane : public Membrane {
+public:
+    using Membrane::calculateHarmonicForces;
+    using Membrane::Membrane;
+};
+
+} // namespace
+
+// lj_calc on all pairs inside the cutoff, with the mixed parameters of their types
+static void BM_LJCalc(benchmark::State& state)
+{
+    auto setup = makeSetup(state);
+    ParticleContainer& container = setup->particles;
+    std::vector<std::pair<Particle*, Particle*>> pairs;
+    for (auto it = container.beginPairs(); it != container.endPairs(); ++it) {
+        auto [p1, p2] = *it;
+        auto delta = p1.getX() - p2.getX();
+        if (delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2] <= cutoff * cutoff)
+            pairs.emplace_back(&p1, &p2);
+    }
+
+    const MixedLJSimulation& sim = *setup->sim;
+    for (auto _ : state) {
+        for (auto [p1, p2] : pairs) {
+            int t1 = p1->getType();
+            int t2 = p2->getType();
+            lj_calc(
+                *p1,
+                *p2,
+                sim.getAlpha(t1, t2),
+                sim.getBeta(t1, t2),
+                sim.getGamma(t1, t2),
+                p1->getX() - p2->getX());
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * pairs.size()));
+}
+BENCHMARK(BM_LJCalc)->Apply(kernelArgs);
+
+// the linked cell force kernels, which iterate the cell pairs
+static void BM_CellPairs(benchmark::State& state)
+{
+    auto setup = makeSetup(state);
+    for (auto _ : state)
+        force_mixed_LJ_gravity_lc(*setup->sim);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CellPairs)->Apply(kernelArgs)->UseRealTime();
+
+static void BM_CellPairsTask(benchmark::State& state)
+{
+    auto setup = makeSetup(state);
+    for (auto _ : state)
+        force_mixed_LJ_gravity_lc_task(*setup->sim);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CellPairsTask)->Apply(kernelArgs)->UseRealTime();
+
+// reassigning all particles to their cells, after every particle moved by a fifth of a cell
+static void BM_UpdateCells(benchmark::State& state)
+{
+    ParticleContainer container {};
+    auto grid = makeGrid(state, container);
+    double shift = cutoff / 5;
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (auto& p : container)
+            p.setX(p.getX() + std::array<double, 3> { shift, 0, 0 });
+        shift = -shift;
+        state.ResumeTiming();
+        grid->updateCells();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_UpdateCells)->Apply(kernelArgs);
+
+// looking up the cell of every particle
+static void BM_GetIndexFromPos(benchmark::State& state)
+{
+    ParticleContainer container {};
+    auto grid = makeGrid(state, container);
+    for (auto _ : state) {
+        for (auto& p : container)
+            benchmark::DoNotOptimize(grid->getIndexFromPos(p.getX()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GetIndexFromPos)->Apply(kernelArgs);
+
+// inserting the halo particles of all six periodic boundaries, removing them is not timed
+static void BM_PeriodicPreUpdate(benchmark::State& state)
+{
+    auto setup = makeSetup(state, BoundaryType::PERIODIC);
+    BoundaryConfig config(
+        BoundaryType::PERIODIC,
+        BoundaryType::PERIODIC,
+        BoundaryType::PERIODIC,
+        BoundaryType::PERIODIC,
+        BoundaryType::PERIODIC,
+        BoundaryType::PERIODIC);
+    std::vector<PeriodicBoundary> boundaries;
+    for (Position position : { LEFT, RIGHT, TOP, BOTTOM, FRONT, BACK })
+        boundaries.emplace_back(position, config, setup->sim->getGrid());
+
+    for (auto _ : state) {
+        for (auto& boundary : boundaries)
+            boundary.preUpdateBoundaryHandling(*setup->sim);
+        state.PauseTiming();
+        boundaries.front().postUpdateBoundaryHandling(*setup->sim);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PeriodicPreUpdate)->Apply(kernelArgs);
+
+static void BM_ThermostatUpdate(benchmark::State& state)
+{
+    auto setup = makeSetup(state);
+    auto thermostat = thermostatFactory(ThermostatType::CLASSICAL, 40, 40, 5, 3);
+    for (auto _ : state)
+        thermostat->updateT(*setup->sim);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ThermostatUpdate)->Apply(kernelArgs);
+
+// writing all particles as vtu into the temporary directory
+static void BM_VTKWriter(benchmark::State& state)
+{
+    auto setup = makeSetup(state);
+    std::string name = (std::filesystem::temp_directory_path() / "molsim_bench").string();
+    outputWriter::VTKWriter writer(name);
+    for (auto _ : state)
+        writer.plotParticles(*setup->sim);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::filesystem::remove(name + "_0000.vtu");
+}
+BENCHMARK(BM_VTKWriter)->Apply(kernelArgs)->Unit(benchmark::kMillisecond);
+
+// harmonic forces of a square membrane, the types set the number of membranes
+static void BM_HarmonicForces(benchmark::State& state)
+{
+    spdlog::set_level(spdlog::level::off);
+    const auto types = static_cast<unsigned>(state.range(2));
+    const int width = static_cast<int>(std::sqrt(static_cast<double>(state.range(0)) / types));
+    const double spacing = static_cast<double>(state.range(1)) / 100;
+
+    ParticleContainer container {};
+    std::vector<BenchMembrane> membranes;
+    for (unsigned type = 1; type <= types; ++type) {
+        membranes.emplace_back(
+            std::array<double, 3> { 0, 0, 2.0 * type },
+            width,
+            width,
+            1,
+            spacing,
+            1,
+            std::array<double, 3> { 0, 0, 0 },
+            0,
+            3,
+            type,
+            spacing,
+            300);
+        membranes.back().generateMolecule(container, type);
+    }
+
+    for (auto _ : state) {
+        for (auto& membrane : membranes)
+            membrane.calculateHarmonicForces(container);
+    }
+    state.SetItemsProcessed(state.iterations() * width * width * types);
+}
+BENCHMARK(BM_HarmonicForces)->Apply(kernelArgs);
+
+// iterating the active particles, every tenth particle is inactive
+static void BM_ActiveIterator(benchmark::State& state)
+{
+    auto [particles, size] = generateCube(state);
+    ParticleContainer container(particles);
+    for (size_t i = 0; i < particles.size(); i += 10)
+        container.removeParticle(container.particles[i]);
+
+    for (auto _ : state) {
+        double sum = 0;
+        for (auto& p : container)
+            sum += p.getX()[0];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ActiveIterator)->Apply(kernelArgs);
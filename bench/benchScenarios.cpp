@@ -0,0 +1,131 @@
+
+#include "analytics/PhaseTimer.h"
+#include "io/fileReader/readerFactory.h"
+#include "io/fileWriter/writerFactory.h"
+#include "io/xmlparse/xmlparse.h"
+#include "models/ParticleContainer.h"
+#include "physics/stratFactory.h"
+#include "physics/strategy.h"
+#include "physics/thermostat/ThermostatFactory.h"
+#include "simulation/simFactory.h"
+#include "utils/Params.h"
+#include <array>
+#include <benchmark/benchmark.h>
+#include <limits>
+#include <memory>
+#include <spdlog/common.h>
+#include <spdlog/spdlog.h>
+#include <string>
+
+#ifndef MOLSIM_INPUT_DIR
+#define MOLSIM_INPUT_DIR "../input"
+#endif
+
+namespace {
+
+/**
+ * @brief A simulation set up from one of the shipped input files
+ */
+struct Scenario {
+    Params params; /**< The parameters read from the input file */
+    ParticleContainer particles {}; /**< The particles, referenced by the simulation */
+    std::unique_ptr<Simulation> sim; /**< The simulation */
+};
+
+/**
+ * @brief Set up a shipped input file the same way MolSim does, but without any output
+ * @param file The name of the input file in the input directory
+ * @param type The simulation type the input is run with (see README)
+ * @param steps The number of time steps to run instead of the end time of the input
+ * @return The scenario, ready to run
+ */
+std::unique_ptr<Scenario> loadScenario(const std::string& file, SimulationType type, long steps)
+{
+    auto scenario = std::make_unique<Scenario>();
+    Params& params = scenario->params;
+    params.input_file = std::string(MOLSIM_INPUT_DIR) + "/" + file;
+    params.reader_type = ReaderType::XML;
+    params.simulation_type = type;
+    xmlparse(params, params.input_file);
+
+    // the same as -p: no output, only the simulation is timed
+    params.doPerformanceMeasurements = true;
+    params.writer_type = WriterType::EMPTY;
+    params.analysisInterval = std::numeric_limits<size_t>::max();
+    params.end_time = params.start_time + static_cast<double>(steps) * params.delta_t;
+
+    auto thermostat = thermostatFactory(
+        params.thermostat_type,
+        params.init_temp,
+        params.target_temp,
+        params.max_temp_delta,
+        params.domain_size[2] > 1 ? 3 : 2);
+    PhysicsStrategy strat = stratFactory(params.simulation_type, params.parallel_type);
+    scenario->sim = simFactory(
+        params,
+        scenario->particles,
+        strat,
+        writerFactory(params.writer_type, params.output_file, params),
+        readerFactory(params.input_file, params.reader_type),
+        std::move(thermostat));
+    return scenario;
+}
+
+/**
+ * @brief Run a shipped input file for a number of time steps (the first argument)
+ * @details The setup is not timed. Every phase is reported as seconds per run, the particle
+ * updates as MUP per second.
+ */
+void BM_Scenario(benchmark::State& state, const std::string& file, SimulationType type)
+{
+    spdlog::set_level(spdlog::level::off);
+
+    std::array<double, static_cast<size_t>(Phase::COUNT)> phaseTimes {};
+    unsigned long long particleUpdates = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto scenario = loadScenario(file, type, state.range(0));
+        state.ResumeTiming();
+
+        scenario->sim->runSim();
+
+        state.PauseTiming();
+        for (size_t i = 0; i < phaseTimes.size(); ++i)
+            phaseTimes[i] += scenario->sim->phaseTimer.getStats(static_cast<Phase>(i)).total;
+        particleUpdates += scenario->sim->particleUpdates;
+        scenario.reset();
+        state.ResumeTiming();
+    }
+
+    for (size_t i = 0; i < phaseTimes.size(); ++i) {
+        if (phaseTimes[i] > 0)
+            state.counters[PhaseTimer::getName(static_cast<Phase>(i))] =
+                benchmark::Counter(phaseTimes[i], benchmark::Counter::kAvgIterations);
+    }
+    state.counters["MUP"] = benchmark::Counter(
+        static_cast<double>(particleUpdates) / 1e6, benchmark::Counter::kIsRate);
+}
+
+} // namespace
+
+// the reduced versions of the production runs in the README, 100 time steps each
+BENCHMARK_CAPTURE(BM_Scenario, rayleigh_taylor_2D, "big_rayleigh_taylor_short.xml", MIXED_LJ)
+    ->Arg(100)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_Scenario, rayleigh_taylor_3D, "reyleigh_3D_short.xml", MIXED_LJ)
+    ->Arg(100)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_Scenario, nano_scale_flow, "nano_scale_flow.xml", MIXED_LJ)
+    ->Arg(100)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_Scenario, membrane, "membrane.xml", MEMBRANE_LJ)
+    ->Arg(100)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_Scenario, falling_drop, "falling_drop.xml", DOMAIN_LJ)
+    ->Arg(100)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
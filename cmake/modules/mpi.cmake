@@ -0,0 +1,6 @@
+
+option(BUILD_MPI "Build with MPI to decompose the domain across ranks" OFF)
+
+if (BUILD_MPI)
+    find_package(MPI REQUIRED COMPONENTS CXX)
+endif(BUILD_MPI)
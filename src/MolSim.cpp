@@ -1,5 +1,8 @@
 
+#include "analytics/RunReport.h"
+#include "analytics/Tracer.h"
 #include "io/argparse/argparse.h"
+#include "io/fileReader/xmlReader.h"
 #include "io/fileReader/readerFactory.h"
 #include "io/fileWriter/writerFactory.h"
 #include "io/xmlparse/xmlparse.h"
@@ -7,30 +10,128 @@
 #include "physics/stratFactory.h"
 #include "physics/strategy.h"
 #include "physics/thermostat/ThermostatFactory.h"
+#include "simulation/EnsembleRunner.h"
 #include "simulation/planetSim.h"
+#include "simulation/linkedLennardJonesSim.h"
 #include "simulation/simFactory.h"
 #include "spdlog/spdlog.h"
+#include "utils/MPIUtils.h"
+#include "utils/NumaUtils.h"
 #include "utils/Params.h"
+#include <chrono>
 #include <string>
 
 // Main function
 int main(int argc, char* argsv[])
 {
+#ifdef MOLSIM_MPI
+    // the master thread of the force calculation exchanges the halos
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Init_thread(&argc, &argsv, MPI_THREAD_FUNNELED, &provided);
+    if (provided < MPI_THREAD_FUNNELED)
+        spdlog::warn("MPI does not support threads, the halos are exchanged before the forces");
+#endif
     Params params;
 
     // parse arguments
     argparse(argc, argsv, params);
 
+    // run the simulations of an ensemble list concurrently, each with its own parameters
+    if (params.ensemble) {
+        if (MPIUtils::getSize() > 1) {
+            spdlog::error("An ensemble runs in a single process, start it on one rank");
+            exit(EXIT_FAILURE);
+        }
+        // every run starts from the options of the ensemble, without the list
+        std::vector<std::string> baseArgs;
+        for (int i = 0; i < argc; ++i) {
+            if (argsv[i] != params.input_file)
+                baseArgs.emplace_back(argsv[i]);
+        }
+        // the groups are pinned to blocks of CPUs, which the threads of their runs share
+        EnsembleRunner runner(baseArgs, params.ensemble_groups, params.thread_pinning);
+        runner.readList(params.input_file);
+        runner.run();
+#ifdef MOLSIM_MPI
+        MPI_Finalize();
+#endif
+        return 0;
+    }
+
     // optionally parse xml
     if (params.reader_type == ReaderType::XML) {
         xmlparse(params, params.input_file);
     }
 
+    // only predict the memory of the simulation and exit
+    if (params.dry_run) {
+        size_t membraneParticles = 0;
+        size_t particles = 0;
+        if (params.reader_type == ReaderType::XML) {
+            particles = countXmlParticles(params.input_file, membraneParticles);
+        } else if (params.dry_run_particles == 0) {
+            spdlog::error("The dry run only counts the particles of XML inputs, use --dry_run=N");
+            exit(EXIT_FAILURE);
+        }
+        if (params.dry_run_particles > 0) {
+            // scale the clusters and membranes of the input to the given number of particles
+            const size_t counted = particles + membraneParticles;
+            membraneParticles =
+                counted ? membraneParticles * params.dry_run_particles / counted : 0;
+            particles = params.dry_run_particles - membraneParticles;
+        }
+        if (params.simulation_type != SimulationType::MEMBRANE_LJ)
+            membraneParticles = 0;
+
+        MemoryUsage prediction = predictMemory(params, particles, membraneParticles);
+        spdlog::set_level(spdlog::level::info);
+        logMemoryTable({ { "predicted", prediction } }, particles + membraneParticles);
+        spdlog::info("Predicted peak memory of {} particles: {:.1f} MiB",
+            particles + membraneParticles,
+            static_cast<double>(prediction.total()) / (1024 * 1024));
+#ifdef MOLSIM_MPI
+        MPI_Finalize();
+#endif
+        return 0;
+    }
+
+    const size_t dimensions = params.domain_size[2] > 1 ? 3 : 2;
+
+    // split the domain across the ranks, each of which writes its own output
+    std::unique_ptr<DomainDecomposition> decomposition;
+    if (MPIUtils::getSize() > 1) {
+        if (params.simulation_type != SimulationType::DOMAIN_LJ
+            && params.simulation_type != SimulationType::MIXED_LJ) {
+            spdlog::error("Only the domain and mixed LJ simulations can run on several ranks");
+            exit(EXIT_FAILURE);
+        }
+        const int rank = MPIUtils::getRank();
+        decomposition = std::make_unique<DomainDecomposition>(rank,
+            MPIUtils::getSize(),
+            params.domain_origin,
+            params.domain_size,
+            params.cutoff,
+            params.boundaryConfig,
+            params.rank_grid);
+        if (rank > 0 && spdlog::get_level() < spdlog::level::warn)
+            spdlog::set_level(spdlog::level::warn);
+        const std::string suffix = "_rank" + std::to_string(rank);
+        params.output_file += suffix;
+        if (!params.trace_file.empty())
+            params.trace_file += suffix;
+        if (!params.metrics_file.empty())
+            params.metrics_file += suffix;
+    }
+
+    // pin the threads before they first touch the particles and cells
+    NumaUtils::pinThreads(params.thread_pinning);
+    NumaUtils::logTopology();
+
     // Initialize reader
     auto readPointer = readerFactory(params.input_file, params.reader_type);
 
     // Initialize writer
-    auto writePointer = writerFactory(params.writer_type, params.output_file);
+    auto writePointer = writerFactory(params.writer_type, params.output_file, params);
 
     // Initialize thermostat
     auto thermostat = thermostatFactory(
@@ -38,7 +139,7 @@ int main(int argc, char* argsv[])
         params.init_temp,
         params.target_temp,
         params.max_temp_delta,
-        params.domain_size[2] > 1 ? 3 : 2);
+        dimensions);
 
     // Intialize physics strategy
     PhysicsStrategy strat = stratFactory(params.simulation_type, params.parallel_type);
@@ -53,12 +154,63 @@ int main(int argc, char* argsv[])
         strat,
         std::move(writePointer),
         std::move(readPointer),
-        std::move(thermostat));
+        std::move(thermostat),
+        std::move(decomposition));
 
     // Run simulation
+    if (!params.trace_file.empty()) {
+        Tracer::enable();
+    }
+    if (params.perf_counters) {
+        simPointer->phaseTimer.enableCounters();
+    }
+    if (params.cell_load) {
+        if (auto* linkedSim = dynamic_cast<LinkedLennardJonesSimulation*>(simPointer.get()))
+            linkedSim->setRecordCellLoad(true);
+        else
+            spdlog::warn("The cell load is only recorded by linked cell simulations");
+    }
+    if (params.parallel_type == ParallelType::BALANCED) {
+        if (auto* linkedSim = dynamic_cast<LinkedLennardJonesSimulation*>(simPointer.get()))
+            linkedSim->setBalanceInterval(params.balance_interval);
+    }
+    if (!params.metrics_file.empty()) {
+        simPointer->metrics = std::make_unique<MetricsExporter>(
+            params.metrics_file, params.metrics_interval, dimensions);
+    }
+    if (params.memory_report) {
+        simPointer->memory = std::make_unique<MemoryTracker>();
+        simPointer->memory->sample(*simPointer);
+    }
+    auto startTime = std::chrono::steady_clock::now();
     simPointer->runSim();
+    std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - startTime;
+    if (simPointer->metrics) {
+        simPointer->metrics->write(*simPointer);
+    }
+    if (simPointer->memory) {
+        simPointer->memory->sample(*simPointer);
+        logMemoryTable({ { "peak", simPointer->memory->getPeak() },
+                           { "steady", simPointer->memory->getSteadyState() } },
+            static_cast<size_t>(particles.activeParticleCount));
+        spdlog::info("Accounted peak memory: {:.1f} MiB, peak resident set size: {:.1f} MiB",
+            static_cast<double>(simPointer->memory->getPeakTotal()) / (1024 * 1024),
+            static_cast<double>(peakResidentSetSize()) / 1024);
+    }
+    if (Tracer::isEnabled()) {
+        Tracer::dump(params.trace_file);
+    }
+
+    // write the machine-readable report of the performance measurements
+    if (params.doPerformanceMeasurements) {
+        spdlog::set_level(spdlog::level::info);
+        writeRunReport(params.output_file + "_report.json", *simPointer, params, wallTime.count());
+    }
 
     // inform user that output has been written
     spdlog::info("Output written. Terminating...");
+#ifdef MOLSIM_MPI
+    MPI_Finalize();
+#endif
     return 0;
 }
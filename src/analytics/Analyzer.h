@@ -24,6 +24,12 @@ public:
      */
     virtual void analyze(LennardJonesDomainSimulation& sim);
 
+    /**
+     * @brief Get the heap memory of the profiles computed by analyze.
+     * @return The bytes of the density and velocity profiles.
+     */
+    [[nodiscard]] size_t getBufferBytes() const { return 2 * nBins * sizeof(double); }
+
 protected:
     std::array<size_t, 3> binCounts; /**< The number of bins in each dimension. */
     std::string outName; /**< The name of the output file. */
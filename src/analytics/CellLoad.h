@@ -0,0 +1,43 @@
+#pragma once
+
+#include "models/linked_cell/CellGrid.h"
+#include <chrono>
+
+/**
+ * @class CellLoadScope
+ * @brief Adds the time from its construction to its destruction to the force time of a cell if
+ * the grid records the cell load
+ * @details Every cell is processed by exactly one thread per force calculation, so no
+ * synchronisation is needed. While recording is disabled, only the flag of the grid is checked.
+ */
+class CellLoadScope {
+public:
+    /**
+     * @brief Start measuring
+     * @param grid The grid the cell belongs to
+     * @param cell The cell whose force calculation is measured
+     */
+    inline CellLoadScope(const CellGrid& grid, Cell& cell)
+        : cell(grid.recordLoad ? &cell : nullptr)
+    {
+        if (this->cell)
+            start = std::chrono::steady_clock::now();
+    }
+
+    /**
+     * @brief Stop measuring and add the time to the cell
+     */
+    inline ~CellLoadScope()
+    {
+        if (cell)
+            cell->forceTime +=
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    CellLoadScope(const CellLoadScope&) = delete;
+    CellLoadScope& operator=(const CellLoadScope&) = delete;
+
+private:
+    Cell* cell; /**< The measured cell, nullptr if recording is disabled */
+    std::chrono::steady_clock::time_point start; /**< Start of the measurement */
+};
@@ -0,0 +1,207 @@
+#include "analytics/MemoryAccounting.h"
+#include "analytics/Analyzer.h"
+#include "io/fileWriter/FileWriter.h"
+#include "io/fileWriter/writerFactory.h"
+#include "models/linked_cell/CellGrid.h"
+#include "models/molecules/Membrane.h"
+#include "simulation/MembraneSimulation.h"
+#include "utils/MemoryUtils.h"
+#include "utils/Params.h"
+#include <algorithm>
+#include <functional>
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+#include <sstream>
+
+size_t MemoryUsage::total() const
+{
+    size_t sum = 0;
+    for (size_t b : bytes)
+        sum += b;
+    return sum;
+}
+
+const char* getMemoryCategoryName(MemoryCategory category)
+{
+    switch (category) {
+    case MemoryCategory::PARTICLES:
+        return "particles";
+    case MemoryCategory::CELLS:
+        return "cells";
+    case MemoryCategory::GHOSTS:
+        return "ghosts";
+    case MemoryCategory::TOPOLOGY:
+        return "topology";
+    case MemoryCategory::WRITER:
+        return "writer";
+    case MemoryCategory::ANALYZER:
+        return "analyzer";
+    default:
+        return "unknown";
+    }
+}
+
+MemoryUsage measureMemory(const Simulation& sim)
+{
+    MemoryUsage usage;
+    usage[MemoryCategory::PARTICLES] = MemoryUtils::vectorBytes(sim.container.particles)
+        + MemoryUtils::mapBytes(sim.container.inactiveParticleMap);
+    if (const auto* linkedSim = dynamic_cast<const LinkedLennardJonesSimulation*>(&sim))
+        usage[MemoryCategory::CELLS] = linkedSim->getGrid().getMemoryBytes();
+    if (const auto* mixedSim = dynamic_cast<const MixedLJSimulation*>(&sim)) {
+        if (mixedSim->getLevels())
+            usage[MemoryCategory::CELLS] += mixedSim->getLevels()->getMemoryBytes();
+        if (mixedSim->getSubCells())
+            usage[MemoryCategory::CELLS] += mixedSim->getSubCells()->getMemoryBytes();
+    }
+    if (const auto* domainSim = dynamic_cast<const LennardJonesDomainSimulation*>(&sim)) {
+        usage[MemoryCategory::GHOSTS] = domainSim->bcHandler.getGhostBytes();
+        if (domainSim->decomposition)
+            usage[MemoryCategory::GHOSTS] += domainSim->decomposition->getGhostBytes();
+        if (const Analyzer* analyzer = domainSim->getAnalyzer())
+            usage[MemoryCategory::ANALYZER] = analyzer->getBufferBytes();
+    }
+    if (const auto* membraneSim = dynamic_cast<const MembraneSimulation*>(&sim)) {
+        for (const auto& molecule : membraneSim->getMolecules())
+            usage[MemoryCategory::TOPOLOGY] += molecule->getTopologyBytes();
+        usage[MemoryCategory::PARTICLES] += MemoryUtils::vectorBytes(membraneSim->getFastForces());
+    }
+    usage[MemoryCategory::WRITER] = sim.estimateWriterBytes();
+    return usage;
+}
+
+MemoryUsage predictMemory(const Params& params, size_t particles, size_t membraneParticles)
+{
+    if (params.simulation_type != SimulationType::MEMBRANE_LJ)
+        membraneParticles = 0;
+    const size_t total = particles + membraneParticles;
+    MemoryUsage usage;
+
+    // the generators reserve the clusters, membranes are appended and double the capacity
+    size_t capacity = std::max<size_t>(particles, 1);
+    while (capacity < total)
+        capacity *= 2;
+    usage[MemoryCategory::PARTICLES] = total ? capacity * sizeof(Particle) : 0;
+
+    const size_t listNode =
+        MemoryUtils::listNodeOverhead + sizeof(std::reference_wrapper<Particle>);
+    if (params.simulation_type >= SimulationType::LINKED_LJ) {
+        CellGrid grid(params.domain_origin, params.domain_size, params.cutoff);
+        usage[MemoryCategory::CELLS] = grid.getMemoryBytes() + total * listNode;
+
+        if (params.simulation_type >= SimulationType::DOMAIN_LJ) {
+            // every periodic side copies the particles of one boundary cell layer into the halo
+            double ghosts = 0;
+            for (const auto& [position, type] : params.boundaryConfig.boundaryMap) {
+                const size_t dimension = static_cast<size_t>(position) / 2;
+                if (type == BoundaryType::PERIODIC && params.domain_size[dimension] > 0)
+                    ghosts += static_cast<double>(total) * grid.getCellSize()[dimension]
+                        / params.domain_size[dimension];
+            }
+            usage[MemoryCategory::GHOSTS] = static_cast<size_t>(ghosts)
+                * (sizeof(Particle) + sizeof(std::unique_ptr<Particle>) + listNode);
+            usage[MemoryCategory::ANALYZER] =
+                2 * params.bins[0] * params.bins[1] * params.bins[2] * sizeof(double);
+        }
+    }
+
+    // two direct and two diagonal neighbors in two maps, four relations per particle
+    const size_t neighborEntry =
+        MemoryUtils::mapNodeOverhead + sizeof(NeighborParticleMap::value_type) + 2 * sizeof(size_t);
+    const size_t relation =
+        MemoryUtils::mapNodeOverhead + sizeof(NeighboringRelationMap::value_type);
+    usage[MemoryCategory::TOPOLOGY] = membraneParticles * (2 * neighborEntry + 4 * relation);
+
+    auto level = spdlog::get_level();
+    spdlog::set_level(spdlog::level::warn);
+    auto writer = writerFactory(params.writer_type, params.output_file, params);
+    spdlog::set_level(level);
+    usage[MemoryCategory::WRITER] = writer->estimateBytes(total);
+    return usage;
+}
+
+void MemoryTracker::update(const Simulation& sim)
+{
+    if (samples.empty() || (sim.frequency && sim.iteration % sim.frequency == 0))
+        sample(sim);
+}
+
+void MemoryTracker::sample(const Simulation& sim)
+{
+    add(measureMemory(sim));
+}
+
+void MemoryTracker::add(const MemoryUsage& usage)
+{
+    samples.push_back(usage);
+    for (size_t i = 0; i < usage.bytes.size(); ++i)
+        peak.bytes[i] = std::max(peak.bytes[i], usage.bytes[i]);
+    peakTotal = std::max(peakTotal, usage.total());
+}
+
+MemoryUsage MemoryTracker::getSteadyState() const
+{
+    MemoryUsage steady;
+    if (samples.empty())
+        return steady;
+    const size_t first = samples.size() / 2;
+    for (size_t i = 0; i < steady.bytes.size(); ++i) {
+        size_t sum = 0;
+        for (size_t s = first; s < samples.size(); ++s)
+            sum += samples[s].bytes[i];
+        steady.bytes[i] = sum / (samples.size() - first);
+    }
+    return steady;
+}
+
+std::string memoryTable(
+    const std::vector<std::pair<std::string, MemoryUsage>>& columns, size_t particles)
+{
+    const double mib = 1024.0 * 1024.0;
+    std::ostringstream out;
+    out << fmt::format("{:<14}", "memory");
+    for (const auto& column : columns)
+        out << fmt::format("{:>16}", column.first + " [MiB]");
+    out << fmt::format("{:>16}\n", "bytes/particle");
+
+    auto row = [&](const char* name, const std::function<size_t(const MemoryUsage&)>& bytes) {
+        out << fmt::format("{:<14}", name);
+        for (const auto& column : columns)
+            out << fmt::format("{:>16.3f}", static_cast<double>(bytes(column.second)) / mib);
+        const size_t last = columns.empty() ? 0 : bytes(columns.back().second);
+        out << fmt::format("{:>16.1f}\n", particles ? static_cast<double>(last) / particles : 0);
+    };
+    for (size_t i = 0; i < static_cast<size_t>(MemoryCategory::COUNT); ++i) {
+        auto category = static_cast<MemoryCategory>(i);
+        row(getMemoryCategoryName(category),
+            [category](const MemoryUsage& usage) { return usage[category]; });
+    }
+    row("total", [](const MemoryUsage& usage) { return usage.total(); });
+    return out.str();
+}
+
+std::string memoryJson(const MemoryUsage& peak, const MemoryUsage& steady, size_t particles)
+{
+    auto object = [](const MemoryUsage& usage) {
+        std::string json = "{";
+        for (size_t i = 0; i < usage.bytes.size(); ++i) {
+            json += fmt::format(" \"{}\": {},",
+                getMemoryCategoryName(static_cast<MemoryCategory>(i)),
+                usage.bytes[i]);
+        }
+        return json + fmt::format(" \"total\": {} }}", usage.total());
+    };
+    return fmt::format("{{ \"peak\": {}, \"steady\": {}, \"bytesPerParticle\": {} }}",
+        object(peak),
+        object(steady),
+        particles ? static_cast<double>(steady.total()) / particles : 0.0);
+}
+
+void logMemoryTable(
+    const std::vector<std::pair<std::string, MemoryUsage>>& columns, size_t particles)
+{
+    std::istringstream lines(memoryTable(columns, particles));
+    std::string line;
+    while (std::getline(lines, line))
+        spdlog::info("{}", line);
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <utility>
+#include <vector>
+
+// forward-declare Simulation
+class Simulation;
+// forward-declare Params
+class Params;
+
+/**
+ * @brief The data structures the memory accounting distinguishes
+ */
+enum class MemoryCategory {
+    PARTICLES, /**< The particle vector and the map of inactive particles */
+    CELLS, /**< The linked cells with their particle and neighbour lists */
+    GHOSTS, /**< The halo copies inserted by periodic boundaries */
+    TOPOLOGY, /**< The neighbor maps of the membranes */
+    WRITER, /**< The memory of one output, e.g. the DOM of the VTK writer */
+    ANALYZER, /**< The profiles of the analyzer */
+    COUNT /**< The number of categories */
+};
+
+/**
+ * @brief The heap memory of a simulation per category
+ */
+struct MemoryUsage {
+    std::array<size_t, static_cast<size_t>(MemoryCategory::COUNT)> bytes {}; /**< Bytes */
+
+    /**
+     * @brief Access the bytes of a category
+     * @param category The category
+     * @return The bytes
+     */
+    inline size_t& operator[](MemoryCategory category)
+    {
+        return bytes[static_cast<size_t>(category)];
+    }
+
+    /**
+     * @brief Get the bytes of a category
+     * @param category The category
+     * @return The bytes
+     */
+    inline size_t operator[](MemoryCategory category) const
+    {
+        return bytes[static_cast<size_t>(category)];
+    }
+
+    /**
+     * @brief Get the bytes of all categories
+     * @return The sum of all categories
+     */
+    size_t total() const;
+};
+
+/**
+ * @brief Get the name of a memory category
+ * @param category The category
+ * @return The name used in the tables and the JSON report
+ */
+const char* getMemoryCategoryName(MemoryCategory category);
+
+/**
+ * @brief Measure the heap memory of the data structures of a simulation
+ * @details Containers are counted by their capacity and node sizes (see MemoryUtils). The writer
+ * is estimated, as most writers only allocate their memory while writing an output.
+ * @param sim The simulation
+ * @return The bytes per category
+ */
+MemoryUsage measureMemory(const Simulation& sim);
+
+/**
+ * @brief Predict the memory of a simulation from its parameters before it is set up
+ * @details The empty cell grid is built and measured. Everything else is derived from the
+ * particle count: the generators reserve the particle vector, membranes are appended to it, the
+ * ghosts are one cell layer per periodic side assuming a uniform density and every membrane
+ * particle has two direct, two diagonal and four neighboring relations.
+ * @param params The parameters the simulation will be configured with
+ * @param particles The number of particles of clusters and particle data
+ * @param membraneParticles The number of particles in membranes, only used by membrane
+ * simulations
+ * @return The predicted bytes per category at the peak
+ */
+MemoryUsage predictMemory(const Params& params, size_t particles, size_t membraneParticles);
+
+/**
+ * @class MemoryTracker
+ * @brief Samples the memory of a running simulation and keeps its peak and steady state
+ */
+class MemoryTracker {
+public:
+    /**
+     * @brief Sample the memory on the first call and whenever the writer runs
+     * @param sim The running simulation
+     */
+    void update(const Simulation& sim);
+
+    /**
+     * @brief Sample the memory now
+     * @param sim The simulation
+     */
+    void sample(const Simulation& sim);
+
+    /**
+     * @brief Add a measurement
+     * @param usage The bytes per category
+     */
+    void add(const MemoryUsage& usage);
+
+    /**
+     * @brief Get the peak of every category
+     * @return The maximum bytes of every category over all samples
+     */
+    inline const MemoryUsage& getPeak() const { return peak; }
+
+    /**
+     * @brief Get the largest total of a sample
+     * @return The peak bytes
+     */
+    inline size_t getPeakTotal() const { return peakTotal; }
+
+    /**
+     * @brief Get the steady state, after the setup and the growth of the first iterations
+     * @return The mean bytes of every category over the second half of the samples
+     */
+    MemoryUsage getSteadyState() const;
+
+    /**
+     * @brief Get the number of samples
+     * @return The number of samples
+     */
+    inline size_t getSampleCount() const { return samples.size(); }
+
+private:
+    std::vector<MemoryUsage> samples; /**< All samples, oldest first */
+    MemoryUsage peak; /**< The maximum of every category */
+    size_t peakTotal = 0; /**< The largest total of a sample */
+};
+
+/**
+ * @brief Format memory usages as a table with one row per category
+ * @param columns The name and usage of every column, e.g. peak and steady state
+ * @param particles The number of particles, the bytes per particle are computed from the last
+ * column
+ * @return The table in MiB
+ */
+std::string memoryTable(
+    const std::vector<std::pair<std::string, MemoryUsage>>& columns, size_t particles);
+
+/**
+ * @brief Format the peak and steady state as JSON object
+ * @param peak The peak bytes per category
+ * @param steady The steady state bytes per category
+ * @param particles The number of particles
+ * @return The JSON object with the bytes per category and the bytes per particle
+ */
+std::string memoryJson(const MemoryUsage& peak, const MemoryUsage& steady, size_t particles);
+
+/**
+ * @brief Log the table of memory usages line by line with info level
+ * @param columns The name and usage of every column
+ * @param particles The number of particles
+ */
+void logMemoryTable(
+    const std::vector<std::pair<std::string, MemoryUsage>>& columns, size_t particles);
@@ -0,0 +1,114 @@
+#include "analytics/MetricsExporter.h"
+#include "simulation/baseSimulation.h"
+#include "utils/ArrayUtils.h"
+#include <cstdio>
+#include <fstream>
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+#include <sstream>
+
+MetricsExporter::MetricsExporter(std::string filename, double interval, size_t dimensions)
+    : filename(std::move(filename))
+    , interval(interval)
+    , dimensions(dimensions)
+    , startTime(std::chrono::steady_clock::now())
+    , lastWrite(startTime)
+{
+}
+
+void MetricsExporter::update(const Simulation& sim)
+{
+    if (std::chrono::steady_clock::now() - lastWrite >= interval)
+        write(sim);
+}
+
+bool MetricsExporter::write(const Simulation& sim)
+{
+    // write to a temporary file and rename it, so readers never see a partial file
+    std::string tmpName = filename + ".tmp";
+    {
+        std::ofstream file(tmpName);
+        if (file)
+            file << format(sim);
+        if (!file) {
+            if (!failed)
+                spdlog::warn("Could not write the metrics to {}", tmpName);
+            failed = true;
+            return false;
+        }
+    }
+    if (std::rename(tmpName.c_str(), filename.c_str()) != 0) {
+        if (!failed)
+            spdlog::warn("Could not replace the metrics file {}", filename);
+        failed = true;
+        return false;
+    }
+    return true;
+}
+
+std::string MetricsExporter::format(const Simulation& sim)
+{
+    auto now = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed = now - lastWrite;
+    if (elapsed.count() > 0 && sim.iteration > lastIteration) {
+        stepRate = (sim.iteration - lastIteration) / elapsed.count();
+        mups = static_cast<double>(sim.particleUpdates - lastUpdates) / elapsed.count() / 1e6;
+    }
+    lastWrite = now;
+    lastIteration = sim.iteration;
+    lastUpdates = sim.particleUpdates;
+
+    // same definition as the thermostats: sum of m * v^2 over the degrees of freedom
+    double kineticEnergy = 0;
+    for (ParticleRef p : sim.container.view())
+        kineticEnergy += p.m() * ArrayUtils::DotProduct(p.v());
+    const auto particles = static_cast<size_t>(sim.container.activeParticleCount);
+    const double temperature =
+        particles ? kineticEnergy / static_cast<double>(particles * dimensions) : 0;
+
+    // iterations since the writer last ran, it runs every frequency iterations
+    const unsigned outputLag = sim.frequency ? sim.iteration % sim.frequency : 0;
+
+    std::ostringstream out;
+    auto metric = [&](const char* name, const char* type, const char* help, auto value) {
+        out << fmt::format("# HELP molsim_{0} {1}\n# TYPE molsim_{0} {2}\nmolsim_{0} {3}\n",
+            name,
+            help,
+            type,
+            value);
+    };
+    metric("iteration", "gauge", "Current iteration of the simulation.", sim.iteration);
+    metric("simulation_time", "gauge", "Current time of the simulation.", sim.time);
+    metric("end_time", "gauge", "End time of the simulation.", sim.end_time);
+    metric("wall_seconds", "gauge", "Wall time since the simulation started.",
+        std::chrono::duration<double>(now - startTime).count());
+    metric("step_rate", "gauge", "Iterations per second since the previous export.", stepRate);
+    metric("mups", "gauge", "Million particle updates per second since the previous export.",
+        mups);
+    metric("particle_updates_total", "counter", "Particle updates since the start.",
+        sim.particleUpdates);
+    metric("particles", "gauge", "Number of active particles.", particles);
+    metric("temperature", "gauge", "Current temperature of the active particles.", temperature);
+    metric("output_lag_iterations", "gauge", "Iterations since the last output was written.",
+        outputLag);
+    metric("output_lag_seconds", "gauge", "Estimated seconds since the last output was written.",
+        stepRate > 0 ? outputLag / stepRate : 0);
+
+    out << "# HELP molsim_phase_seconds_total Wall time spent in a phase of the simulation loop.\n"
+        << "# TYPE molsim_phase_seconds_total counter\n";
+    for (size_t i = 0; i < static_cast<size_t>(Phase::COUNT); ++i) {
+        auto phase = static_cast<Phase>(i);
+        out << fmt::format("molsim_phase_seconds_total{{phase=\"{}\"}} {}\n",
+            PhaseTimer::getName(phase),
+            sim.phaseTimer.getStats(phase).total);
+    }
+    out << "# HELP molsim_phase_calls_total Number of calls of a phase of the simulation loop.\n"
+        << "# TYPE molsim_phase_calls_total counter\n";
+    for (size_t i = 0; i < static_cast<size_t>(Phase::COUNT); ++i) {
+        auto phase = static_cast<Phase>(i);
+        out << fmt::format("molsim_phase_calls_total{{phase=\"{}\"}} {}\n",
+            PhaseTimer::getName(phase),
+            sim.phaseTimer.getStats(phase).calls);
+    }
+    return out.str();
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+
+// forward-declare Simulation
+class Simulation;
+
+/**
+ * @class MetricsExporter
+ * @brief Periodically writes live metrics of a running simulation in the Prometheus text format
+ * @details The metrics (step rate, MUP/s, phase times, particle count, temperature and output
+ * lag) are written to a file, which is replaced atomically, so a scraper or the node exporter
+ * textfile collector never reads a partial file. Rates are measured over the interval since the
+ * previous write.
+ */
+class MetricsExporter {
+public:
+    /**
+     * @brief Create an exporter
+     * @param filename The file to write the metrics to, should end in .prom for the textfile
+     * collector
+     * @param interval The minimum number of seconds between two writes
+     * @param dimensions The number of dimensions used for the temperature
+     */
+    MetricsExporter(std::string filename, double interval, size_t dimensions);
+
+    /**
+     * @brief Write the metrics if the interval has passed since the previous write
+     * @param sim The running simulation
+     */
+    void update(const Simulation& sim);
+
+    /**
+     * @brief Write the metrics now
+     * @param sim The simulation
+     * @return False if the file could not be written
+     */
+    bool write(const Simulation& sim);
+
+    /**
+     * @brief Format the metrics of a simulation
+     * @param sim The simulation
+     * @return The metrics in the Prometheus text format
+     */
+    std::string format(const Simulation& sim);
+
+    /**
+     * @brief Get the file the metrics are written to
+     * @return The file name
+     */
+    inline const std::string& getFilename() const { return filename; }
+
+private:
+    std::string filename; /**< The file to write the metrics to */
+    std::chrono::duration<double> interval; /**< The minimum time between two writes */
+    size_t dimensions; /**< The number of dimensions used for the temperature */
+    std::chrono::steady_clock::time_point startTime; /**< Creation of the exporter */
+    std::chrono::steady_clock::time_point lastWrite; /**< Time of the previous write */
+    unsigned lastIteration = 0; /**< Iteration of the previous write */
+    unsigned long long lastUpdates = 0; /**< Particle updates at the previous write */
+    double stepRate = 0; /**< Iterations per second over the previous interval */
+    double mups = 0; /**< Million particle updates per second over the previous interval */
+    bool failed = false; /**< Whether a write failed, to only warn once */
+};
@@ -0,0 +1,83 @@
+#include "analytics/PairStatistics.h"
+#include "utils/ArrayUtils.h"
+#include <iterator>
+
+namespace {
+
+/**
+ * @brief Check the distance of a pair against the cutoff
+ */
+inline void checkPair(
+    const Particle& p1, const Particle& p2, double cutoffSquared, PairStatistics& stats)
+{
+    ++stats.checks;
+    if (ArrayUtils::DotProduct(p1.getX() - p2.getX()) <= cutoffSquared)
+        ++stats.inCutoff;
+}
+
+} // namespace
+
+PairStatistics countCellPairs(const CellGrid& grid, const CellIndex& index)
+{
+    PairStatistics stats;
+    const double cutoffSquared = grid.cutoffRadiusSquared;
+    Cell& cell = *grid.cells[index[0]][index[1]][index[2]];
+    auto& particles = cell.getParticles();
+    for (auto p1 = particles.begin(); p1 != particles.end(); ++p1) {
+        for (auto p2 = std::next(p1); p2 != particles.end(); ++p2)
+            checkPair(p1->get(), p2->get(), cutoffSquared, stats);
+    }
+    for (const auto& i : cell.stencilNeighbours) {
+        for (auto p1 : particles) {
+            for (auto p2 : grid.cells[i[0]][i[1]][i[2]]->getParticles())
+                checkPair(p1.get(), p2.get(), cutoffSquared, stats);
+        }
+    }
+    return stats;
+}
+
+PairStatistics countPairs(const CellGrid& grid)
+{
+    PairStatistics stats;
+    const size_t zSize = grid.cells[0][0].size();
+    const bool is2D = zSize == 1;
+    for (size_t x = 1; x < grid.cells.size() - 1; ++x) {
+        for (size_t y = 1; y < grid.cells[0].size() - 1; ++y) {
+            for (size_t z = is2D ? 0 : 1; z < (is2D ? 1 : zSize - 1); ++z)
+                stats += countCellPairs(grid, { x, y, z });
+        }
+    }
+    return stats;
+}
+
+PairStatistics countLevelPairs(const MultiLevelGrid& levels)
+{
+    PairStatistics stats;
+    for (const CellLevel& level : levels.getLevels()) {
+        for (const auto& cell : level.cells) {
+            for (const LevelEntry& owner : cell) {
+                if (!owner.owned)
+                    continue;
+                levels.forEachCandidate(owner, [&](const LevelEntry& other, double cutoffSquared) {
+                    ++stats.checks;
+                    if (ArrayUtils::DotProduct(owner.x - other.x) <= cutoffSquared)
+                        ++stats.inCutoff;
+                });
+            }
+        }
+    }
+    return stats;
+}
+
+PairStatistics countSubCellPairs(const SubCellGrid& subCells, double cutoffSquared)
+{
+    PairStatistics stats;
+    for (size_t cell = 0; cell < subCells.getCellCount(); ++cell) {
+        subCells.forEachPair(cell, [&](const SubCellEntry& p1, const SubCellEntry& p2) {
+            ++stats.checks;
+            if (ArrayUtils::DotProduct(p1.x - p2.x) <= cutoffSquared)
+                ++stats.inCutoff;
+        });
+    }
+    return stats;
+}
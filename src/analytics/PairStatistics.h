@@ -0,0 +1,62 @@
+#pragma once
+
+#include "models/linked_cell/CellGrid.h"
+#include "models/linked_cell/MultiLevelGrid.h"
+#include "models/linked_cell/SubCellGrid.h"
+
+/**
+ * @brief Number of pair distance checks of one force calculation and how many of them are inside
+ * the cutoff radius
+ */
+struct PairStatistics {
+    unsigned long long checks = 0; /**< Pairs whose distance is compared to the cutoff */
+    unsigned long long inCutoff = 0; /**< Pairs for which a force is calculated */
+
+    /**
+     * @brief Add the statistics of another part of the grid
+     * @param other The statistics to add
+     * @return This statistics
+     */
+    inline PairStatistics& operator+=(const PairStatistics& other)
+    {
+        checks += other.checks;
+        inCutoff += other.inCutoff;
+        return *this;
+    }
+};
+
+/**
+ * @brief Count the pair checks the linked-cell force calculation does for one cell
+ * @details Compares the distances of the pairs within the cell and with its stencil neighbours,
+ * exactly like the force calculation, but without calculating forces. It runs outside of the
+ * simulation loop, so the timings are not affected.
+ * @param grid The cell grid of the simulation
+ * @param index The index of the cell
+ * @return The pair statistics of the cell in one force calculation
+ */
+PairStatistics countCellPairs(const CellGrid& grid, const CellIndex& index);
+
+/**
+ * @brief Count the pair checks the linked-cell force calculation does for the current particle
+ * positions
+ * @param grid The cell grid of the simulation
+ * @return The pair statistics of all inner and boundary cells in one force calculation
+ */
+PairStatistics countPairs(const CellGrid& grid);
+
+/**
+ * @brief Count the pair checks the multi-level force calculation does for the positions the
+ * levels were built with
+ * @param levels The levels of the type cutoffs of the simulation
+ * @return The pair statistics of all owned particles in one force calculation
+ */
+PairStatistics countLevelPairs(const MultiLevelGrid& levels);
+
+/**
+ * @brief Count the pair checks the sub cell force calculation does for the positions the sub
+ * cells were built with
+ * @param subCells The sub cells of the simulation
+ * @param cutoffSquared The squared cutoff of the simulation
+ * @return The pair statistics of all sub cells in one force calculation
+ */
+PairStatistics countSubCellPairs(const SubCellGrid& subCells, double cutoffSquared);
@@ -0,0 +1,242 @@
+#include "analytics/PerfCounters.h"
+#include <omp.h>
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+#include <sstream>
+#include <tuple>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#ifdef __linux__
+/**
+ * @brief Get the perf event type and config of a counter
+ */
+std::pair<uint32_t, uint64_t> eventOf(Counter counter)
+{
+    switch (counter) {
+    case Counter::CYCLES:
+        return { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES };
+    case Counter::INSTRUCTIONS:
+        return { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS };
+    case Counter::L1D_MISSES:
+        return { PERF_TYPE_HW_CACHE,
+            PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) };
+    case Counter::LLC_MISSES:
+        return { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES };
+    case Counter::BRANCH_MISSES:
+    default:
+        return { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES };
+    }
+}
+#endif
+
+} // namespace
+
+PerfCounters::~PerfCounters()
+{
+    closeGroups();
+}
+
+void PerfCounters::closeGroups()
+{
+#ifdef __linux__
+    for (const Group& group : groups) {
+        for (int fd : group.fds) {
+            if (fd >= 0)
+                close(fd);
+        }
+    }
+#endif
+    groups.clear();
+}
+
+PerfCounters::Group PerfCounters::openGroup()
+{
+    Group group;
+    group.fds.fill(-1);
+    group.slots.fill(-1);
+#ifdef __linux__
+    for (size_t c = 0; c < group.fds.size(); ++c) {
+        perf_event_attr attr {};
+        attr.size = sizeof(attr);
+        std::tie(attr.type, attr.config) = eventOf(static_cast<Counter>(c));
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format =
+            PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        // pid 0 and cpu -1 count the calling thread on any cpu
+        int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group.leader, 0));
+        if (fd < 0)
+            continue;
+        if (group.leader < 0)
+            group.leader = fd;
+        group.fds[c] = fd;
+        group.slots[c] = group.size++;
+    }
+#endif
+    return group;
+}
+
+bool PerfCounters::readGroup(const Group& group, CounterValues& values)
+{
+    values.fill(0);
+#ifdef __linux__
+    // layout of a group read: number of values, time enabled, time running, values
+    std::array<uint64_t, 3 + static_cast<size_t>(Counter::COUNT)> buffer {};
+    if (group.leader < 0 || read(group.leader, buffer.data(), sizeof(buffer)) <= 0)
+        return false;
+    uint64_t enabled = buffer[1];
+    uint64_t running = buffer[2];
+    for (size_t c = 0; c < values.size(); ++c) {
+        if (group.slots[c] < 0)
+            continue;
+        uint64_t value = buffer[3 + static_cast<size_t>(group.slots[c])];
+        // the counters were multiplexed if they did not run the whole time
+        if (running && running < enabled)
+            value = static_cast<uint64_t>(
+                static_cast<double>(value) * static_cast<double>(enabled) / running);
+        values[c] = value;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool PerfCounters::open()
+{
+    groups.assign(static_cast<size_t>(omp_get_max_threads()), Group {});
+#pragma omp parallel
+    {
+        auto thread = static_cast<size_t>(omp_get_thread_num());
+        if (thread < groups.size())
+            groups[thread] = openGroup();
+    }
+
+    for (const Group& group : groups) {
+        if (group.leader < 0) {
+            spdlog::warn("Hardware performance counters are unavailable, perf_event_open failed "
+                         "(see /proc/sys/kernel/perf_event_paranoid)");
+            closeGroups();
+            return false;
+        }
+    }
+    for (size_t c = 0; c < static_cast<size_t>(Counter::COUNT); ++c) {
+        if (!isAvailable(static_cast<Counter>(c)))
+            spdlog::warn("Hardware counter {} is not supported", getName(static_cast<Counter>(c)));
+    }
+
+    startValues.assign(groups.size(), CounterValues {});
+    values.assign(groups.size(), {});
+    spdlog::info("Counting hardware events in {} threads", groups.size());
+    return true;
+}
+
+bool PerfCounters::isAvailable(Counter counter) const
+{
+    if (groups.empty())
+        return false;
+    for (const Group& group : groups) {
+        if (group.fds[static_cast<size_t>(counter)] < 0)
+            return false;
+    }
+    return true;
+}
+
+void PerfCounters::start()
+{
+    for (size_t thread = 0; thread < groups.size(); ++thread)
+        readGroup(groups[thread], startValues[thread]);
+}
+
+void PerfCounters::stop(Phase phase)
+{
+    CounterValues now;
+    for (size_t thread = 0; thread < groups.size(); ++thread) {
+        if (!readGroup(groups[thread], now))
+            continue;
+        CounterValues& sum = values[thread][static_cast<size_t>(phase)];
+        for (size_t c = 0; c < now.size(); ++c) {
+            // scaled values of multiplexed counters may decrease slightly
+            if (now[c] > startValues[thread][c])
+                sum[c] += now[c] - startValues[thread][c];
+        }
+    }
+    ++stops[static_cast<size_t>(phase)];
+}
+
+const CounterValues& PerfCounters::get(Phase phase, size_t thread) const
+{
+    return values.at(thread)[static_cast<size_t>(phase)];
+}
+
+CounterValues PerfCounters::getTotal(Phase phase) const
+{
+    CounterValues total {};
+    for (const auto& thread : values) {
+        for (size_t c = 0; c < total.size(); ++c)
+            total[c] += thread[static_cast<size_t>(phase)][c];
+    }
+    return total;
+}
+
+const char* PerfCounters::getName(Counter counter)
+{
+    switch (counter) {
+    case Counter::CYCLES:
+        return "cycles";
+    case Counter::INSTRUCTIONS:
+        return "instructions";
+    case Counter::L1D_MISSES:
+        return "l1dMisses";
+    case Counter::LLC_MISSES:
+        return "llcMisses";
+    case Counter::BRANCH_MISSES:
+        return "branchMisses";
+    default:
+        return "unknown";
+    }
+}
+
+std::string PerfCounters::summary() const
+{
+    std::ostringstream out;
+    out << fmt::format("{:<14}", "phase");
+    for (size_t c = 0; c < static_cast<size_t>(Counter::COUNT); ++c)
+        out << fmt::format("{:>16}", getName(static_cast<Counter>(c)));
+    out << fmt::format("{:>8}\n", "IPC");
+
+    auto row = [&](const std::string& label, const CounterValues& counts) {
+        out << fmt::format("{:<14}", label);
+        for (size_t c = 0; c < counts.size(); ++c) {
+            if (isAvailable(static_cast<Counter>(c)))
+                out << fmt::format("{:>16}", counts[c]);
+            else
+                out << fmt::format("{:>16}", "-");
+        }
+        const auto cycles = counts[static_cast<size_t>(Counter::CYCLES)];
+        const auto instructions = counts[static_cast<size_t>(Counter::INSTRUCTIONS)];
+        if (cycles)
+            out << fmt::format("{:>8.2f}\n", static_cast<double>(instructions) / cycles);
+        else
+            out << fmt::format("{:>8}\n", "-");
+    };
+
+    for (size_t i = 0; i < stops.size(); ++i) {
+        if (!stops[i])
+            continue;
+        auto phase = static_cast<Phase>(i);
+        row(PhaseTimer::getName(phase), getTotal(phase));
+        if (groups.size() > 1) {
+            for (size_t thread = 0; thread < groups.size(); ++thread)
+                row(fmt::format("  thread {}", thread), get(phase, thread));
+        }
+    }
+    return out.str();
+}
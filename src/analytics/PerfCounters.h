@@ -0,0 +1,136 @@
+#pragma once
+
+#include "analytics/PhaseTimer.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The hardware events counted per phase and thread
+ */
+enum class Counter { CYCLES, INSTRUCTIONS, L1D_MISSES, LLC_MISSES, BRANCH_MISSES, COUNT };
+
+/** @brief Values of all counters */
+typedef std::array<uint64_t, static_cast<size_t>(Counter::COUNT)> CounterValues;
+
+/**
+ * @class PerfCounters
+ * @brief Hardware performance counters of every OpenMP thread, read through Linux perf_event_open
+ * @details Each OpenMP thread opens one counter group for itself, which the master thread reads
+ * before and after every phase. Counters which the CPU or the kernel do not support are skipped,
+ * multiplexed counters are scaled by their running time. Only user space events are counted, so
+ * perf_event_paranoid up to 2 is sufficient.
+ */
+class PerfCounters {
+public:
+    PerfCounters() = default;
+
+    /**
+     * @brief Close all counters
+     */
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /**
+     * @brief Open and start the counters in every OpenMP thread
+     * @details Threads started after this call (e.g. by increasing the number of OpenMP threads)
+     * are not counted.
+     * @return False if no counter is available on this system
+     */
+    bool open();
+
+    /**
+     * @brief Check if a counter could be opened
+     * @param counter The counter
+     * @return True if the counter is counted in every thread
+     */
+    bool isAvailable(Counter counter) const;
+
+    /**
+     * @brief Remember the current counter values of all threads as start of a phase
+     */
+    void start();
+
+    /**
+     * @brief Add the counts since the last start to a phase
+     * @param phase The phase to account the counts to
+     */
+    void stop(Phase phase);
+
+    /**
+     * @brief Get the counts of a phase in one thread
+     * @param phase The phase
+     * @param thread The OpenMP thread number
+     * @return The counts
+     */
+    const CounterValues& get(Phase phase, size_t thread) const;
+
+    /**
+     * @brief Get the counts of a phase summed over all threads
+     * @param phase The phase
+     * @return The counts
+     */
+    CounterValues getTotal(Phase phase) const;
+
+    /**
+     * @brief Get the number of counted threads
+     * @return The number of OpenMP threads with open counters
+     */
+    inline size_t getThreadCount() const { return groups.size(); }
+
+    /**
+     * @brief Get the name of a counter
+     * @param counter The counter
+     * @return The name used in logs and reports
+     */
+    static const char* getName(Counter counter);
+
+    /**
+     * @brief Format the counts of all counted phases as a table
+     * @details Every phase has a row with the sum over all threads, followed by one row per thread
+     * if more than one thread was counted.
+     * @return The table
+     */
+    std::string summary() const;
+
+private:
+    /**
+     * @brief The counter group of one thread
+     */
+    struct Group {
+        int leader = -1; /**< File descriptor of the group leader */
+        std::array<int, static_cast<size_t>(Counter::COUNT)> fds {}; /**< -1 if not opened */
+        std::array<int, static_cast<size_t>(Counter::COUNT)>
+            slots {}; /**< Position of the counter in a group read, -1 if not opened */
+        int size = 0; /**< Number of opened counters */
+    };
+
+    /**
+     * @brief Open the counter group of the calling thread
+     * @return The group, without leader if no counter is supported
+     */
+    static Group openGroup();
+
+    /**
+     * @brief Read the scaled values of a group
+     * @param group The group
+     * @param values The values, counters which are not open are 0
+     * @return False if the group could not be read
+     */
+    static bool readGroup(const Group& group, CounterValues& values);
+
+    /**
+     * @brief Close the counters of all threads
+     */
+    void closeGroups();
+
+    std::vector<Group> groups; /**< Counter group of every OpenMP thread */
+    std::vector<CounterValues> startValues; /**< Counts of every thread at the phase start */
+    std::vector<std::array<CounterValues, static_cast<size_t>(Phase::COUNT)>>
+        values; /**< Counts per thread and phase */
+    std::array<unsigned long long, static_cast<size_t>(Phase::COUNT)>
+        stops {}; /**< Number of counted calls per phase */
+};
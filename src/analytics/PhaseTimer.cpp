@@ -0,0 +1,114 @@
+#include "analytics/PhaseTimer.h"
+#include "analytics/PerfCounters.h"
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+#include <sstream>
+
+PhaseTimer::PhaseTimer() = default;
+
+PhaseTimer::~PhaseTimer() = default;
+
+bool PhaseTimer::enableCounters()
+{
+    auto perfCounters = std::make_unique<PerfCounters>();
+    if (!perfCounters->open())
+        return false;
+    counters = std::move(perfCounters);
+    return true;
+}
+
+void PhaseTimer::startCounters()
+{
+    counters->start();
+}
+
+void PhaseTimer::stopCounters(Phase phase)
+{
+    counters->stop(phase);
+}
+
+double PhaseTimer::getTotal() const
+{
+    double total = 0;
+    for (const auto& entry : stats)
+        total += entry.total;
+    return total;
+}
+
+const char* PhaseTimer::getName(Phase phase)
+{
+    switch (phase) {
+    case Phase::PRE_BOUNDARY:
+        return "preBoundary";
+    case Phase::FORCE:
+        return "calF";
+    case Phase::VELOCITY:
+        return "calV";
+    case Phase::POSITION:
+        return "calX";
+    case Phase::POST_BOUNDARY:
+        return "postBoundary";
+    case Phase::UPDATE_CELLS:
+        return "updateCells";
+    case Phase::WRITER:
+        return "writer";
+    case Phase::ANALYZER:
+        return "analyzer";
+    case Phase::THERMOSTAT:
+        return "thermostat";
+    case Phase::HALO_EXCHANGE:
+        return "haloExchange";
+    case Phase::MIGRATION:
+        return "migration";
+    case Phase::TASK_GRAPH:
+        return "taskGraph";
+    case Phase::INNER_STEPS:
+        return "innerSteps";
+    default:
+        return "unknown";
+    }
+}
+
+std::string PhaseTimer::summary() const
+{
+    double total = getTotal();
+    std::ostringstream out;
+    out << fmt::format("{:<14}{:>12}{:>12}{:>12}{:>12}{:>12}{:>8}\n",
+        "phase", "calls", "total [s]", "mean [ms]", "min [ms]", "max [ms]", "share");
+    for (size_t i = 0; i < stats.size(); ++i) {
+        const PhaseStats& entry = stats[i];
+        if (!entry.calls)
+            continue;
+        out << fmt::format("{:<14}{:>12}{:>12.3f}{:>12.4f}{:>12.4f}{:>12.4f}{:>7.1f}%\n",
+            getName(static_cast<Phase>(i)),
+            entry.calls,
+            entry.total,
+            entry.mean() * 1e3,
+            entry.min * 1e3,
+            entry.max * 1e3,
+            total > 0 ? entry.total / total * 100 : 0);
+    }
+    out << fmt::format("{:<14}{:>12}{:>12.3f}\n", "total", "", total);
+    if (counters)
+        out << counters->summary();
+    return out.str();
+}
+
+std::string PhaseTimer::compactSummary() const
+{
+    std::ostringstream out;
+    out << "Mean phase times [ms]:";
+    for (size_t i = 0; i < stats.size(); ++i) {
+        if (stats[i].calls)
+            out << fmt::format(" {} {:.3f}", getName(static_cast<Phase>(i)), stats[i].mean() * 1e3);
+    }
+    return out.str();
+}
+
+void PhaseTimer::logSummary() const
+{
+    std::istringstream lines(summary());
+    std::string line;
+    while (std::getline(lines, line))
+        spdlog::info("{}", line);
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "analytics/Tracer.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <string>
+
+/**
+ * @brief The phases of a simulation step which are timed separately
+ */
+enum class Phase {
+    PRE_BOUNDARY,
+    FORCE,
+    VELOCITY,
+    POSITION,
+    POST_BOUNDARY,
+    UPDATE_CELLS,
+    WRITER,
+    ANALYZER,
+    THERMOSTAT,
+    HALO_EXCHANGE,
+    MIGRATION,
+    TASK_GRAPH,
+    INNER_STEPS,
+    COUNT
+};
+
+/**
+ * @brief Aggregated timings of one phase
+ */
+struct PhaseStats {
+    unsigned long long calls = 0; /**< Number of timed calls */
+    double total = 0; /**< Total time in seconds */
+    double min = std::numeric_limits<double>::infinity(); /**< Shortest call in seconds */
+    double max = 0; /**< Longest call in seconds */
+
+    /**
+     * @brief Get the mean time of a call
+     * @return The mean time in seconds, 0 if the phase was never called
+     */
+    inline double mean() const { return calls ? total / static_cast<double>(calls) : 0; }
+};
+
+class PerfCounters;
+
+/**
+ * @class PhaseTimer
+ * @brief Lightweight instrumentation timing the phases of the simulation loop
+ * @details Always compiled in: a timed phase costs two steady_clock reads, which is negligible
+ * compared to a force calculation.
+ */
+class PhaseTimer {
+public:
+    PhaseTimer();
+
+    ~PhaseTimer();
+
+    /**
+     * @brief Run a callable and add its runtime to a phase
+     * @details The call is also recorded as span if the Tracer is enabled.
+     * @param phase The phase to account the time to
+     * @param work The callable to run
+     */
+    template <typename Work>
+    inline void time(Phase phase, Work&& work)
+    {
+        TraceScope scope(getName(phase), "phase");
+        if (counters)
+            startCounters();
+        auto start = std::chrono::steady_clock::now();
+        work();
+        record(phase, std::chrono::steady_clock::now() - start);
+        if (counters)
+            stopCounters(phase);
+    }
+
+    /**
+     * @brief Add a measured duration to a phase
+     * @param phase The phase to account the time to
+     * @param duration The measured duration
+     */
+    inline void record(Phase phase, std::chrono::steady_clock::duration duration)
+    {
+        double seconds = std::chrono::duration<double>(duration).count();
+        PhaseStats& entry = stats[static_cast<size_t>(phase)];
+        ++entry.calls;
+        entry.total += seconds;
+        entry.min = std::min(entry.min, seconds);
+        entry.max = std::max(entry.max, seconds);
+    }
+
+    /**
+     * @brief Get the aggregated timings of a phase
+     * @param phase The phase
+     * @return The timings of the phase
+     */
+    inline const PhaseStats& getStats(Phase phase) const
+    {
+        return stats[static_cast<size_t>(phase)];
+    }
+
+    /**
+     * @brief Count hardware events per phase and thread from now on
+     * @return False if hardware performance counters are unavailable
+     */
+    bool enableCounters();
+
+    /**
+     * @brief Get the hardware event counts
+     * @return The counters, nullptr if they are not enabled
+     */
+    inline const PerfCounters* getCounters() const { return counters.get(); }
+
+    /**
+     * @brief Get the summed time of all phases
+     * @return The total time in seconds
+     */
+    double getTotal() const;
+
+    /**
+     * @brief Get the name of a phase
+     * @param phase The phase
+     * @return The name used in logs and reports
+     */
+    static const char* getName(Phase phase);
+
+    /**
+     * @brief Format the timings of all called phases as a table
+     * @return The table with calls, total, mean, min, max and share of every phase, followed by
+     * the table of the hardware event counts if they are enabled
+     */
+    std::string summary() const;
+
+    /**
+     * @brief Format the mean time per call of all called phases in one line
+     * @return The line used for periodic progress updates
+     */
+    std::string compactSummary() const;
+
+    /**
+     * @brief Log the summary table line by line with info level
+     */
+    void logSummary() const;
+
+private:
+    /**
+     * @brief Remember the counter values at the start of a phase
+     */
+    void startCounters();
+
+    /**
+     * @brief Add the counts since startCounters to a phase
+     * @param phase The phase
+     */
+    void stopCounters(Phase phase);
+
+    std::array<PhaseStats, static_cast<size_t>(Phase::COUNT)> stats {}; /**< Timings per phase */
+    std::unique_ptr<PerfCounters> counters; /**< Hardware event counts, nullptr if disabled */
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "analytics/PhaseTimer.h"
 #include <chrono>
 #include <cmath>
 #include <spdlog/spdlog.h>
@@ -54,8 +55,26 @@ public:
             static_cast<unsigned>(static_cast<double>(totalIterations) * (progress + 0.01));
     };
 
+    /**
+     * @brief Logs the progress of the simulation like logProgress(unsigned) and reports the mean
+     * phase timings with every tenth progress log.
+     * @param currentIteration The current iteration of the simulation.
+     * @param phaseTimer The phase timings of the simulation.
+     */
+    inline void logProgress(unsigned currentIteration, const PhaseTimer& phaseTimer)
+    {
+        if (currentIteration < nextLoggingIteration ||
+            spdlog::level::info < spdlog::default_logger()->level())
+            return;
+
+        logProgress(currentIteration);
+        if (++progressLogs % 10 == 0)
+            spdlog::info("{}", phaseTimer.compactSummary());
+    }
+
 private:
     unsigned totalIterations; /**< The total number of iterations in the simulation. */
     std::chrono::steady_clock::time_point startTime; /**< The start time of the simulation. */
     unsigned nextLoggingIteration; /**< Next iteration a log will be added. */
+    unsigned progressLogs = 0; /**< Number of progress logs with phase timings so far. */
 };
@@ -0,0 +1,270 @@
+#include "analytics/RunReport.h"
+#include "analytics/PerfCounters.h"
+#include "simulation/MixedLJSimulation.h"
+#include "simulation/linkedLennardJonesSim.h"
+#include "utils/NumaUtils.h"
+#include <cstdlib>
+#include <fstream>
+#include <omp.h>
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+#include <sstream>
+#include <sys/resource.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace {
+
+/**
+ * @brief Escape a string for a JSON string literal
+ */
+std::string jsonString(const std::string& value)
+{
+    std::string escaped = "\"";
+    for (char c : value) {
+        switch (c) {
+        case '"':
+            escaped += "\\\"";
+            break;
+        case '\\':
+            escaped += "\\\\";
+            break;
+        case '\n':
+            escaped += "\\n";
+            break;
+        case '\t':
+            escaped += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+                escaped += fmt::format("\\u{:04x}", static_cast<int>(c));
+            else
+                escaped += c;
+        }
+    }
+    return escaped + "\"";
+}
+
+/**
+ * @brief Get the name of a simulation type as used in the XML input
+ */
+const char* simulationTypeName(SimulationType type)
+{
+    switch (type) {
+    case SimulationType::PLANET:
+        return "planet";
+    case SimulationType::LJ:
+        return "lj";
+    case SimulationType::LINKED_LJ:
+        return "linkedLj";
+    case SimulationType::DOMAIN_LJ:
+        return "domainLj";
+    case SimulationType::MIXED_LJ:
+        return "mixedLj";
+    case SimulationType::MEMBRANE_LJ:
+        return "membraneLj";
+    default:
+        return "unknown";
+    }
+}
+
+/**
+ * @brief Get the name of the OpenMP thread affinity policy
+ */
+const char* procBindName(omp_proc_bind_t bind)
+{
+    switch (bind) {
+    case omp_proc_bind_false:
+        return "false";
+    case omp_proc_bind_true:
+        return "true";
+    case omp_proc_bind_master:
+        return "master";
+    case omp_proc_bind_close:
+        return "close";
+    case omp_proc_bind_spread:
+        return "spread";
+    default:
+        return "unknown";
+    }
+}
+
+/**
+ * @brief Format the CPUs the process may run on as JSON array
+ */
+std::string cpuAffinity()
+{
+    std::string cpus = "[";
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set))
+                cpus += fmt::format("{}{}", cpus.size() > 1 ? ", " : "", cpu);
+        }
+    }
+#endif
+    return cpus + "]";
+}
+
+/**
+ * @brief Format the available hardware event counts as JSON object
+ */
+std::string counterJson(const PerfCounters& counters, const CounterValues& values)
+{
+    std::string json = "{";
+    for (size_t c = 0; c < values.size(); ++c) {
+        auto counter = static_cast<Counter>(c);
+        if (counters.isAvailable(counter))
+            json += fmt::format("{} \"{}\": {}",
+                json.size() > 1 ? "," : "",
+                PerfCounters::getName(counter),
+                values[c]);
+    }
+    return json + " }";
+}
+
+} // namespace
+
+uint64_t hashFile(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file)
+        return 0;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    char buffer[4096];
+    while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+        for (std::streamsize i = 0; i < file.gcount(); ++i) {
+            hash ^= static_cast<unsigned char>(buffer[i]);
+            hash *= 0x100000001b3ULL;
+        }
+    }
+    return hash;
+}
+
+long peakResidentSetSize()
+{
+    rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#ifdef __APPLE__
+    // macOS reports bytes instead of KiB
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+std::string runReportJson(const Simulation& sim, const Params& params, double wallTime)
+{
+    const auto* linkedSim = dynamic_cast<const LinkedLennardJonesSimulation*>(&sim);
+
+    PairStatistics pairs;
+    size_t cellCount = 0;
+    size_t occupiedCells = 0;
+    if (linkedSim) {
+        const CellGrid& grid = linkedSim->getGrid();
+        const auto* mixedSim = dynamic_cast<const MixedLJSimulation*>(&sim);
+        if (mixedSim && mixedSim->getLevels()) {
+            mixedSim->getLevels()->rebuild(grid);
+            pairs = countLevelPairs(*mixedSim->getLevels());
+        } else if (mixedSim && mixedSim->getSubCells()) {
+            mixedSim->getSubCells()->rebuild(grid);
+            pairs = countSubCellPairs(*mixedSim->getSubCells(), grid.cutoffRadiusSquared);
+        } else {
+            pairs = countPairs(grid);
+        }
+        for (const auto& plane : grid.cells) {
+            for (const auto& row : plane) {
+                for (const auto& cell : row) {
+                    ++cellCount;
+                    if (!cell->getParticles().empty())
+                        ++occupiedCells;
+                }
+            }
+        }
+    } else {
+        // direct summation without cutoff computes every pair
+        auto n = static_cast<unsigned long long>(sim.container.activeParticleCount);
+        pairs.checks = n * (n ? n - 1 : 0) / 2;
+        pairs.inCutoff = pairs.checks;
+    }
+
+    std::ostringstream out;
+    out << "{\n";
+    out << fmt::format("  \"inputFile\": {},\n", jsonString(params.input_file));
+    out << fmt::format("  \"inputHash\": \"{:016x}\",\n", hashFile(params.input_file));
+    out << fmt::format(
+        "  \"simulationType\": \"{}\",\n", simulationTypeName(params.simulation_type));
+    out << fmt::format("  \"parallelType\": \"{}\",\n", getParallelTypeName(params.parallel_type));
+    out << fmt::format("  \"threads\": {},\n", omp_get_max_threads());
+    out << fmt::format("  \"procBind\": \"{}\",\n", procBindName(omp_get_proc_bind()));
+    const char* places = std::getenv("OMP_PLACES");
+    out << fmt::format("  \"places\": {},\n", places ? jsonString(places) : "null");
+    out << fmt::format("  \"cpuAffinity\": {},\n", cpuAffinity());
+    out << fmt::format(
+        "  \"pinning\": \"{}\",\n", NumaUtils::getPinningName(params.thread_pinning));
+    out << fmt::format("  \"numaNodes\": {},\n", NumaUtils::getNodes().size());
+    out << fmt::format("  \"iterations\": {},\n", sim.iteration);
+    out << fmt::format("  \"particles\": {},\n", sim.container.activeParticleCount);
+    out << fmt::format("  \"cells\": {},\n", cellCount);
+    out << fmt::format("  \"occupiedCells\": {},\n", occupiedCells);
+    out << fmt::format("  \"wallTime\": {},\n", wallTime);
+    out << fmt::format("  \"particleUpdates\": {},\n", sim.particleUpdates);
+    out << fmt::format("  \"mups\": {},\n",
+        wallTime > 0 ? static_cast<double>(sim.particleUpdates) / wallTime / 1e6 : 0.0);
+    out << fmt::format("  \"peakRssKiB\": {},\n", peakResidentSetSize());
+    if (sim.memory) {
+        out << fmt::format("  \"memory\": {},\n",
+            memoryJson(sim.memory->getPeak(),
+                sim.memory->getSteadyState(),
+                static_cast<size_t>(sim.container.activeParticleCount)));
+    }
+    out << fmt::format("  \"pairChecks\": {},\n", pairs.checks);
+    out << fmt::format("  \"pairsInCutoff\": {},\n", pairs.inCutoff);
+    out << "  \"phases\": {";
+    bool first = true;
+    for (size_t i = 0; i < static_cast<size_t>(Phase::COUNT); ++i) {
+        auto phase = static_cast<Phase>(i);
+        const PhaseStats& stats = sim.phaseTimer.getStats(phase);
+        if (!stats.calls)
+            continue;
+        out << fmt::format(
+            "{}\n    \"{}\": {{ \"calls\": {}, \"total\": {}, \"mean\": {}, \"min\": {}, "
+            "\"max\": {}",
+            first ? "" : ",",
+            PhaseTimer::getName(phase),
+            stats.calls,
+            stats.total,
+            stats.mean(),
+            stats.min,
+            stats.max);
+        if (const PerfCounters* counters = sim.phaseTimer.getCounters()) {
+            out << ", \"counters\": " << counterJson(*counters, counters->getTotal(phase))
+                << ", \"threadCounters\": [";
+            for (size_t thread = 0; thread < counters->getThreadCount(); ++thread) {
+                out << (thread ? ", " : "") << counterJson(*counters, counters->get(phase, thread));
+            }
+            out << "]";
+        }
+        out << " }";
+        first = false;
+    }
+    out << (first ? "}\n" : "\n  }\n");
+    out << "}\n";
+    return out.str();
+}
+
+void writeRunReport(
+    const std::string& filename, const Simulation& sim, const Params& params, double wallTime)
+{
+    std::ofstream file(filename);
+    if (!file) {
+        spdlog::error("Could not open run report file {}", filename);
+        return;
+    }
+    file << runReportJson(sim, params, wallTime);
+    spdlog::info("Run report written to {}", filename);
+}
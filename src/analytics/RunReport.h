@@ -0,0 +1,39 @@
+#pragma once
+
+#include "analytics/PairStatistics.h"
+#include "simulation/baseSimulation.h"
+#include "utils/Params.h"
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Hash the content of a file with 64 bit FNV-1a
+ * @param filename The file to hash
+ * @return The hash, 0 if the file cannot be read
+ */
+uint64_t hashFile(const std::string& filename);
+
+/**
+ * @brief Get the peak resident set size of the process
+ * @return The peak RSS in KiB, 0 if unknown
+ */
+long peakResidentSetSize();
+
+/**
+ * @brief Format the machine-readable report of a finished run
+ * @param sim The simulation after runSim
+ * @param params The parameters the simulation was configured with
+ * @param wallTime The wall time of runSim in seconds
+ * @return The report as JSON object
+ */
+std::string runReportJson(const Simulation& sim, const Params& params, double wallTime);
+
+/**
+ * @brief Write the report of a finished run to a file
+ * @param filename The JSON file to write
+ * @param sim The simulation after runSim
+ * @param params The parameters the simulation was configured with
+ * @param wallTime The wall time of runSim in seconds
+ */
+void writeRunReport(
+    const std::string& filename, const Simulation& sim, const Params& params, double wallTime);
@@ -0,0 +1,279 @@
+#include "analytics/ScalingStudy.h"
+#include "analytics/Analyzer.h"
+#include "io/fileReader/emptyReader.h"
+#include "io/fileWriter/emptyWriter.h"
+#include "models/generators/CuboidParticleCluster.h"
+#include "models/generators/ParticleGenerator.h"
+#include "physics/stratFactory.h"
+#include "physics/thermostat/ThermostatFactory.h"
+#include "simulation/MixedLJSimulation.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <omp.h>
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+#include <sstream>
+#include <tuple>
+
+namespace {
+
+const double spacing = 1.2;
+
+/**
+ * @brief Get the key which identifies the case of a result
+ */
+auto caseKey(const ScalingResult& r)
+{
+    return std::make_tuple(static_cast<int>(r.mode),
+        static_cast<int>(r.parallelType),
+        r.threads,
+        r.particles,
+        r.steps);
+}
+
+} // namespace
+
+const char* getScalingModeName(ScalingMode mode)
+{
+    return mode == ScalingMode::WEAK ? "weak" : "strong";
+}
+
+ScalingResult runScalingCase(
+    ScalingMode mode, ParallelType parallelType, int threads, size_t particles, unsigned steps)
+{
+    auto level = spdlog::get_level();
+    spdlog::set_level(spdlog::level::off);
+    omp_set_num_threads(threads);
+
+    // a block of side^2 particles per x layer, weak scaling adds layers
+    const size_t total = mode == ScalingMode::WEAK ? particles * threads : particles;
+    const auto side = static_cast<size_t>(std::ceil(std::cbrt(static_cast<double>(particles))));
+    const size_t layers = (total + side * side - 1) / (side * side);
+
+    ParticleContainer container {};
+    ParticleGenerator generator(container);
+    generator.registerCluster(std::make_unique<CuboidParticleCluster>(
+        std::array<double, 3> { spacing / 2, spacing / 2, spacing / 2 },
+        static_cast<int>(layers),
+        static_cast<int>(side),
+        static_cast<int>(side),
+        spacing,
+        1,
+        std::array<double, 3> { 0, 0, 0 },
+        0.1,
+        3,
+        std::map<unsigned, bool> {},
+        1));
+    generator.generateClusters();
+
+    PhysicsStrategy strat = stratFactory(SimulationType::MIXED_LJ, parallelType);
+    const double cutoff = 3 * spacing;
+    MixedLJSimulation sim(
+        0,
+        0.0005,
+        steps * 0.0005,
+        container,
+        strat,
+        std::make_unique<EmptyFileWriter>(),
+        std::make_unique<EmptyFileReader>(""),
+        {},
+        { { 1, { 1, spacing } } },
+        { 0, 0, 0 },
+        // the lattice fits the periodic directions exactly, there is room to fall in y
+        { std::max(layers * spacing, 3 * cutoff),
+          std::max(2 * side * spacing, 3 * cutoff),
+          std::max(side * spacing, 3 * cutoff) },
+        cutoff,
+        BoundaryConfig(
+            BoundaryType::PERIODIC,
+            BoundaryType::PERIODIC,
+            BoundaryType::SOFT_REFLECTIVE,
+            BoundaryType::SOFT_REFLECTIVE,
+            BoundaryType::PERIODIC,
+            BoundaryType::PERIODIC),
+        std::make_unique<Analyzer>(std::array<size_t, 3> { 1, 1, 1 }, ""),
+        -12.44,
+        thermostatFactory(ThermostatType::CLASSICAL, 40, 40, 20, 3),
+        steps + 1,
+        10,
+        steps + 1,
+        true,
+        1000,
+        true);
+
+    const auto count = static_cast<size_t>(container.activeParticleCount);
+    auto start = std::chrono::steady_clock::now();
+    sim.runSim();
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+    spdlog::set_level(level);
+
+    ScalingResult result;
+    result.mode = mode;
+    result.parallelType = parallelType;
+    result.threads = threads;
+    result.particles = count;
+    result.steps = steps;
+    result.time = time.count();
+    result.mups = time.count() > 0 ? sim.particleUpdates / time.count() / 1e6 : 0;
+    return result;
+}
+
+std::vector<ScalingResult> runScalingStudy(const ScalingConfig& config)
+{
+    const int maxThreads = omp_get_max_threads();
+    std::vector<ScalingResult> results;
+    for (ScalingMode mode : config.modes) {
+        for (ParallelType parallelType : config.parallelTypes) {
+            for (int threads : config.threads) {
+                results.push_back(
+                    runScalingCase(mode, parallelType, threads, config.particles, config.steps));
+                const ScalingResult& r = results.back();
+                spdlog::info("{} {} threads {:>3}: {:>8} particles {:>10.4f} s {:>8.3f} MUP/s",
+                    getScalingModeName(mode),
+                    getParallelTypeName(parallelType),
+                    threads,
+                    r.particles,
+                    r.time,
+                    r.mups);
+            }
+        }
+    }
+    omp_set_num_threads(maxThreads);
+    computeSpeedup(results);
+    return results;
+}
+
+void computeSpeedup(std::vector<ScalingResult>& results)
+{
+    for (ScalingResult& r : results) {
+        // the reference is the smallest thread count of the same mode and strategy
+        const ScalingResult* reference = nullptr;
+        for (const ScalingResult& other : results) {
+            if (other.mode == r.mode && other.parallelType == r.parallelType
+                && other.steps == r.steps && (!reference || other.threads < reference->threads))
+                reference = &other;
+        }
+        if (!reference || r.time <= 0) {
+            r.speedup = r.efficiency = 0;
+        } else if (r.mode == ScalingMode::STRONG) {
+            r.speedup = reference->threads * reference->time / r.time;
+            r.efficiency = r.speedup / r.threads;
+        } else {
+            r.efficiency = reference->time / r.time;
+            r.speedup = r.efficiency * r.threads;
+        }
+    }
+}
+
+size_t applyBaseline(
+    std::vector<ScalingResult>& results, const std::vector<ScalingResult>& baseline)
+{
+    size_t matched = 0;
+    for (ScalingResult& r : results) {
+        r.baselineTime = 0;
+        for (const ScalingResult& b : baseline) {
+            if (caseKey(b) == caseKey(r)) {
+                r.baselineTime = b.time;
+                ++matched;
+                break;
+            }
+        }
+    }
+    return matched;
+}
+
+std::string scalingCsv(const std::vector<ScalingResult>& results)
+{
+    std::ostringstream out;
+    out << "mode,parallelType,threads,particles,steps,time,mups,speedup,efficiency,baselineTime,"
+           "change\n";
+    for (const ScalingResult& r : results) {
+        // relative change of the time against the baseline, positive if slower
+        std::string change =
+            r.baselineTime > 0 ? fmt::format("{:.4f}", r.time / r.baselineTime - 1) : "";
+        out << fmt::format("{},{},{},{},{},{:.6f},{:.4f},{:.4f},{:.4f},{:.6f},{}\n",
+            getScalingModeName(r.mode),
+            getParallelTypeName(r.parallelType),
+            r.threads,
+            r.particles,
+            r.steps,
+            r.time,
+            r.mups,
+            r.speedup,
+            r.efficiency,
+            r.baselineTime,
+            change);
+    }
+    return out.str();
+}
+
+std::string scalingJson(const std::vector<ScalingResult>& results)
+{
+    std::ostringstream out;
+    out << "[\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const ScalingResult& r = results[i];
+        out << fmt::format("  {{\"mode\": \"{}\", \"parallelType\": \"{}\", \"threads\": {}, "
+                           "\"particles\": {}, \"steps\": {}, \"time\": {:.6f}, \"mups\": {:.4f}, "
+                           "\"speedup\": {:.4f}, \"efficiency\": {:.4f}",
+            getScalingModeName(r.mode),
+            getParallelTypeName(r.parallelType),
+            r.threads,
+            r.particles,
+            r.steps,
+            r.time,
+            r.mups,
+            r.speedup,
+            r.efficiency);
+        if (r.baselineTime > 0)
+            out << fmt::format(", \"baselineTime\": {:.6f}, \"change\": {:.4f}",
+                r.baselineTime,
+                r.time / r.baselineTime - 1);
+        out << (i + 1 < results.size() ? "},\n" : "}\n");
+    }
+    out << "]\n";
+    return out.str();
+}
+
+std::vector<ScalingResult> parseScalingCsv(std::istream& in)
+{
+    std::vector<ScalingResult> results;
+    std::string line;
+    while (std::getline(in, line)) {
+        std::vector<std::string> fields;
+        std::stringstream stream(line);
+        std::string field;
+        while (std::getline(stream, field, ','))
+            fields.push_back(field);
+        if (fields.size() < 9 || (fields[0] != "strong" && fields[0] != "weak"))
+            continue;
+
+        ScalingResult r;
+        try {
+            r.mode = fields[0] == "weak" ? ScalingMode::WEAK : ScalingMode::STRONG;
+            if (fields[1] == "task")
+                r.parallelType = ParallelType::TASK;
+            else if (fields[1] == "balanced")
+                r.parallelType = ParallelType::BALANCED;
+            else if (fields[1] == "graph")
+                r.parallelType = ParallelType::GRAPH;
+            else if (fields[1] == "stealing")
+                r.parallelType = ParallelType::STEALING;
+            else
+                r.parallelType = ParallelType::STATIC;
+            r.threads = std::stoi(fields[2]);
+            r.particles = std::stoul(fields[3]);
+            r.steps = static_cast<unsigned>(std::stoul(fields[4]));
+            r.time = std::stod(fields[5]);
+            r.mups = std::stod(fields[6]);
+            r.speedup = std::stod(fields[7]);
+            r.efficiency = std::stod(fields[8]);
+        } catch (const std::exception&) {
+            continue;
+        }
+        results.push_back(r);
+    }
+    return results;
+}
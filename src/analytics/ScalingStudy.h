@@ -0,0 +1,107 @@
+#pragma once
+
+#include "utils/Params.h"
+#include <istream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief How the problem size changes with the number of threads
+ */
+enum class ScalingMode { STRONG, WEAK };
+
+/**
+ * @brief The measurement of one thread count in a scaling study
+ */
+struct ScalingResult {
+    ScalingMode mode = ScalingMode::STRONG; /**< Strong or weak scaling */
+    ParallelType parallelType = ParallelType::STATIC; /**< The force calculation strategy */
+    int threads = 1; /**< Number of OpenMP threads */
+    size_t particles = 0; /**< Number of particles */
+    unsigned steps = 0; /**< Number of time steps */
+    double time = 0; /**< Wall time of the steps in seconds */
+    double mups = 0; /**< Million particle updates per second */
+    double speedup = 0; /**< Speedup against the smallest thread count (scaled for weak) */
+    double efficiency = 0; /**< Parallel efficiency against the smallest thread count */
+    double baselineTime = 0; /**< Time of the same case in the baseline, 0 if there is none */
+};
+
+/**
+ * @brief The cases of a scaling study
+ */
+struct ScalingConfig {
+    std::vector<int> threads { 1, 2, 4, 8 }; /**< The thread counts to sweep */
+    std::vector<ScalingMode> modes { ScalingMode::STRONG, ScalingMode::WEAK }; /**< Modes */
+    std::vector<ParallelType> parallelTypes { ParallelType::STATIC,
+                                              ParallelType::TASK }; /**< Strategies */
+    size_t particles = 8000; /**< Particles of strong scaling, particles per thread of weak */
+    unsigned steps = 100; /**< Time steps per case */
+};
+
+/**
+ * @brief Run one case of a scaling study
+ * @details The workload is a 3D Rayleigh-Taylor like block of particles in a mixed LJ simulation
+ * with gravity, periodic in x and z. Weak scaling grows the block and the domain in x. Nothing is
+ * written, the setup is not timed.
+ * @param mode Strong or weak scaling
+ * @param parallelType The force calculation strategy
+ * @param threads The number of OpenMP threads
+ * @param particles The number of particles (per thread for weak scaling)
+ * @param steps The number of time steps
+ * @return The measurement, without speedup and efficiency
+ */
+ScalingResult runScalingCase(
+    ScalingMode mode, ParallelType parallelType, int threads, size_t particles, unsigned steps);
+
+/**
+ * @brief Run all cases of a scaling study and compute their speedup and efficiency
+ * @param config The cases to run
+ * @return The measurements
+ */
+std::vector<ScalingResult> runScalingStudy(const ScalingConfig& config);
+
+/**
+ * @brief Compute speedup and efficiency of every result against the result with the smallest
+ * thread count of the same mode and strategy
+ * @details Strong scaling: speedup = t0 * T(t0) / T(t), efficiency = speedup / t.
+ * Weak scaling: efficiency = T(t0) / T(t), speedup = efficiency * t.
+ * @param results The measurements
+ */
+void computeSpeedup(std::vector<ScalingResult>& results);
+
+/**
+ * @brief Set the baseline time of every result which has a matching case in the baseline
+ * @param results The measurements
+ * @param baseline The stored measurements to compare against
+ * @return The number of results with a baseline
+ */
+size_t applyBaseline(
+    std::vector<ScalingResult>& results, const std::vector<ScalingResult>& baseline);
+
+/**
+ * @brief Format the results as CSV with header
+ * @param results The measurements
+ * @return The CSV, readable by parseScalingCsv
+ */
+std::string scalingCsv(const std::vector<ScalingResult>& results);
+
+/**
+ * @brief Format the results as JSON array
+ * @param results The measurements
+ * @return The JSON
+ */
+std::string scalingJson(const std::vector<ScalingResult>& results);
+
+/**
+ * @brief Read results written by scalingCsv, e.g. as baseline
+ * @param in The CSV
+ * @return The measurements, lines which cannot be parsed are skipped
+ */
+std::vector<ScalingResult> parseScalingCsv(std::istream& in);
+
+/**
+ * @brief Get the name of a scaling mode
+ * @param mode The mode
+ * @return "strong" or "weak"
+ */
+const char* getScalingModeName(ScalingMode mode);
@@ -0,0 +1,89 @@
+#include "analytics/Tracer.h"
+#include <fstream>
+#include <omp.h>
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+
+void Tracer::enable(size_t capacity)
+{
+    Tracer::capacity = capacity;
+    buffers = std::vector<ThreadBuffer>(static_cast<size_t>(omp_get_max_threads()));
+    // reserve up front, so recording never allocates
+    for (auto& buffer : buffers)
+        buffer.events.reserve(capacity);
+    origin = std::chrono::steady_clock::now();
+    enabled = true;
+}
+
+void Tracer::disable()
+{
+    enabled = false;
+    buffers.clear();
+}
+
+void Tracer::record(const char* name, const char* category, int64_t start, int64_t arg)
+{
+    auto thread = static_cast<size_t>(omp_get_thread_num());
+    if (!enabled || thread >= buffers.size())
+        return;
+    ThreadBuffer& buffer = buffers[thread];
+    if (buffer.events.size() == capacity) {
+        ++buffer.dropped;
+        return;
+    }
+    buffer.events.push_back({ name, category, start, now() - start, arg });
+}
+
+size_t Tracer::getEventCount()
+{
+    size_t count = 0;
+    for (const auto& buffer : buffers)
+        count += buffer.events.size();
+    return count;
+}
+
+size_t Tracer::getDroppedEvents()
+{
+    size_t dropped = 0;
+    for (const auto& buffer : buffers)
+        dropped += buffer.dropped;
+    return dropped;
+}
+
+void Tracer::dump(const std::string& filename)
+{
+    std::ofstream file(filename);
+    if (!file) {
+        spdlog::error("Could not open trace file {}", filename);
+        return;
+    }
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    for (size_t thread = 0; thread < buffers.size(); ++thread) {
+        file << fmt::format("{}{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},"
+                            "\"args\":{{\"name\":\"OpenMP thread {}\"}}}}",
+            first ? "" : ",\n",
+            thread,
+            thread);
+        first = false;
+        for (const TraceEvent& event : buffers[thread].events) {
+            file << fmt::format(",\n{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\",\"pid\":1,"
+                                "\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}",
+                event.name,
+                event.category,
+                thread,
+                static_cast<double>(event.start) / 1e3,
+                static_cast<double>(event.duration) / 1e3);
+            if (event.arg >= 0)
+                file << fmt::format(",\"args\":{{\"index\":{}}}", event.arg);
+            file << "}";
+        }
+    }
+    file << "\n]}\n";
+
+    spdlog::info("Trace with {} events written to {}", getEventCount(), filename);
+    if (getDroppedEvents())
+        spdlog::warn("{} trace events were dropped, the trace buffers were full",
+            getDroppedEvents());
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief A finished span of work of one thread
+ */
+struct TraceEvent {
+    const char* name; /**< Name of the span, has to outlive the tracer (string literal) */
+    const char* category; /**< Category of the span, has to outlive the tracer (string literal) */
+    int64_t start; /**< Start in nanoseconds since the tracer was enabled */
+    int64_t duration; /**< Duration in nanoseconds */
+    int64_t arg; /**< Argument shown with the span (e.g. the cell index), -1 if unused */
+};
+
+/**
+ * @class Tracer
+ * @brief Opt-in recorder of per-thread spans which are exported as Chrome trace JSON
+ * @details Every OpenMP thread appends to its own preallocated buffer, so recording needs neither
+ * locks nor allocations. Events of a full buffer are dropped and counted. While the tracer is
+ * disabled, a TraceScope only checks one flag.
+ */
+class Tracer {
+public:
+    /**
+     * @brief Enable recording and discard all previously recorded events
+     * @param capacity The maximum number of events per thread
+     */
+    static void enable(size_t capacity = 1 << 20);
+
+    /**
+     * @brief Disable recording and release the buffers
+     */
+    static void disable();
+
+    /**
+     * @brief Check if events are recorded
+     * @return True if the tracer is enabled
+     */
+    static inline bool isEnabled() { return enabled; }
+
+    /**
+     * @brief Get the current time of the trace clock
+     * @return Nanoseconds since the tracer was enabled
+     */
+    static inline int64_t now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - origin)
+            .count();
+    }
+
+    /**
+     * @brief Record a span which ends now in the buffer of the calling thread
+     * @param name The name of the span
+     * @param category The category of the span
+     * @param start The start of the span as returned by now()
+     * @param arg The argument of the span, -1 if unused
+     */
+    static void record(const char* name, const char* category, int64_t start, int64_t arg);
+
+    /**
+     * @brief Write all recorded events as Chrome trace JSON, loadable in Perfetto or
+     * chrome://tracing
+     * @param filename The file to write
+     */
+    static void dump(const std::string& filename);
+
+    /**
+     * @brief Get the number of recorded events of all threads
+     * @return The number of events
+     */
+    static size_t getEventCount();
+
+    /**
+     * @brief Get the number of events which were dropped because a buffer was full
+     * @return The number of dropped events
+     */
+    static size_t getDroppedEvents();
+
+private:
+    /**
+     * @brief Events of one thread, aligned to a cache line to avoid false sharing
+     */
+    struct alignas(64) ThreadBuffer {
+        std::vector<TraceEvent> events; /**< The recorded events */
+        size_t dropped = 0; /**< Events dropped because the buffer was full */
+    };
+
+    static inline bool enabled = false; /**< Whether events are recorded */
+    static inline size_t capacity = 0; /**< Maximum number of events per thread */
+    static inline std::vector<ThreadBuffer> buffers; /**< One buffer per OpenMP thread */
+    static inline std::chrono::steady_clock::time_point origin; /**< Start of the trace clock */
+};
+
+/**
+ * @class TraceScope
+ * @brief Records a span from its construction to its destruction if the tracer is enabled
+ */
+class TraceScope {
+public:
+    /**
+     * @brief Start a span
+     * @param name The name of the span, has to be a string literal
+     * @param category The category of the span, has to be a string literal
+     * @param arg The argument of the span, -1 if unused
+     */
+    inline TraceScope(const char* name, const char* category, int64_t arg = -1)
+        : name(name)
+        , category(category)
+        , arg(arg)
+        , start(Tracer::isEnabled() ? Tracer::now() : -1)
+    {
+    }
+
+    /**
+     * @brief End the span
+     */
+    inline ~TraceScope()
+    {
+        if (start >= 0)
+            Tracer::record(name, category, start, arg);
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name; /**< Name of the span */
+    const char* category; /**< Category of the span */
+    int64_t arg; /**< Argument of the span */
+    int64_t start; /**< Start of the span, -1 if the tracer was disabled */
+};
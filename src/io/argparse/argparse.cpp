@@ -3,6 +3,7 @@
 #include "utils/Params.h"
 #include <getopt.h>
 #include <iostream>
+#include <sstream>
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 #include <string>
@@ -37,9 +38,42 @@ void printHelp(std::string progName)
               << "  -s, --simtype=VALUE    Specify simulation type (default: 0)" << std::endl
               << "  -w, --writetype=VALUE  Specify writer type (default: 0, incompatible with -p)"
               << std::endl
+              << "      --fields=LIST      Fields written besides positions (default: all)"
+              << std::endl
+              << "      --types=LIST       Only write particles of the given types" << std::endl
+              << "      --region=BOX       Only write particles in xmin,ymin,zmin,xmax,ymax,zmax"
+              << std::endl
+              << "      --stride=K         Only write every K-th particle (default: 1)" << std::endl
+              << "      --snapshots=N      Write output in up to N forked processes (default: 0)"
+              << std::endl
+              << "      --cellload         Write the load of every linked cell with the output"
+              << std::endl
+              << "      --trace=FILE       Write a Chrome trace of the per-thread work to FILE"
+              << std::endl
+              << "      --counters         Count hardware events per phase (Linux perf_event_open)"
+              << std::endl
+              << "      --metrics=FILE     Periodically write live metrics in Prometheus format"
+              << std::endl
+              << "      --metrics_interval=SECONDS  Seconds between metrics exports (default: 10)"
+              << std::endl
+              << "      --memory           Report the memory per data structure (peak, steady)"
+              << std::endl
+              << "      --dry_run[=N]      Only predict the peak memory (for N particles) and exit"
+              << std::endl
+              << "      --ranks=PX,PY[,PZ] Split the domain into PX*PY*PZ MPI ranks (default: auto)"
+              << std::endl
               << "  -p                     Run performance measurements (incompatible with -l, -w)"
               << std::endl
-              << "  -P, --parallel         Specify parallel strategy (static, task)" << std::endl
+              << "                         and write the JSON report <output>_report.json"
+              << std::endl
+              << "  -P, --parallel         Specify parallel strategy "
+              << "(static, task, balanced, graph, stealing)" << std::endl
+              << "      --balance_interval=N  Iterations between two load balancing steps "
+              << "(default: 100)" << std::endl
+              << "      --pinning=TYPE     Pin the threads to the CPUs (none, compact, scatter)"
+              << std::endl
+              << "      --ensemble[=N]     FILE lists runs, run them in N thread groups at once"
+              << std::endl
               << "  -h, --help             Display this help message" << std::endl
               << std::endl
               << "For more details, see the man page with: man ./.molsim.1" << std::endl;
@@ -110,6 +144,26 @@ void convertToDouble(char* optarg, double& value)
     }
 }
 
+void convertToRankGrid(char* optarg, std::array<int, 3>& value)
+{
+    std::stringstream stream(optarg);
+    std::string item;
+    std::array<int, 3> ranks { 0, 0, 1 };
+    size_t count = 0;
+    while (std::getline(stream, item, ',')) {
+        if (count == 3) {
+            std::cout << "Expected at most three ranks per dimension: " << optarg << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        convertToInt(item.data(), ranks[count++]);
+    }
+    if (count < 2 || ranks[0] < 1 || ranks[1] < 1 || ranks[2] < 1) {
+        std::cout << "Invalid ranks per dimension: " << optarg << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    value = ranks;
+}
+
 SimulationType unsignedToSimulationType(unsigned value)
 {
     switch (value) {
@@ -142,6 +196,10 @@ WriterType unsignedToWriterType(unsigned value)
         return WriterType::XML;
     case 3:
         return WriterType::EMPTY;
+    case 4:
+        return WriterType::TRAJ;
+    case 5:
+        return WriterType::SHM;
     default:
         spdlog::warn("Unknown writer type: {}", value);
         exit(EXIT_FAILURE);
@@ -154,12 +212,32 @@ ParallelType stringToParallelType(std::string value)
         return ParallelType::STATIC;
     } else if (value == "task") {
         return ParallelType::TASK;
+    } else if (value == "balanced") {
+        return ParallelType::BALANCED;
+    } else if (value == "graph") {
+        return ParallelType::GRAPH;
+    } else if (value == "stealing") {
+        return ParallelType::STEALING;
     } else {
         spdlog::warn("Unknown parallel type: {}", value);
         exit(EXIT_FAILURE);
     }
 }
 
+PinningType stringToPinningType(std::string value)
+{
+    if (value == "none") {
+        return PinningType::UNPINNED;
+    } else if (value == "compact") {
+        return PinningType::COMPACT;
+    } else if (value == "scatter") {
+        return PinningType::SCATTER;
+    } else {
+        spdlog::warn("Unknown thread pinning: {}", value);
+        exit(EXIT_FAILURE);
+    }
+}
+
 void argparse(int argc, char* argsv[], Params& params)
 {
     // Long options definition
@@ -171,11 +249,28 @@ void argparse(int argc, char* argsv[], Params& params)
                                             { "simtype", required_argument, 0, 's' },
                                             { "writetype", required_argument, 0, 'w' },
                                             { "parallel", required_argument, 0, 'P' },
+                                            { "fields", required_argument, 0, 'F' },
+                                            { "types", required_argument, 0, 'T' },
+                                            { "region", required_argument, 0, 'R' },
+                                            { "stride", required_argument, 0, 'K' },
+                                            { "snapshots", required_argument, 0, 'C' },
+                                            { "trace", required_argument, 0, 'G' },
+                                            { "counters", no_argument, 0, 'H' },
+                                            { "cellload", no_argument, 0, 'L' },
+                                            { "metrics", required_argument, 0, 'M' },
+                                            { "metrics_interval", required_argument, 0, 'I' },
+                                            { "memory", no_argument, 0, 'Y' },
+                                            { "dry_run", optional_argument, 0, 'D' },
+                                            { "ranks", required_argument, 0, 'N' },
+                                            { "balance_interval", required_argument, 0, 'B' },
+                                            { "pinning", required_argument, 0, 'A' },
+                                            { "ensemble", optional_argument, 0, 'Q' },
                                             { "help", no_argument, 0, 'h' },
                                             { 0, 0, 0, 0 } };
 
     unsigned tmp;
     int opt;
+    bool silence = false;
     while ((opt = getopt_long(argc, argsv, "d:e:l:hcs:w:axpP:", long_options, NULL)) != -1) {
         switch (opt) {
         case 'd':
@@ -188,6 +283,7 @@ void argparse(int argc, char* argsv[], Params& params)
             int loglevel;
             convertToInt(optarg, loglevel);
             spdlog::set_level(getLogLevel(loglevel));
+            silence = false;
             break;
         case 'E':
             convertToDouble(optarg, params.epsilon);
@@ -215,11 +311,77 @@ void argparse(int argc, char* argsv[], Params& params)
         case 'p':
             params.doPerformanceMeasurements = true;
             params.writer_type = WriterType::EMPTY;
-            spdlog::set_level(spdlog::level::off);
+            silence = true;
             break;
         case 'P':
             params.parallel_type = stringToParallelType(optarg);
             break;
+        case 'F':
+            if (!params.output_filter.setFields(optarg)) {
+                spdlog::error("Unknown output field in {}", optarg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case 'T':
+            if (!params.output_filter.setTypes(optarg)) {
+                spdlog::error("Invalid output types {}", optarg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case 'R':
+            if (!params.output_filter.setRegion(optarg)) {
+                spdlog::error("Invalid output region {}, expected six numbers", optarg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case 'K':
+            convertToUnsigned(optarg, params.output_filter.stride);
+            break;
+        case 'C':
+            convertToUnsigned(optarg, params.snapshots);
+            break;
+        case 'G':
+            params.trace_file = optarg;
+            break;
+        case 'H':
+            params.perf_counters = true;
+            break;
+        case 'L':
+            params.cell_load = true;
+            break;
+        case 'M':
+            params.metrics_file = optarg;
+            break;
+        case 'I':
+            convertToDouble(optarg, params.metrics_interval);
+            break;
+        case 'Y':
+            params.memory_report = true;
+            break;
+        case 'D':
+            params.dry_run = true;
+            if (optarg) {
+                convertToUnsigned(optarg, tmp);
+                params.dry_run_particles = tmp;
+            }
+            break;
+        case 'N':
+            convertToRankGrid(optarg, params.rank_grid);
+            break;
+        case 'B':
+            convertToUnsigned(optarg, tmp);
+            params.balance_interval = tmp;
+            break;
+        case 'A':
+            params.thread_pinning = stringToPinningType(optarg);
+            break;
+        case 'Q':
+            params.ensemble = true;
+            if (optarg) {
+                convertToUnsigned(optarg, tmp);
+                params.ensemble_groups = tmp;
+            }
+            break;
         case 'h':
             printHelp(argsv[0]);
             exit(EXIT_SUCCESS);
@@ -230,6 +392,10 @@ void argparse(int argc, char* argsv[], Params& params)
         }
     }
 
+    // an ensemble keeps its log for the summary of its runs
+    if (silence && !params.ensemble)
+        spdlog::set_level(spdlog::level::off);
+
     if (argc - optind != 1) {
         std::cout << "Missing positional argument: FILE" << std::endl;
         printHelp(argsv[0]);
@@ -171,3 +171,56 @@ void XmlReader::readFile(Simulation& sim)
         exit(EXIT_FAILURE);
     }
 }
+
+size_t countXmlParticles(const std::string& filename, size_t& membraneParticles)
+{
+    std::ifstream input_file(filename);
+    if (!input_file.is_open()) {
+        spdlog::error("Error: could not open file {}", filename);
+        exit(EXIT_FAILURE);
+    }
+
+    size_t particles = 0;
+    membraneParticles = 0;
+    try {
+        std::unique_ptr<simulation_t> sim_input(
+            simulation(input_file, xml_schema::flags::dont_validate));
+
+        for (const auto& cuboid : sim_input->clusters().cuboid()) {
+            particles +=
+                static_cast<size_t>(cuboid.dim().x()) * cuboid.dim().y() * cuboid.dim().z();
+        }
+        // the sphere computes its number of particles on construction
+        for (const auto& sphere : sim_input->clusters().sphere()) {
+            SphereParticleCluster cluster(
+                { sphere.center().x(), sphere.center().y(), sphere.center().z() },
+                sphere.radius(),
+                sphere.sphereDim(),
+                sphere.spacing(),
+                sphere.mass(),
+                { sphere.vel().x(), sphere.vel().y(), sphere.vel().z() },
+                sphere.brownVel(),
+                sphere.brownDim(),
+                {},
+                0);
+            particles += cluster.getTotalNumberOfParticles();
+        }
+        if (sim_input->particles().present())
+            particles += sim_input->particles().get().MassData().size();
+        if (sim_input->molecules().present()) {
+            for (const auto& membrane : sim_input->molecules().get().membrane())
+                membraneParticles += static_cast<size_t>(membrane.dim().x()) * membrane.dim().y()
+                    * membrane.dim().z();
+        }
+    } catch (const xml_schema::exception& e) {
+        spdlog::error("Error when reading: {}", filename);
+
+        std::stringstream ss;
+        ss << e;
+        std::string line;
+        while (std::getline(ss, line, '\n'))
+            spdlog::error(line);
+        exit(EXIT_FAILURE);
+    }
+    return particles;
+}
@@ -23,3 +23,12 @@ class XmlReader : public FileReader {
      */
     void readFile(Simulation& sim) override;
 };
+
+/**
+ * @brief Count the particles an XML input generates without generating them
+ * @details Used by the dry run to predict the memory of a simulation before it is set up.
+ * @param filename The XML input
+ * @param membraneParticles Set to the number of particles of the membranes
+ * @return The number of particles of the clusters and the particle data
+ */
+size_t countXmlParticles(const std::string& filename, size_t& membraneParticles);
@@ -0,0 +1,111 @@
+#include "io/fileWriter/CellLoadWriter.h"
+#include "analytics/PairStatistics.h"
+#include "simulation/linkedLennardJonesSim.h"
+#include <fstream>
+#include <iomanip>
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+#include <sstream>
+#include <vector>
+
+namespace outputWriter {
+
+CellLoadWriter::CellLoadWriter(std::unique_ptr<FileWriter> writer)
+    : FileWriter(writer->out_name)
+    , writer(std::move(writer))
+{
+    filter = this->writer->filter;
+}
+
+void CellLoadWriter::plotParticles(const Simulation& s)
+{
+    writer->out_name = out_name;
+    writer->filter = filter;
+    writer->plotParticles(s);
+
+    const auto* linkedSim = dynamic_cast<const LinkedLennardJonesSimulation*>(&s);
+    if (!linkedSim)
+        return;
+    writeLoad(linkedSim->getGrid(), out_name, s.iteration, s.iteration - lastIteration);
+    lastIteration = s.iteration;
+}
+
+void CellLoadWriter::writeLoad(
+    const CellGrid& grid, const std::string& filename, int iteration, unsigned iterations)
+{
+    const auto dimensions = grid.getGridDimensions();
+    const auto cellSize = grid.getCellSize();
+    const auto origin = grid.getDomainOrigin();
+    const bool is2D = dimensions[2] == 1;
+
+    // image data stores the cells with x varying fastest
+    std::vector<size_t> particles;
+    std::vector<PairStatistics> pairs;
+    std::vector<double> forceTimes;
+    std::vector<int> types;
+    for (size_t z = 0; z < dimensions[2]; ++z) {
+        for (size_t y = 0; y < dimensions[1]; ++y) {
+            for (size_t x = 0; x < dimensions[0]; ++x) {
+                Cell& cell = *grid.cells[x][y][z];
+                particles.push_back(cell.getParticles().size());
+                // the force calculation only iterates over inner and boundary cells
+                bool calculated = x > 0 && x < dimensions[0] - 1 && y > 0
+                    && y < dimensions[1] - 1 && (is2D || (z > 0 && z < dimensions[2] - 1));
+                pairs.push_back(calculated ? countCellPairs(grid, { x, y, z }) : PairStatistics {});
+                forceTimes.push_back(iterations ? cell.forceTime / iterations : 0);
+                cell.forceTime = 0;
+                types.push_back(static_cast<int>(cell.getType()));
+            }
+        }
+    }
+
+    std::stringstream strstr;
+    strstr << filename << "_load_" << std::setfill('0') << std::setw(4) << iteration << ".vti";
+    std::ofstream file(strstr.str());
+    if (!file) {
+        spdlog::error("Could not open cell load file {}", strstr.str());
+        return;
+    }
+
+    // the grid has one halo layer around the domain, 2D grids are a single layer of cells
+    std::string extent = fmt::format(
+        "0 {} 0 {} 0 {}", dimensions[0], dimensions[1], is2D ? 0 : dimensions[2]);
+    file << "<?xml version=\"1.0\"?>\n"
+         << "<VTKFile type=\"ImageData\" version=\"0.1\" byte_order=\"LittleEndian\">\n"
+         << fmt::format(
+                "  <ImageData WholeExtent=\"{}\" Origin=\"{} {} {}\" Spacing=\"{} {} {}\">\n",
+                extent,
+                origin[0] - cellSize[0],
+                origin[1] - cellSize[1],
+                is2D ? origin[2] : origin[2] - cellSize[2],
+                cellSize[0],
+                cellSize[1],
+                is2D ? 1.0 : cellSize[2])
+         << fmt::format("    <Piece Extent=\"{}\">\n", extent)
+         << "      <CellData Scalars=\"forceTime\">\n";
+
+    auto writeArray = [&](const char* type, const char* name, auto value) {
+        file << fmt::format(
+            "        <DataArray type=\"{}\" Name=\"{}\" format=\"ascii\">\n         ", type, name);
+        for (size_t i = 0; i < particles.size(); ++i)
+            file << ' ' << value(i);
+        file << "\n        </DataArray>\n";
+    };
+    writeArray("UInt64", "particles", [&](size_t i) { return particles[i]; });
+    writeArray("UInt64", "pairChecks", [&](size_t i) { return pairs[i].checks; });
+    writeArray("UInt64", "interactions", [&](size_t i) { return pairs[i].inCutoff; });
+    writeArray("Float64", "forceTime", [&](size_t i) { return forceTimes[i]; });
+    writeArray("Int32", "cellType", [&](size_t i) { return types[i]; });
+
+    file << "      </CellData>\n"
+         << "    </Piece>\n"
+         << "  </ImageData>\n"
+         << "</VTKFile>\n";
+}
+
+size_t CellLoadWriter::estimateBytes(size_t particles) const
+{
+    return writer->estimateBytes(particles);
+}
+
+} // namespace outputWriter
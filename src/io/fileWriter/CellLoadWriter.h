@@ -0,0 +1,64 @@
+#pragma once
+
+#include "io/fileWriter/FileWriter.h"
+#include "models/linked_cell/CellGrid.h"
+#include <memory>
+#include <string>
+
+namespace outputWriter {
+
+/**
+ * @brief Class CellLoadWriter to write the load of every cell of the linked-cell grid next to the
+ * particle output
+ * @details After the wrapped writer has written the particles, the load of every cell is written
+ * as VTK image data (<output>_load_<iteration>.vti) with the cell data arrays particles,
+ * pairChecks, interactions (pairs inside the cutoff), forceTime (mean force calculation time per
+ * iteration since the previous output) and cellType (0 inner, 1 boundary, 2 halo). The force time
+ * is only measured if the grid records the cell load. Simulations without a grid only write
+ * particles.
+ */
+class CellLoadWriter : public FileWriter {
+public:
+    /**
+     * @brief Initializes the CellLoadWriter class
+     * @param writer The writer of the particles
+     */
+    explicit CellLoadWriter(std::unique_ptr<FileWriter> writer);
+
+    /**
+     * @brief Write the particles and the cell load
+     * @param s Simulation object
+     * @return void
+     */
+    void plotParticles(const Simulation& s) override;
+
+    /**
+     * @brief Estimate the memory of the wrapped writer
+     * @param particles The number of active particles
+     * @return The estimated bytes
+     */
+    size_t estimateBytes(size_t particles) const override;
+
+    /**
+     * @brief Check if the wrapped writer keeps state across frames
+     * @return True if the wrapped writer keeps state
+     */
+    inline bool keepsFrameState() const override { return writer->keepsFrameState(); }
+
+    /**
+     * @brief Write the load of all cells and reset their force times
+     * @param grid The grid of the simulation
+     * @param filename The base name of the output file
+     * @param iteration The current iteration
+     * @param iterations The number of iterations the force times were measured over
+     * @return void
+     */
+    static void writeLoad(
+        const CellGrid& grid, const std::string& filename, int iteration, unsigned iterations);
+
+private:
+    std::unique_ptr<FileWriter> writer; /**< The writer of the particles */
+    unsigned lastIteration = 0; /**< The iteration of the previous output */
+};
+
+} // namespace outputWriter
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "io/fileWriter/OutputFilter.h"
 #include "simulation/baseSimulation.h"
 #include <string>
 
@@ -10,10 +11,30 @@ class FileWriter {
 public:
     /**
      * @brief Write the simulation data to a file
+     * @details Writers read the particles through s.container.view(), which neither copies the
+     * particles nor locks their mutexes.
      * @param s Simulation object
      */
     virtual void plotParticles(const Simulation& s) = 0;
 
+    /**
+     * @brief Estimate the heap memory the writer needs to write one output
+     * @details Used by the memory accounting. Writers which stream the particles directly into
+     * the file need no memory besides their buffers and return 0.
+     * @param particles The number of active particles
+     * @return The estimated bytes
+     */
+    virtual size_t estimateBytes(size_t particles) const { return 0; }
+
+    /**
+     * @brief Check if the writer keeps state across frames, e.g. one open file all frames are
+     * appended to
+     * @details The state of such writers is lost when a forked snapshot process exits, so they
+     * are not written in snapshots.
+     * @return True if a frame depends on the state the previous frames left behind
+     */
+    virtual bool keepsFrameState() const { return false; }
+
     /**
      * @brief Constructor of FileWriter
      */
@@ -30,6 +51,16 @@ public:
      */
     std::string out_name = "MD_vtk";
 
+    /**
+     * @brief The fields and particles to write
+     */
+    OutputFilter filter;
+
+    /**
+     * @brief Estimated bytes of a number serialized into a DOM, up to 25 UTF-16 characters
+     */
+    static constexpr size_t domBytesPerValue = 50;
+
     /*
      * @brief Destructor of FileWriter
      * */
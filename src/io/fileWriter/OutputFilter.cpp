@@ -0,0 +1,100 @@
+#include "io/fileWriter/OutputFilter.h"
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Split a comma separated list into its trimmed entries, skipping empty ones
+ */
+std::vector<std::string> splitList(const std::string& list)
+{
+    std::vector<std::string> entries;
+    std::stringstream stream(list);
+    std::string entry;
+    while (std::getline(stream, entry, ',')) {
+        size_t begin = entry.find_first_not_of(" \t");
+        if (begin == std::string::npos)
+            continue;
+        size_t end = entry.find_last_not_of(" \t");
+        entries.push_back(entry.substr(begin, end - begin + 1));
+    }
+    return entries;
+}
+
+} // namespace
+
+bool OutputFilter::selectsAll() const
+{
+    if (stride > 1 || !types.empty())
+        return false;
+    for (size_t i = 0; i < 3; ++i) {
+        if (!std::isinf(regionMin[i]) || !std::isinf(regionMax[i]))
+            return false;
+    }
+    return true;
+}
+
+bool OutputFilter::setFields(const std::string& list)
+{
+    bool mass = false, velocity = false, force = false, type = false;
+    for (const auto& field : splitList(list)) {
+        if (field == "mass")
+            mass = true;
+        else if (field == "velocity")
+            velocity = true;
+        else if (field == "force")
+            force = true;
+        else if (field == "type")
+            type = true;
+        else if (field == "all")
+            mass = velocity = force = type = true;
+        else if (field != "none")
+            return false;
+    }
+    writeMass = mass;
+    writeVelocity = velocity;
+    writeForce = force;
+    writeType = type;
+    return true;
+}
+
+bool OutputFilter::setTypes(const std::string& list)
+{
+    std::set<int> selected;
+    for (const auto& entry : splitList(list)) {
+        try {
+            size_t parsed;
+            selected.insert(std::stoi(entry, &parsed));
+            if (parsed != entry.size())
+                return false;
+        } catch (std::logic_error& e) {
+            return false;
+        }
+    }
+    types = selected;
+    return true;
+}
+
+bool OutputFilter::setRegion(const std::string& list)
+{
+    auto entries = splitList(list);
+    if (entries.size() != 6)
+        return false;
+    std::array<double, 6> values {};
+    for (size_t i = 0; i < 6; ++i) {
+        try {
+            size_t parsed;
+            values[i] = std::stod(entries[i], &parsed);
+            if (parsed != entries[i].size())
+                return false;
+        } catch (std::logic_error& e) {
+            return false;
+        }
+    }
+    regionMin = { values[0], values[1], values[2] };
+    regionMax = { values[3], values[4], values[5] };
+    return true;
+}
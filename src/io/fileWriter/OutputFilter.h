@@ -0,0 +1,77 @@
+#pragma once
+
+#include "models/ParticleView.h"
+#include <array>
+#include <limits>
+#include <set>
+#include <string>
+
+/**
+ * @brief Selection of the fields and particles a FileWriter writes
+ * @details Positions are always written. A particle is written if it lies inside the region
+ * (bounds included), has one of the selected types (all types if none are selected) and its id is
+ * a multiple of the stride. Selecting by id keeps the same particles in every frame.
+ */
+class OutputFilter {
+public:
+    bool writeMass = true; /**< Write the mass of the particles */
+    bool writeVelocity = true; /**< Write the velocity of the particles */
+    bool writeForce = true; /**< Write the force acting on the particles */
+    bool writeType = true; /**< Write the type of the particles */
+    /** @brief Lower corner of the region of interest */
+    std::array<double, 3> regionMin = { -std::numeric_limits<double>::infinity(),
+                                        -std::numeric_limits<double>::infinity(),
+                                        -std::numeric_limits<double>::infinity() };
+    /** @brief Upper corner of the region of interest */
+    std::array<double, 3> regionMax = { std::numeric_limits<double>::infinity(),
+                                        std::numeric_limits<double>::infinity(),
+                                        std::numeric_limits<double>::infinity() };
+    std::set<int> types {}; /**< The types to write, empty for all types */
+    unsigned stride = 1; /**< Only write every stride-th particle */
+
+    /**
+     * @brief Check whether every particle passes the filter
+     * @return true if no region, type or stride restriction is set
+     */
+    bool selectsAll() const;
+
+    /**
+     * @brief Check whether a particle should be written
+     * @param p The particle to check
+     * @return true if the particle passes the filter
+     */
+    inline bool accepts(ParticleRef p) const
+    {
+        if (stride > 1 && p.id() % stride != 0)
+            return false;
+        if (!types.empty() && types.find(p.type()) == types.end())
+            return false;
+        const auto& x = p.x();
+        for (size_t i = 0; i < 3; ++i) {
+            if (x[i] < regionMin[i] || x[i] > regionMax[i])
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Select the written fields from a comma separated list
+     * @param list Subset of mass, velocity, force and type, or all / none
+     * @return false if the list contains an unknown field
+     */
+    bool setFields(const std::string& list);
+
+    /**
+     * @brief Select the written types from a comma separated list
+     * @param list The types to write, empty for all types
+     * @return false if the list contains something else than integers
+     */
+    bool setTypes(const std::string& list);
+
+    /**
+     * @brief Set the region of interest from a comma separated list
+     * @param list The six values xmin,ymin,zmin,xmax,ymax,zmax
+     * @return false if the list does not consist of six numbers
+     */
+    bool setRegion(const std::string& list);
+};
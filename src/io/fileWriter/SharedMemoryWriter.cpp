@@ -0,0 +1,160 @@
+#include "io/fileWriter/SharedMemoryWriter.h"
+#include "models/ParticleContainer.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <spdlog/spdlog.h>
+#include <csignal>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace outputWriter {
+
+namespace {
+
+/**
+ * @brief Check if an existing segment was left over by a finished or crashed run
+ * @param name The name of the segment
+ * @return False if the segment may still be written by a running simulation
+ */
+bool isStale(const std::string& name)
+{
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0)
+        return errno == ENOENT;
+    struct stat status {};
+    const bool complete = fstat(fd, &status) == 0
+        && static_cast<size_t>(status.st_size) >= sizeof(ShmRingHeader);
+    void* memory = complete
+        ? mmap(nullptr, sizeof(ShmRingHeader), PROT_READ, MAP_SHARED, fd, 0)
+        : MAP_FAILED;
+    close(fd);
+    // a segment without a header may be in the middle of its creation by another run
+    if (memory == MAP_FAILED)
+        return false;
+
+    const auto* header = static_cast<const ShmRingHeader*>(memory);
+    bool stale = false;
+    if (header->magic.load(std::memory_order_acquire) == SHM_RING_MAGIC) {
+        // older layouts have no producer, their runs cannot be checked
+        stale = header->version != SHM_RING_VERSION
+            || header->finished.load(std::memory_order_acquire)
+            || (kill(header->producer, 0) != 0 && errno == ESRCH);
+    }
+    munmap(memory, sizeof(ShmRingHeader));
+    return stale;
+}
+
+} // namespace
+
+SharedMemoryWriter::SharedMemoryWriter() = default;
+
+SharedMemoryWriter::SharedMemoryWriter(std::string out_name, unsigned slots)
+    : FileWriter(out_name)
+    , slots(slots ? slots : 1)
+{
+}
+
+SharedMemoryWriter::~SharedMemoryWriter()
+{
+    if (!header)
+        return;
+    header->finished.store(1, std::memory_order_release);
+    munmap(header, size);
+    shm_unlink(segmentName.c_str());
+}
+
+void SharedMemoryWriter::createRing(uint64_t capacity)
+{
+    segmentName = shmSegmentName(out_name);
+    size = shmSegmentSize(slots, capacity);
+
+    int fd = shm_open(segmentName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0 && errno == EEXIST) {
+        if (!isStale(segmentName)) {
+            spdlog::error("The shared memory {} is in use by a running simulation, choose another "
+                          "output name or remove /dev/shm{}",
+                segmentName,
+                segmentName);
+            exit(EXIT_FAILURE);
+        }
+        // replace the segment left over by a finished or crashed run
+        spdlog::warn("Replacing the stale shared memory {}", segmentName);
+        shm_unlink(segmentName.c_str());
+        fd = shm_open(segmentName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    }
+    if (fd < 0) {
+        spdlog::error("Could not create shared memory {}: {}", segmentName, strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        spdlog::error("Could not resize shared memory {}: {}", segmentName, strerror(errno));
+        close(fd);
+        shm_unlink(segmentName.c_str());
+        exit(EXIT_FAILURE);
+    }
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) {
+        spdlog::error("Could not map shared memory {}: {}", segmentName, strerror(errno));
+        shm_unlink(segmentName.c_str());
+        exit(EXIT_FAILURE);
+    }
+
+    // the segment is zero initialised, so all slots start with sequence 0
+    header = static_cast<ShmRingHeader*>(memory);
+    header->version = SHM_RING_VERSION;
+    header->slotCount = slots;
+    header->slotCapacity = capacity;
+    header->producer = static_cast<int32_t>(getpid());
+    header->magic.store(SHM_RING_MAGIC, std::memory_order_release);
+    spdlog::info("Publishing frames to shared memory {} ({} slots of {} particles)",
+        segmentName, slots, capacity);
+}
+
+void SharedMemoryWriter::plotParticles(const Simulation& s)
+{
+    if (!header)
+        createRing(std::max<uint64_t>(s.container.particles.size(), 1));
+
+    uint64_t frame = header->published.load(std::memory_order_relaxed) + 1;
+    ShmSlotHeader* slot = shmSlot(header, (frame - 1) % header->slotCount);
+
+    // mark the slot as being written before touching its data
+    slot->sequence.store(2 * frame - 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    ShmParticle* records = shmParticles(slot);
+    uint64_t count = 0;
+    for (auto p : s.container.view()) {
+        if (!filter.accepts(p))
+            continue;
+        if (count == header->slotCapacity) {
+            if (!warnedCapacity)
+                spdlog::warn("Frame exceeds the shared memory capacity, truncating it");
+            warnedCapacity = true;
+            break;
+        }
+        ShmParticle& record = records[count++];
+        std::copy(p.x().begin(), p.x().end(), record.x);
+        std::copy(p.v().begin(), p.v().end(), record.v);
+        record.id = p.id();
+        record.type = p.type();
+        record.reserved = 0;
+    }
+    slot->iteration = s.iteration;
+    slot->time = s.time;
+    slot->particleCount = count;
+
+    slot->sequence.store(2 * frame, std::memory_order_release);
+    header->published.store(frame, std::memory_order_release);
+}
+
+size_t SharedMemoryWriter::estimateBytes(size_t particles) const
+{
+    return header ? size : shmSegmentSize(slots, std::max<uint64_t>(particles, 1));
+}
+
+} // namespace outputWriter
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "io/fileWriter/FileWriter.h"
+#include "io/shm/ShmRing.h"
+#include <string>
+
+namespace outputWriter {
+
+/**
+ * @brief Class SharedMemoryWriter to publish frames into a POSIX shared-memory ring buffer
+ * @details The segment is named after the output name (see shmSegmentName) and created on the
+ * first frame, sized for the number of particles in the container at that time. Positions,
+ * velocities, ids and types of the particles selected by the filter are published; local analysis
+ * processes read them with the ShmFrameReader. The writer never waits for readers.
+ */
+class SharedMemoryWriter : public FileWriter {
+public:
+    /**
+     * @brief Constructor for the SharedMemoryWriter class
+     * @return SharedMemoryWriter object
+     */
+    SharedMemoryWriter();
+
+    /**
+     * @brief Initializes the SharedMemoryWriter class
+     * @param out_name the output name the segment is named after
+     * @param slots the number of frames kept in the ring
+     */
+    SharedMemoryWriter(std::string out_name, unsigned slots);
+
+    /**
+     * @brief Destructor for the SharedMemoryWriter class, marks the ring as finished and removes
+     * its name (attached readers keep their mapping)
+     * @return void
+     */
+    virtual ~SharedMemoryWriter();
+
+    /**
+     * @brief Publish the current state of the simulation as the next frame
+     * @param s Simulation object
+     * @return void
+     */
+    void plotParticles(const Simulation& s) override;
+
+    /**
+     * @brief Get the size of the shared-memory ring, estimated if it is not yet created
+     * @param particles The number of active particles
+     * @return The bytes of the segment
+     */
+    size_t estimateBytes(size_t particles) const override;
+
+    /**
+     * @brief Every frame is appended to the same output
+     * @return True
+     */
+    inline bool keepsFrameState() const override { return true; }
+
+private:
+    /**
+     * @brief Create and map the segment
+     * @param capacity The maximum number of particles per frame
+     * @return void
+     */
+    void createRing(uint64_t capacity);
+
+    unsigned slots = 4; /**< The number of frames kept in the ring */
+    std::string segmentName; /**< The name of the created segment */
+    ShmRingHeader* header = nullptr; /**< The mapped segment */
+    size_t size = 0; /**< The size of the mapping */
+    bool warnedCapacity = false; /**< Whether a too large frame was already reported */
+};
+
+} // namespace outputWriter
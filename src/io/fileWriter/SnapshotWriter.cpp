@@ -0,0 +1,164 @@
+#include "io/fileWriter/SnapshotWriter.h"
+#include <cerrno>
+#include <cstring>
+#include <omp.h>
+#include <spdlog/spdlog.h>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace outputWriter {
+
+namespace {
+
+/**
+ * @brief Maximum length of an error message sent by a child, fits into the pipe buffer so the
+ * child never blocks on exit
+ */
+constexpr size_t MAX_ERROR_LENGTH = 1024;
+
+} // namespace
+
+SnapshotWriter::SnapshotWriter(std::unique_ptr<FileWriter> writer, unsigned maxChildren)
+    : FileWriter(writer->out_name)
+    , writer(std::move(writer))
+    , synchronous(this->writer->keepsFrameState())
+    , maxChildren(maxChildren ? maxChildren : 1)
+{
+    filter = this->writer->filter;
+    if (synchronous)
+        spdlog::warn("The output of {} keeps its state across frames, it is written synchronously "
+                     "instead of in snapshots",
+            out_name);
+}
+
+SnapshotWriter::~SnapshotWriter()
+{
+    waitAll();
+}
+
+void SnapshotWriter::plotParticles(const Simulation& s)
+{
+    writer->out_name = out_name;
+    writer->filter = filter;
+    if (synchronous) {
+        writer->plotParticles(s);
+        return;
+    }
+
+    reap(false);
+    while (children.size() >= maxChildren)
+        reap(true);
+
+    int fds[2];
+    if (pipe(fds) != 0) {
+        spdlog::warn("Could not create snapshot pipe ({}), writing synchronously", strerror(errno));
+        writer->plotParticles(s);
+        return;
+    }
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        spdlog::warn("Could not fork snapshot ({}), writing synchronously", strerror(errno));
+        close(fds[0]);
+        close(fds[1]);
+        writer->plotParticles(s);
+        return;
+    }
+
+    if (pid == 0) {
+        // child: the parent's OpenMP thread pool does not exist here
+        close(fds[0]);
+        omp_set_num_threads(1);
+        int code = EXIT_SUCCESS;
+        try {
+            writer->plotParticles(s);
+        } catch (const std::exception& e) {
+            std::string message = std::string(e.what()).substr(0, MAX_ERROR_LENGTH);
+            ssize_t written = write(fds[1], message.data(), message.size());
+            (void)written;
+            code = EXIT_FAILURE;
+        }
+        close(fds[1]);
+        // skip destructors and exit handlers of the parent's state
+        _exit(code);
+    }
+
+    close(fds[1]);
+    children.push_back({ pid, fds[0], s.iteration });
+    spdlog::debug("Started snapshot of iteration {} (pid {})", s.iteration, pid);
+}
+
+void SnapshotWriter::waitAll()
+{
+    while (!children.empty())
+        reap(true);
+}
+
+size_t SnapshotWriter::getRunningSnapshots() const
+{
+    return children.size();
+}
+
+size_t SnapshotWriter::getFailedSnapshots() const
+{
+    return failed;
+}
+
+void SnapshotWriter::reap(bool block)
+{
+    for (auto it = children.begin(); it != children.end();) {
+        int status = 0;
+        bool wait = block && it == children.begin();
+        pid_t result;
+        do {
+            result = waitpid(it->pid, &status, wait ? 0 : WNOHANG);
+        } while (result < 0 && errno == EINTR);
+
+        if (result == 0) {
+            ++it;
+            continue;
+        }
+        if (result < 0) {
+            // the child cannot be waited for anymore, treat it as failed
+            status = -1;
+        }
+        finish(*it, status);
+        it = children.erase(it);
+    }
+}
+
+void SnapshotWriter::finish(const Child& child, int status)
+{
+    std::string message;
+    char buffer[256];
+    ssize_t count;
+    while ((count = read(child.errorPipe, buffer, sizeof(buffer))) > 0)
+        message.append(buffer, count);
+    close(child.errorPipe);
+
+    if (status != -1 && WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS) {
+        spdlog::debug("Finished snapshot of iteration {}", child.iteration);
+        return;
+    }
+
+    ++failed;
+    if (message.empty()) {
+        if (status == -1)
+            message = "lost track of snapshot process";
+        else if (WIFSIGNALED(status))
+            message = "killed by signal " + std::to_string(WTERMSIG(status));
+        else
+            message = "exited with status " + std::to_string(WEXITSTATUS(status));
+    }
+    spdlog::error("Snapshot of iteration {} failed: {}", child.iteration, message);
+}
+
+size_t SnapshotWriter::estimateBytes(size_t particles) const
+{
+    if (synchronous)
+        return writer->estimateBytes(particles);
+    return maxChildren * writer->estimateBytes(particles);
+}
+
+} // namespace outputWriter
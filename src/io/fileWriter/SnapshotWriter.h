@@ -0,0 +1,98 @@
+#pragma once
+
+#include "io/fileWriter/FileWriter.h"
+#include <memory>
+#include <sys/types.h>
+#include <vector>
+
+namespace outputWriter {
+
+/**
+ * @brief Class SnapshotWriter to write output in forked child processes
+ * @details On every plot the process forks. The child writes the copy-on-write image of the
+ * particle state with the wrapped writer and exits, while the parent continues the simulation
+ * immediately. At most maxChildren snapshots run concurrently, further plots wait for the oldest
+ * one. Failed snapshots are reported by the parent via their exit status and error message.
+ * Writers which keep state across frames, e.g. the trajectory writer, are written synchronously,
+ * as the children would lose the state and write to the same file concurrently.
+ */
+class SnapshotWriter : public FileWriter {
+public:
+    /**
+     * @brief Initializes the SnapshotWriter class
+     * @param writer The writer used by the children to write the snapshots
+     * @param maxChildren The maximum number of concurrently running snapshots (at least 1)
+     */
+    SnapshotWriter(std::unique_ptr<FileWriter> writer, unsigned maxChildren);
+
+    /**
+     * @brief Destructor for the SnapshotWriter class, waits for all running snapshots
+     * @return void
+     */
+    virtual ~SnapshotWriter();
+
+    /**
+     * @brief Write the simulation data in a forked child process
+     * @param s Simulation object
+     * @return void
+     */
+    void plotParticles(const Simulation& s) override;
+
+    /**
+     * @brief Estimate the memory of the running snapshots, every one writes a copy of the output
+     * @param particles The number of active particles
+     * @return The estimated bytes of all children
+     */
+    size_t estimateBytes(size_t particles) const override;
+
+    /**
+     * @brief Wait until all running snapshots have finished
+     * @return void
+     */
+    void waitAll();
+
+    /**
+     * @brief Get the number of snapshots which are still running
+     * @return The number of running snapshots
+     */
+    size_t getRunningSnapshots() const;
+
+    /**
+     * @brief Get the number of snapshots which failed so far
+     * @return The number of failed snapshots
+     */
+    size_t getFailedSnapshots() const;
+
+private:
+    /**
+     * @brief A running snapshot process
+     */
+    struct Child {
+        pid_t pid; /**< The process id of the child */
+        int errorPipe; /**< Read end of the pipe the child reports errors to */
+        unsigned iteration; /**< The iteration the snapshot was taken in */
+    };
+
+    /**
+     * @brief Collect finished snapshots
+     * @param block Wait for the oldest snapshot if true, only collect finished ones otherwise
+     * @return void
+     */
+    void reap(bool block);
+
+    /**
+     * @brief Report the result of a finished snapshot and release its resources
+     * @param child The finished snapshot
+     * @param status The status returned by waitpid
+     * @return void
+     */
+    void finish(const Child& child, int status);
+
+    std::unique_ptr<FileWriter> writer; /**< The writer used by the children */
+    bool synchronous; /**< The writer keeps state across frames and is not forked */
+    unsigned maxChildren; /**< The maximum number of concurrently running snapshots */
+    std::vector<Child> children; /**< The running snapshots, oldest first */
+    size_t failed = 0; /**< The number of failed snapshots */
+};
+
+} // namespace outputWriter
@@ -0,0 +1,67 @@
+#include "io/fileWriter/TrajectoryWriter.h"
+#include "io/trajectory/TrajectoryCodec.h"
+#include "models/ParticleContainer.h"
+#include <spdlog/spdlog.h>
+
+namespace outputWriter {
+
+TrajectoryWriter::TrajectoryWriter() = default;
+
+TrajectoryWriter::TrajectoryWriter(std::string out_name, double positionPrecision,
+    double velocityPrecision, bool writeVelocities, bool writeTypes)
+    : FileWriter(out_name)
+{
+    frame.positionPrecision = positionPrecision;
+    frame.velocityPrecision = velocityPrecision;
+    frame.flags = (writeVelocities ? TRAJ_VELOCITIES : 0) | (writeTypes ? TRAJ_TYPES : 0);
+}
+
+TrajectoryWriter::~TrajectoryWriter() = default;
+
+void TrajectoryWriter::plotParticles(const Simulation& s)
+{
+    // the output name may still change after construction, so open the file lazily
+    if (!file.is_open()) {
+        file.open(out_name + ".mtr", std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            spdlog::error("Could not open trajectory file {}.mtr", out_name);
+            exit(EXIT_FAILURE);
+        }
+        trajectory::writeHeader(file);
+    }
+
+    frame.clear();
+    frame.iteration = s.iteration;
+    frame.time = s.time;
+    for (auto p : s.container.view()) {
+        if (!filter.accepts(p))
+            continue;
+        frame.positions.push_back(p.x());
+        if (frame.flags & TRAJ_VELOCITIES)
+            frame.velocities.push_back(p.v());
+        if (frame.flags & TRAJ_TYPES)
+            frame.types.push_back(p.type());
+    }
+
+    trajectory::writeFrame(file, frame);
+    file.flush();
+}
+
+size_t TrajectoryWriter::estimateBytes(size_t particles) const
+{
+    // the frame, the quantised integers of the encoder and the payload, which is at most as
+    // large as the integers
+    size_t frameBytes = sizeof(std::array<double, 3>);
+    size_t encodedBytes = 3 * sizeof(int64_t);
+    if (frame.flags & TRAJ_VELOCITIES) {
+        frameBytes += sizeof(std::array<double, 3>);
+        encodedBytes += 3 * sizeof(int64_t);
+    }
+    if (frame.flags & TRAJ_TYPES) {
+        frameBytes += sizeof(int);
+        encodedBytes += sizeof(int64_t);
+    }
+    return particles * (frameBytes + 2 * encodedBytes);
+}
+
+} // namespace outputWriter
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "io/fileWriter/FileWriter.h"
+#include "io/trajectory/TrajectoryFrame.h"
+#include <fstream>
+
+namespace outputWriter {
+
+/**
+ * @brief Class TrajectoryWriter to append all frames of a simulation to one compressed file
+ * @details Positions (and optionally velocities) are quantised to a fixed precision and encoded
+ * with the XTC-like codec in io/trajectory/TrajectoryCodec.h. The file is named <out_name>.mtr and
+ * can be read with the TrajectoryReader or converted to VTU files with the traj2vtu tool.
+ */
+class TrajectoryWriter : public FileWriter {
+public:
+    /**
+     * @brief Constructor for the TrajectoryWriter class
+     * @return TrajectoryWriter object
+     */
+    TrajectoryWriter();
+
+    /**
+     * @brief Initializes the TrajectoryWriter class
+     * @param out_name the name of the output file (without extension)
+     * @param positionPrecision the quantisation step of the positions
+     * @param velocityPrecision the quantisation step of the velocities
+     * @param writeVelocities whether to store the velocities
+     * @param writeTypes whether to store the particle types
+     */
+    TrajectoryWriter(std::string out_name, double positionPrecision, double velocityPrecision,
+        bool writeVelocities, bool writeTypes);
+
+    /**
+     * @brief Destructor for the TrajectoryWriter class, closes the file
+     * @return void
+     */
+    virtual ~TrajectoryWriter();
+
+    /**
+     * @brief Append the current state of the simulation as one frame
+     * @param s Simulation object
+     * @return void
+     */
+    void plotParticles(const Simulation& s) override;
+
+    /**
+     * @brief Estimate the memory of one frame: the frame buffer and the encoded payload
+     * @param particles The number of active particles
+     * @return The estimated bytes
+     */
+    size_t estimateBytes(size_t particles) const override;
+
+    /**
+     * @brief Every frame is appended to the same output
+     * @return True
+     */
+    inline bool keepsFrameState() const override { return true; }
+
+private:
+    /**
+     * @brief The trajectory file, opened on the first frame
+     */
+    std::ofstream file;
+
+    /**
+     * @brief Frame buffer reused between iterations
+     */
+    TrajectoryFrame frame;
+};
+
+} // namespace outputWriter
@@ -7,12 +7,14 @@
 
 #include "io/fileWriter/VTKWriter.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <fstream>
 #include <io/xsd/simulation.h>
 #include <iomanip>
 #include <spdlog/spdlog.h>
 #include <string>
+#include <vector>
 
 namespace outputWriter {
 
@@ -22,36 +24,71 @@ VTKWriter::~VTKWriter() = default;
 
 void VTKWriter::plotParticles(const Simulation& s)
 {
-    initializeOutput(s.container.activeParticleCount);
+    if (filter.selectsAll()) {
+        // every active particle is written at the index of its position among the active ones
+        initializeOutput(s.container.activeParticleCount);
 #pragma omp parallel for
-    for (auto& p : s.container.particles) {
-        if (p.getActivity())
-            plotParticle(p, s.container.getIndex(p.getID()));
+        for (auto& p : s.container.particles) {
+            if (p.getActivity())
+                plotParticle(p, s.container.getIndex(p.getID()));
+        }
+        writeFile(this->out_name, s.iteration);
+        return;
     }
 
+    ParticleView particles = s.container.view();
+
+    // collect the selected particles first, as their number determines the output size
+    std::vector<ParticleRef> selected;
+    selected.reserve(particles.size());
+    for (auto p : particles) {
+        if (filter.accepts(p))
+            selected.push_back(p);
+    }
+
+    initializeOutput(static_cast<int>(selected.size()));
+#pragma omp parallel for
+    for (size_t i = 0; i < selected.size(); ++i)
+        plotParticle(selected[i], i);
+
     writeFile(this->out_name, s.iteration);
 }
 
+size_t VTKWriter::estimateBytes(size_t particles) const
+{
+    const size_t values = 3 + (filter.writeMass ? 1 : 0) + (filter.writeVelocity ? 3 : 0)
+        + (filter.writeForce ? 3 : 0) + (filter.writeType ? 1 : 0);
+    const size_t written = particles / std::max(filter.stride, 1u);
+    const size_t selected = filter.selectsAll() ? 0 : particles * sizeof(ParticleRef);
+    return selected + written * values * (sizeof(double) + domBytesPerValue);
+}
+
 void VTKWriter::initializeOutput(int numParticles)
 {
     vtkFile = new VTKFile_t("UnstructuredGrid");
 
-    // per point, we add type, position, velocity and force
+    // per point, we add the selected fields out of mass, velocity, force and type
     PointData pointData;
-    DataArray_t mass(type::Float32, "mass", 1);
-    DataArray_t velocity(type::Float32, "velocity", 3);
-    DataArray_t forces(type::Float32, "force", 3);
-    DataArray_t type(type::Int32, "type", 1);
-
-    mass.resize(numParticles);
-    velocity.resize(numParticles * 3);
-    forces.resize(numParticles * 3);
-    type.resize(numParticles);
-
-    pointData.DataArray().push_back(mass);
-    pointData.DataArray().push_back(velocity);
-    pointData.DataArray().push_back(forces);
-    pointData.DataArray().push_back(type);
+    if (filter.writeMass) {
+        DataArray_t mass(type::Float32, "mass", 1);
+        mass.resize(numParticles);
+        pointData.DataArray().push_back(mass);
+    }
+    if (filter.writeVelocity) {
+        DataArray_t velocity(type::Float32, "velocity", 3);
+        velocity.resize(numParticles * 3);
+        pointData.DataArray().push_back(velocity);
+    }
+    if (filter.writeForce) {
+        DataArray_t forces(type::Float32, "force", 3);
+        forces.resize(numParticles * 3);
+        pointData.DataArray().push_back(forces);
+    }
+    if (filter.writeType) {
+        DataArray_t type(type::Int32, "type", 1);
+        type.resize(numParticles);
+        pointData.DataArray().push_back(type);
+    }
 
     CellData cellData; // we don't have cell data => leave it empty
 
@@ -81,7 +118,7 @@ void VTKWriter::writeFile(const std::string& filename, int iteration)
     delete vtkFile;
 }
 
-void VTKWriter::plotParticle(Particle& p, size_t index)
+void VTKWriter::plotParticle(ParticleRef p, size_t index)
 {
     if (vtkFile->UnstructuredGrid().present()) {
         spdlog::trace("UnstructuredGrid is present");
@@ -93,28 +130,35 @@ void VTKWriter::plotParticle(Particle& p, size_t index)
         vtkFile->UnstructuredGrid()->Piece().PointData().DataArray();
     PointData::DataArray_iterator dataIterator = pointDataSequence.begin();
 
-    dataIterator->at(index) = p.getM();
-
-    dataIterator++;
-    dataIterator->at(3 * index) = p.getV()[0];
-    dataIterator->at(3 * index + 1) = p.getV()[1];
-    dataIterator->at(3 * index + 2) = p.getV()[2];
+    // the arrays are in the order they were added in initializeOutput()
+    if (filter.writeMass) {
+        dataIterator->at(index) = p.m();
+        dataIterator++;
+    }
 
-    dataIterator++;
+    if (filter.writeVelocity) {
+        dataIterator->at(3 * index) = p.v()[0];
+        dataIterator->at(3 * index + 1) = p.v()[1];
+        dataIterator->at(3 * index + 2) = p.v()[2];
+        dataIterator++;
+    }
 
-    dataIterator->at(3 * index) = p.getF()[0];
-    dataIterator->at(3 * index + 1) = p.getF()[1];
-    dataIterator->at(3 * index + 2) = p.getF()[2];
+    if (filter.writeForce) {
+        dataIterator->at(3 * index) = p.f()[0];
+        dataIterator->at(3 * index + 1) = p.f()[1];
+        dataIterator->at(3 * index + 2) = p.f()[2];
+        dataIterator++;
+    }
 
-    dataIterator++;
-    dataIterator->at(index) = p.getType();
+    if (filter.writeType)
+        dataIterator->at(index) = p.type();
 
     Points::DataArray_sequence& pointsSequence =
         vtkFile->UnstructuredGrid()->Piece().Points().DataArray();
     Points::DataArray_iterator pointsIterator = pointsSequence.begin();
-    pointsIterator->at(3 * index) = p.getX()[0];
-    pointsIterator->at(3 * index + 1) = p.getX()[1];
-    pointsIterator->at(3 * index + 2) = p.getX()[2];
+    pointsIterator->at(3 * index) = p.x()[0];
+    pointsIterator->at(3 * index + 1) = p.x()[1];
+    pointsIterator->at(3 * index + 2) = p.x()[2];
 }
 
 } // namespace outputWriter
@@ -9,7 +9,7 @@
 
 #include "io/fileWriter/FileWriter.h"
 #include "io/xsd/vtk-unstructured.h"
-#include "models/Particle.h"
+#include "models/ParticleView.h"
 #include "simulation/baseSimulation.h"
 
 namespace outputWriter {
@@ -46,6 +46,14 @@ public:
      */
     void plotParticles(const Simulation& s) override;
 
+    /**
+     * @brief Estimate the memory of one output: the selected particles, the tree and the DOM
+     * serialized from it, which all hold every written value
+     * @param particles The number of active particles
+     * @return The estimated bytes
+     */
+    size_t estimateBytes(size_t particles) const override;
+
     /**
      * @brief Set up internal data structures and prepare to plot a particle
      * @param numParticles The number of particles to be plotted
@@ -54,13 +62,13 @@ public:
     void initializeOutput(int numParticles);
 
     /**
-     * @brief plot type, mass, position, velocity and force of a particle.
+     * @brief plot the position and the fields selected by the filter of a particle.
      * @note: initializeOutput() must have been called before.
      * @param p the particle to be plotted
      * @param index the index of the particle
      * @return void
      */
-    void plotParticle(Particle& p, size_t index);
+    void plotParticle(ParticleRef p, size_t index);
 
     /**
      * @brief writes the final output file.
@@ -120,21 +120,21 @@ void XmlWriter::plotParticles(const Simulation& s)
     DecimalArray_t type = DecimalArray_t(1);
 
     // Fill particle data
-    for (auto& p : s.container) {
-        points.push_back(p.getX().at(0));
-        points.push_back(p.getX().at(1));
-        points.push_back(p.getX().at(2));
-        vels.push_back(p.getV().at(0));
-        vels.push_back(p.getV().at(1));
-        vels.push_back(p.getV().at(2));
-        forces.push_back(p.getF().at(0));
-        forces.push_back(p.getF().at(1));
-        forces.push_back(p.getF().at(2));
-        oldForces.push_back(p.getOldF().at(0));
-        oldForces.push_back(p.getOldF().at(1));
-        oldForces.push_back(p.getOldF().at(2));
-        mass.push_back(p.getM());
-        type.push_back(p.getType());
+    for (auto p : s.container.view()) {
+        points.push_back(p.x().at(0));
+        points.push_back(p.x().at(1));
+        points.push_back(p.x().at(2));
+        vels.push_back(p.v().at(0));
+        vels.push_back(p.v().at(1));
+        vels.push_back(p.v().at(2));
+        forces.push_back(p.f().at(0));
+        forces.push_back(p.f().at(1));
+        forces.push_back(p.f().at(2));
+        oldForces.push_back(p.oldF().at(0));
+        oldForces.push_back(p.oldF().at(1));
+        oldForces.push_back(p.oldF().at(2));
+        mass.push_back(p.m());
+        type.push_back(p.type());
     }
 
     // Set particle data
@@ -156,6 +156,14 @@ void XmlWriter::plotParticles(const Simulation& s)
     simulation(file, *sim.get());
 }
 
+size_t XmlWriter::estimateBytes(size_t particles) const
+{
+    // position, velocity, force, old force, mass and type of every particle, the arrays grow
+    // by doubling and are copied twice into the tree
+    const size_t values = 14 * particles;
+    return values * (4 * sizeof(double) + domBytesPerValue);
+}
+
 XmlWriter::XmlWriter() = default;
 XmlWriter::~XmlWriter() = default;
 
@@ -27,6 +27,14 @@ public:
      * @param s Simulation object
      */
     void plotParticles(const Simulation& s) override;
+
+    /**
+     * @brief Estimate the memory of one checkpoint: the growing arrays, their copies in the tree
+     * and the DOM serialized from it
+     * @param particles The number of active particles
+     * @return The estimated bytes
+     */
+    size_t estimateBytes(size_t particles) const override;
 };
 
 }
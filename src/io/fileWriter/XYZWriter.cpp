@@ -10,6 +10,7 @@
 #include <fstream>
 #include <iomanip>
 #include <sstream>
+#include <vector>
 
 namespace outputWriter {
 
@@ -19,24 +20,31 @@ XYZWriter::~XYZWriter() = default;
 
 void XYZWriter::plotParticles(const Simulation& s)
 {
-    plotParticles(s.container, this->out_name, s.iteration);
+    plotParticles(s.container.view(), this->out_name, s.iteration);
 }
 
 void XYZWriter::plotParticles(
-    ParticleContainer particles, const std::string& filename, int iteration)
+    ParticleView particles, const std::string& filename, int iteration)
 {
     std::ofstream file;
     std::stringstream strstr;
     strstr << filename << "_" << std::setfill('0') << std::setw(4) << iteration << ".xyz";
 
+    // XYZ only stores positions, so only the particle selection of the filter applies
+    std::vector<ParticleRef> selected;
+    for (auto p : particles) {
+        if (filter.accepts(p))
+            selected.push_back(p);
+    }
+
     file.open(strstr.str().c_str());
-    file << particles.particles.size() << std::endl;
+    file << selected.size() << std::endl;
     file << "Generated by MolSim. See http://openbabel.org/wiki/XYZ_(format) for "
             "file format doku."
          << std::endl;
 
-    for (auto& p : particles) {
-        std::array<double, 3> x = p.getX();
+    for (auto p : selected) {
+        const std::array<double, 3>& x = p.x();
         file << "Ar ";
         file.setf(std::ios_base::showpoint);
 
@@ -39,15 +39,16 @@ public:
     virtual ~XYZWriter();
 
     /**
-     * @brief Write the simulation data for all particles to a file for one iteration
+     * @brief Write the simulation data for all particles selected by the filter to a file for one
+     * iteration
      *
-     * @param particles ParticleContainer object containing the particles to be written
+     * @param particles View of the particles to be written
      * @param filename Name of the file to be written
      * @param iteration Iteration number of the simulation
      *
      * @return void
      */
-    void plotParticles(ParticleContainer particles, const std::string& filename, int iteration);
+    void plotParticles(ParticleView particles, const std::string& filename, int iteration);
 
     /**
      * @brief Write the simulation data to a file using the simulation object
@@ -1,28 +1,59 @@
 
 #include "io/fileWriter/writerFactory.h"
+#include "io/fileWriter/CellLoadWriter.h"
+#include "io/fileWriter/SharedMemoryWriter.h"
+#include "io/fileWriter/SnapshotWriter.h"
 #include "io/fileWriter/VTKWriter.h"
 #include "io/fileWriter/XMLWriter.h"
+#include "io/fileWriter/TrajectoryWriter.h"
 #include "io/fileWriter/XYZWriter.h"
 #include "io/fileWriter/emptyWriter.h"
 #include <spdlog/spdlog.h>
 
-std::unique_ptr<FileWriter> writerFactory(WriterType type, const std::string& out_name)
+std::unique_ptr<FileWriter> writerFactory(
+    WriterType type, const std::string& out_name, const Params& params)
 {
+    std::unique_ptr<FileWriter> writer;
     switch (type) {
     case WriterType::VTK:
         spdlog::info("Initializing VTKWriter...");
-        return std::make_unique<outputWriter::VTKWriter>(out_name);
+        writer = std::make_unique<outputWriter::VTKWriter>(out_name);
+        break;
     case WriterType::XYZ:
         spdlog::info("Initializing XYZWriter...");
-        return std::make_unique<outputWriter::XYZWriter>(out_name);
+        writer = std::make_unique<outputWriter::XYZWriter>(out_name);
+        break;
     case WriterType::XML:
         spdlog::info("Initializing XMLWriter...");
-        return std::make_unique<outputWriter::XmlWriter>(out_name);
+        writer = std::make_unique<outputWriter::XmlWriter>(out_name);
+        break;
     case WriterType::EMPTY:
         spdlog::info("Initializing EmptyWriter...");
-        return std::make_unique<EmptyFileWriter>();
+        writer = std::make_unique<EmptyFileWriter>();
+        break;
+    case WriterType::TRAJ:
+        spdlog::info("Initializing TrajectoryWriter...");
+        writer = std::make_unique<outputWriter::TrajectoryWriter>(out_name, params.traj_precision,
+            params.traj_velocity_precision, params.traj_velocities, params.traj_types);
+        break;
+    case WriterType::SHM:
+        spdlog::info("Initializing SharedMemoryWriter...");
+        writer = std::make_unique<outputWriter::SharedMemoryWriter>(out_name, params.shm_slots);
+        break;
     default:
         spdlog::warn("Not a valid writer type: Initializing VTK writer.");
-        return std::make_unique<outputWriter::VTKWriter>(out_name);
+        writer = std::make_unique<outputWriter::VTKWriter>(out_name);
     }
+    writer->filter = params.output_filter;
+    if (params.snapshots > 0 && type != WriterType::EMPTY && type != WriterType::SHM) {
+        spdlog::info("Writing output in up to {} forked snapshot processes", params.snapshots);
+        writer =
+            std::make_unique<outputWriter::SnapshotWriter>(std::move(writer), params.snapshots);
+    }
+    // outside of the snapshots, as writing the load resets the force times of the cells
+    if (params.cell_load) {
+        spdlog::info("Writing the load of every cell with the output");
+        writer = std::make_unique<outputWriter::CellLoadWriter>(std::move(writer));
+    }
+    return writer;
 }
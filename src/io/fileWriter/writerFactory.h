@@ -11,6 +11,8 @@
  *
  * @param type An unsigned integer representing the type of file writer to create.
  * @param out_name The name of the output file.
+ * @param params The simulation parameters, used for writer specific settings.
  * @return A unique pointer to a FileWriter object or nullptr if the file type is not supported.
  */
-std::unique_ptr<FileWriter> writerFactory(WriterType type, const std::string& out_name);
+std::unique_ptr<FileWriter> writerFactory(
+    WriterType type, const std::string& out_name, const Params& params);
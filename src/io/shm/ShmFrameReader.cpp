@@ -0,0 +1,89 @@
+#include "io/shm/ShmFrameReader.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+ShmFrameReader::ShmFrameReader(const std::string& out_name)
+{
+    std::string name = shmSegmentName(out_name);
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0)
+        throw std::runtime_error("Could not open shared memory " + name + ": " + strerror(errno));
+
+    struct stat info {};
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(ShmSlotHeader)) {
+        close(fd);
+        throw std::runtime_error("Shared memory " + name + " is not a frame ring");
+    }
+    size = static_cast<size_t>(info.st_size);
+    void* memory = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED)
+        throw std::runtime_error("Could not map shared memory " + name + ": " + strerror(errno));
+
+    header = static_cast<ShmRingHeader*>(memory);
+    if (header->magic.load(std::memory_order_acquire) != SHM_RING_MAGIC
+        || header->version != SHM_RING_VERSION
+        || shmSegmentSize(header->slotCount, header->slotCapacity) > size) {
+        munmap(memory, size);
+        throw std::runtime_error("Shared memory " + name + " is not a compatible frame ring");
+    }
+
+    uint64_t published = header->published.load(std::memory_order_acquire);
+    nextFrame = published ? published : 1;
+}
+
+ShmFrameReader::~ShmFrameReader()
+{
+    munmap(header, size);
+}
+
+bool ShmFrameReader::next(ShmFrame& frame)
+{
+    uint64_t published = header->published.load(std::memory_order_acquire);
+    while (nextFrame <= published) {
+        // skip frames which have already been overwritten
+        if (published - nextFrame >= header->slotCount) {
+            uint64_t oldest = published - header->slotCount + 1;
+            lost += oldest - nextFrame;
+            nextFrame = oldest;
+        }
+
+        ShmSlotHeader* slot = shmSlot(header, (nextFrame - 1) % header->slotCount);
+        uint64_t before = slot->sequence.load(std::memory_order_acquire);
+        if (before == 2 * nextFrame) {
+            uint64_t count = std::min(slot->particleCount, header->slotCapacity);
+            frame.iteration = slot->iteration;
+            frame.time = slot->time;
+            frame.particles.resize(count);
+            std::memcpy(frame.particles.data(), shmParticles(slot), count * sizeof(ShmParticle));
+
+            // the copy is only valid if the writer did not start on the slot in the meantime
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot->sequence.load(std::memory_order_relaxed) == before) {
+                frame.sequence = nextFrame++;
+                return true;
+            }
+        }
+
+        ++lost;
+        ++nextFrame;
+        published = header->published.load(std::memory_order_acquire);
+    }
+    return false;
+}
+
+bool ShmFrameReader::finished() const
+{
+    return header->finished.load(std::memory_order_acquire) != 0;
+}
+
+uint64_t ShmFrameReader::getLostFrames() const
+{
+    return lost;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "io/shm/ShmRing.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief A frame copied out of the shared-memory ring buffer
+ */
+struct ShmFrame {
+    uint64_t sequence = 0; /**< Number of the frame in the ring (counted from 1) */
+    uint64_t iteration = 0; /**< The iteration the frame was written in */
+    double time = 0; /**< The simulation time of the frame */
+    std::vector<ShmParticle> particles; /**< The particles of the frame */
+};
+
+/**
+ * @brief Consumer of the shared-memory ring buffer published by the SharedMemoryWriter
+ * @details Attaches read-only to the segment and copies frames out of it. The simulation never
+ * waits for a reader: frames overwritten before they could be read are skipped and counted as
+ * lost. A new reader starts at the most recent frame.
+ */
+class ShmFrameReader {
+public:
+    /**
+     * @brief Attach to the ring buffer of a running simulation
+     * @param out_name The output name of the simulation (see shmSegmentName)
+     * @throws std::runtime_error if the segment does not exist or is not a frame ring
+     */
+    explicit ShmFrameReader(const std::string& out_name);
+
+    /**
+     * @brief Detach from the ring buffer
+     */
+    ~ShmFrameReader();
+
+    ShmFrameReader(const ShmFrameReader&) = delete;
+    ShmFrameReader& operator=(const ShmFrameReader&) = delete;
+
+    /**
+     * @brief Copy the next unread frame
+     * @param frame The frame to fill, its memory is reused
+     * @return false if there is no new frame yet, true otherwise
+     */
+    bool next(ShmFrame& frame);
+
+    /**
+     * @brief Check whether the simulation has ended, i.e. no more frames will be published
+     * @return true if the simulation has ended
+     */
+    bool finished() const;
+
+    /**
+     * @brief Get the number of frames which were overwritten before they could be read
+     * @return The number of lost frames
+     */
+    uint64_t getLostFrames() const;
+
+private:
+    ShmRingHeader* header = nullptr; /**< The mapped segment */
+    size_t size = 0; /**< The size of the mapping */
+    uint64_t nextFrame = 1; /**< The sequence number of the next frame to read */
+    uint64_t lost = 0; /**< The number of lost frames */
+};
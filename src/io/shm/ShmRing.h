@@ -0,0 +1,118 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Layout of the shared-memory frame ring buffer written by the SharedMemoryWriter
+ * @details The segment starts with a ShmRingHeader followed by slotCount slots. Frame n (counted
+ * from 1) is stored in slot (n - 1) % slotCount. Each slot consists of a ShmSlotHeader and up to
+ * slotCapacity ShmParticle records. A slot is protected by a sequence lock: its sequence is 2n - 1
+ * while frame n is written and 2n once it is complete, so readers detect frames which were
+ * overwritten while they copied them. The writer never waits for readers.
+ */
+
+/** @brief Magic number of an initialised ring ("MSHM") */
+constexpr uint32_t SHM_RING_MAGIC = 0x4d48534d;
+/** @brief Version of the ring layout */
+constexpr uint32_t SHM_RING_VERSION = 2;
+
+static_assert(
+    std::atomic<uint64_t>::is_always_lock_free, "shared-memory ring needs lock-free atomics");
+
+/**
+ * @brief Header at the start of the shared-memory segment
+ */
+struct ShmRingHeader {
+    std::atomic<uint32_t> magic; /**< SHM_RING_MAGIC once the ring is initialised */
+    uint32_t version; /**< SHM_RING_VERSION */
+    uint32_t slotCount; /**< Number of frame slots */
+    std::atomic<uint32_t> finished; /**< Set to 1 when the simulation has ended */
+    uint64_t slotCapacity; /**< Maximum number of particles per frame */
+    std::atomic<uint64_t> published; /**< Number of completely written frames */
+    int32_t producer; /**< Process id of the simulation writing the ring */
+};
+
+/**
+ * @brief Header of a frame slot
+ */
+struct alignas(64) ShmSlotHeader {
+    std::atomic<uint64_t> sequence; /**< Sequence lock, see the layout description */
+    uint64_t iteration; /**< The iteration the frame was written in */
+    double time; /**< The simulation time of the frame */
+    uint64_t particleCount; /**< The number of particles in the frame */
+};
+
+/**
+ * @brief Particle record of a frame
+ */
+struct ShmParticle {
+    double x[3]; /**< Position */
+    double v[3]; /**< Velocity */
+    uint64_t id; /**< Id of the particle */
+    int32_t type; /**< Type of the particle */
+    int32_t reserved; /**< Padding */
+};
+
+/**
+ * @brief Get the size of one slot in bytes
+ * @param capacity The maximum number of particles per frame
+ * @return The size of the slot
+ */
+inline size_t shmSlotSize(uint64_t capacity)
+{
+    return sizeof(ShmSlotHeader) + capacity * sizeof(ShmParticle);
+}
+
+/**
+ * @brief Get the size of the whole segment in bytes
+ * @param slotCount The number of slots
+ * @param capacity The maximum number of particles per frame
+ * @return The size of the segment
+ */
+inline size_t shmSegmentSize(uint32_t slotCount, uint64_t capacity)
+{
+    return sizeof(ShmSlotHeader) + slotCount * shmSlotSize(capacity);
+}
+
+/**
+ * @brief Get the header of a slot
+ * @param header The header of the mapped segment
+ * @param slot The index of the slot
+ * @return The slot header, followed by the particle records
+ */
+inline ShmSlotHeader* shmSlot(ShmRingHeader* header, uint64_t slot)
+{
+    // the ring header is padded to one slot header, which keeps all slots 64 byte aligned
+    auto* base = reinterpret_cast<char*>(header) + sizeof(ShmSlotHeader);
+    return reinterpret_cast<ShmSlotHeader*>(base + slot * shmSlotSize(header->slotCapacity));
+}
+
+/**
+ * @brief Get the particle records of a slot
+ * @param slot The slot header
+ * @return The first particle record
+ */
+inline ShmParticle* shmParticles(ShmSlotHeader* slot)
+{
+    return reinterpret_cast<ShmParticle*>(slot + 1);
+}
+
+/**
+ * @brief Get the name of the shared-memory segment for an output name
+ * @param out_name The output name of the simulation
+ * @return The POSIX shared-memory name ("/molsim_" followed by the output name without slashes)
+ */
+inline std::string shmSegmentName(const std::string& out_name)
+{
+    std::string name = "/molsim_" + out_name;
+    for (size_t i = 1; i < name.size(); ++i) {
+        if (name[i] == '/')
+            name[i] = '_';
+    }
+    return name;
+}
+
+static_assert(sizeof(ShmRingHeader) <= sizeof(ShmSlotHeader), "ring header must fit the padding");
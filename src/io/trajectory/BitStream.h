@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Writes values with arbitrary bit widths into a byte buffer (MSB first)
+ */
+class BitWriter {
+public:
+    /**
+     * @brief Append the lowest bits of a value
+     * @param value The value to write
+     * @param bits The number of bits to write (at most 64)
+     */
+    inline void write(uint64_t value, unsigned bits)
+    {
+        if (bits > 32) {
+            write(value >> 32, bits - 32);
+            write(value & 0xffffffffull, 32);
+            return;
+        }
+        // at most 7 bits are pending, so 32 more always fit into the accumulator
+        accumulator = (accumulator << bits) | (value & mask(bits));
+        pending += bits;
+        while (pending >= 8) {
+            pending -= 8;
+            buffer.push_back(static_cast<uint8_t>(accumulator >> pending));
+        }
+        accumulator &= mask(pending);
+    }
+
+    /**
+     * @brief Append a value in unary code i.e. value ones followed by a zero
+     * @param value The value to write
+     */
+    inline void writeUnary(uint64_t value)
+    {
+        while (value >= 32) {
+            write(0xffffffffull, 32);
+            value -= 32;
+        }
+        write(mask(value) << 1, value + 1);
+    }
+
+    /**
+     * @brief Flush the pending bits (padded with zeros) and return the buffer
+     * @return The written bytes
+     */
+    inline const std::vector<uint8_t>& finish()
+    {
+        if (pending)
+            buffer.push_back(static_cast<uint8_t>(accumulator << (8 - pending)));
+        pending = 0;
+        accumulator = 0;
+        return buffer;
+    }
+
+    /**
+     * @brief Get a mask with the lowest bits set
+     * @param bits The number of bits to set
+     * @return The mask
+     */
+    static inline uint64_t mask(unsigned bits) { return bits >= 64 ? ~0ull : (1ull << bits) - 1; }
+
+private:
+    std::vector<uint8_t> buffer; /**< The bytes written so far */
+    uint64_t accumulator = 0; /**< Bits which do not fill a byte yet */
+    unsigned pending = 0; /**< Number of valid bits in the accumulator */
+};
+
+/**
+ * @brief Reads values written by a BitWriter
+ */
+class BitReader {
+public:
+    /**
+     * @brief Construct a reader over a byte buffer
+     * @param data The buffer to read from (must outlive the reader)
+     * @param size The size of the buffer in bytes
+     */
+    BitReader(const uint8_t* data, size_t size)
+        : data(data)
+        , size(size)
+    {
+    }
+
+    /**
+     * @brief Read a value of the given bit width
+     * @param bits The number of bits to read (at most 64)
+     * @return The value
+     * @throws std::runtime_error if the buffer is exhausted
+     */
+    inline uint64_t read(unsigned bits)
+    {
+        if (bits > 32) {
+            uint64_t high = read(bits - 32);
+            return (high << 32) | read(32);
+        }
+        while (available < bits) {
+            if (position >= size)
+                throw std::runtime_error("Unexpected end of compressed trajectory data");
+            accumulator = (accumulator << 8) | data[position++];
+            available += 8;
+        }
+        available -= bits;
+        uint64_t value = (accumulator >> available) & BitWriter::mask(bits);
+        accumulator &= BitWriter::mask(available);
+        return value;
+    }
+
+    /**
+     * @brief Read a unary coded value, stopping early after limit ones
+     * @param limit The maximum number of ones to consume
+     * @return The number of ones read
+     */
+    inline uint64_t readUnary(uint64_t limit)
+    {
+        uint64_t value = 0;
+        while (value < limit && read(1))
+            ++value;
+        return value;
+    }
+
+private:
+    const uint8_t* data; /**< The buffer to read from */
+    size_t size; /**< The size of the buffer */
+    size_t position = 0; /**< The next byte to load */
+    uint64_t accumulator = 0; /**< Loaded but not yet consumed bits */
+    unsigned available = 0; /**< Number of valid bits in the accumulator */
+};
@@ -0,0 +1,250 @@
+#include "io/trajectory/TrajectoryCodec.h"
+#include "io/trajectory/BitStream.h"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace trajectory {
+
+namespace {
+
+/** @brief Number of bits used to store the Rice parameter of a channel */
+constexpr unsigned RICE_PARAMETER_BITS = 6;
+/** @brief Quotients of this size or larger are escaped and written raw */
+constexpr uint64_t RICE_ESCAPE = 24;
+
+/**
+ * @brief Map signed deltas to unsigned values so small magnitudes get small codes
+ */
+inline uint64_t zigzag(uint64_t delta)
+{
+    return (delta << 1) ^ static_cast<uint64_t>(static_cast<int64_t>(delta) >> 63);
+}
+
+/**
+ * @brief Inverse of zigzag
+ */
+inline uint64_t unzigzag(uint64_t symbol)
+{
+    return (symbol >> 1) ^ (~(symbol & 1) + 1);
+}
+
+/**
+ * @brief Quantise a value to an integer multiple of the precision
+ */
+inline int64_t quantise(double value, double precision)
+{
+    double scaled = std::round(value / precision);
+    if (!(std::abs(scaled) < 9.0e18))
+        throw std::invalid_argument("Value " + std::to_string(value)
+            + " cannot be quantised with the trajectory precision");
+    return static_cast<int64_t>(scaled);
+}
+
+/**
+ * @brief Delta code, zigzag map and Rice code a channel of quantised values
+ * @details Deltas are computed in unsigned arithmetic, so they wrap around instead of overflowing.
+ */
+void encodeChannel(BitWriter& bits, const std::vector<int64_t>& values)
+{
+    std::vector<uint64_t> symbols(values.size());
+    uint64_t previous = 0;
+    double mean = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        auto current = static_cast<uint64_t>(values[i]);
+        symbols[i] = zigzag(current - previous);
+        previous = current;
+        mean += static_cast<double>(symbols[i]);
+    }
+    if (!values.empty())
+        mean /= static_cast<double>(values.size());
+
+    // the optimal Rice parameter is close to log2 of the mean symbol
+    unsigned k = 0;
+    while (k < 63 && std::ldexp(1.0, static_cast<int>(k) + 1) <= mean)
+        ++k;
+    bits.write(k, RICE_PARAMETER_BITS);
+
+    for (uint64_t symbol : symbols) {
+        uint64_t quotient = symbol >> k;
+        if (quotient < RICE_ESCAPE) {
+            bits.writeUnary(quotient);
+            bits.write(symbol, k);
+        } else {
+            bits.write(BitWriter::mask(RICE_ESCAPE), RICE_ESCAPE);
+            bits.write(symbol, 64);
+        }
+    }
+}
+
+/**
+ * @brief Inverse of encodeChannel
+ */
+void decodeChannel(BitReader& bits, std::vector<int64_t>& values)
+{
+    auto k = static_cast<unsigned>(bits.read(RICE_PARAMETER_BITS));
+    uint64_t previous = 0;
+    for (auto& value : values) {
+        uint64_t quotient = bits.readUnary(RICE_ESCAPE);
+        uint64_t symbol = quotient == RICE_ESCAPE ? bits.read(64) : (quotient << k) | bits.read(k);
+        previous += unzigzag(symbol);
+        value = static_cast<int64_t>(previous);
+    }
+}
+
+/**
+ * @brief Encode the three components of a vector field
+ */
+void encodeVectors(
+    BitWriter& bits, const std::vector<std::array<double, 3>>& vectors, double precision)
+{
+    std::vector<int64_t> values(vectors.size());
+    for (size_t d = 0; d < 3; ++d) {
+        for (size_t i = 0; i < vectors.size(); ++i)
+            values[i] = quantise(vectors[i][d], precision);
+        encodeChannel(bits, values);
+    }
+}
+
+/**
+ * @brief Decode the three components of a vector field
+ */
+void decodeVectors(BitReader& bits, std::vector<std::array<double, 3>>& vectors, double precision)
+{
+    std::vector<int64_t> values(vectors.size());
+    for (size_t d = 0; d < 3; ++d) {
+        decodeChannel(bits, values);
+        for (size_t i = 0; i < vectors.size(); ++i)
+            vectors[i][d] = static_cast<double>(values[i]) * precision;
+    }
+}
+
+template <typename T>
+inline void writeRaw(std::ostream& out, const T& value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+inline void readRaw(std::istream& in, T& value)
+{
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    if (in.gcount() != sizeof(T))
+        throw std::runtime_error("Truncated trajectory frame header");
+}
+
+/**
+ * @brief Get the bytes left in a stream, the maximum if the stream cannot seek
+ */
+uint64_t remainingBytes(std::istream& in)
+{
+    const std::streampos position = in.tellg();
+    if (position < 0)
+        return std::numeric_limits<uint64_t>::max();
+    in.seekg(0, std::ios::end);
+    const std::streampos end = in.tellg();
+    in.seekg(position);
+    return end < position ? 0 : static_cast<uint64_t>(end - position);
+}
+
+} // namespace
+
+void writeHeader(std::ostream& out)
+{
+    writeRaw(out, TRAJ_FILE_MAGIC);
+    writeRaw(out, TRAJ_VERSION);
+}
+
+void readHeader(std::istream& in)
+{
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    readRaw(in, magic);
+    readRaw(in, version);
+    if (magic != TRAJ_FILE_MAGIC)
+        throw std::runtime_error("Not a MolSim trajectory file");
+    if (version != TRAJ_VERSION)
+        throw std::runtime_error("Unsupported trajectory version " + std::to_string(version));
+}
+
+void writeFrame(std::ostream& out, const TrajectoryFrame& frame)
+{
+    const size_t count = frame.positions.size();
+    if (!(frame.positionPrecision > 0) || !(frame.velocityPrecision > 0))
+        throw std::invalid_argument("Trajectory precision has to be positive");
+    if ((frame.flags & TRAJ_VELOCITIES) && frame.velocities.size() != count)
+        throw std::invalid_argument("Trajectory frame has a wrong number of velocities");
+    if ((frame.flags & TRAJ_TYPES) && frame.types.size() != count)
+        throw std::invalid_argument("Trajectory frame has a wrong number of types");
+
+    BitWriter bits;
+    encodeVectors(bits, frame.positions, frame.positionPrecision);
+    if (frame.flags & TRAJ_VELOCITIES)
+        encodeVectors(bits, frame.velocities, frame.velocityPrecision);
+    if (frame.flags & TRAJ_TYPES)
+        encodeChannel(bits, std::vector<int64_t>(frame.types.begin(), frame.types.end()));
+    const auto& payload = bits.finish();
+
+    writeRaw(out, TRAJ_FRAME_MAGIC);
+    writeRaw(out, static_cast<uint64_t>(payload.size()));
+    writeRaw(out, static_cast<uint32_t>(frame.iteration));
+    writeRaw(out, frame.time);
+    writeRaw(out, static_cast<uint64_t>(count));
+    writeRaw(out, frame.flags);
+    writeRaw(out, frame.positionPrecision);
+    writeRaw(out, frame.velocityPrecision);
+    out.write(reinterpret_cast<const char*>(payload.data()),
+        static_cast<std::streamsize>(payload.size()));
+}
+
+bool readFrame(std::istream& in, TrajectoryFrame& frame)
+{
+    uint32_t magic = 0;
+    in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    if (in.gcount() == 0 && in.eof())
+        return false;
+    if (in.gcount() != sizeof(magic) || magic != TRAJ_FRAME_MAGIC)
+        throw std::runtime_error("Corrupted trajectory frame");
+
+    uint64_t payloadSize = 0;
+    uint32_t iteration = 0;
+    uint64_t count = 0;
+    readRaw(in, payloadSize);
+    readRaw(in, iteration);
+    readRaw(in, frame.time);
+    readRaw(in, count);
+    readRaw(in, frame.flags);
+    readRaw(in, frame.positionPrecision);
+    readRaw(in, frame.velocityPrecision);
+    frame.iteration = iteration;
+
+    // corrupted sizes must not allocate more than the file holds
+    if (payloadSize > remainingBytes(in))
+        throw std::runtime_error("Truncated trajectory frame");
+    // every coordinate of a position takes at least one bit
+    if (count / 8 * 3 > payloadSize)
+        throw std::runtime_error("Corrupted trajectory frame");
+
+    std::vector<uint8_t> payload(payloadSize);
+    in.read(reinterpret_cast<char*>(payload.data()), static_cast<std::streamsize>(payloadSize));
+    if (static_cast<uint64_t>(in.gcount()) != payloadSize)
+        throw std::runtime_error("Truncated trajectory frame");
+
+    BitReader bits(payload.data(), payload.size());
+    frame.clear();
+    frame.positions.resize(count);
+    decodeVectors(bits, frame.positions, frame.positionPrecision);
+    if (frame.flags & TRAJ_VELOCITIES) {
+        frame.velocities.resize(count);
+        decodeVectors(bits, frame.velocities, frame.velocityPrecision);
+    }
+    if (frame.flags & TRAJ_TYPES) {
+        std::vector<int64_t> types(count);
+        decodeChannel(bits, types);
+        frame.types.assign(types.begin(), types.end());
+    }
+    return true;
+}
+
+} // namespace trajectory
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "io/trajectory/TrajectoryFrame.h"
+#include <iostream>
+
+/**
+ * @brief Encoding and decoding of compressed trajectory frames
+ * @details Inspired by the XTC format: positions (and optionally velocities) are quantised to
+ * integers with a fixed precision, delta coded against the previously written particle and the
+ * zigzag mapped deltas are written with an adaptive Rice code (one parameter per component). As
+ * neighbouring particles are close in space most deltas are small, so a coordinate typically costs
+ * a few bits instead of 64. Types are delta coded as well.
+ *
+ * Layout of a file:
+ *  - header: TRAJ_FILE_MAGIC (u32), TRAJ_VERSION (u32)
+ *  - frames: TRAJ_FRAME_MAGIC (u32), payload size (u64), iteration (u32), time (f64),
+ *    particle count (u64), flags (u8), position precision (f64), velocity precision (f64),
+ *    followed by the bit stream payload
+ *
+ * All fixed size fields are stored in host byte order.
+ */
+namespace trajectory {
+
+/**
+ * @brief Write the file header
+ * @param out The stream to write to
+ */
+void writeHeader(std::ostream& out);
+
+/**
+ * @brief Read and check the file header
+ * @param in The stream to read from
+ * @throws std::runtime_error if the stream is not a trajectory of a supported version
+ */
+void readHeader(std::istream& in);
+
+/**
+ * @brief Compress a frame and append it to the stream
+ * @param out The stream to write to
+ * @param frame The frame to write, the vectors selected by its flags must have the same size
+ */
+void writeFrame(std::ostream& out, const TrajectoryFrame& frame);
+
+/**
+ * @brief Read and decompress the next frame of the stream
+ * @param in The stream to read from
+ * @param frame The frame to fill
+ * @return false if the end of the stream was reached before the frame, true otherwise
+ * @throws std::runtime_error if the frame is corrupted or truncated
+ */
+bool readFrame(std::istream& in, TrajectoryFrame& frame);
+
+} // namespace trajectory
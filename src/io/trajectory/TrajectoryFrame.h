@@ -0,0 +1,43 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/** @brief Magic number at the start of every trajectory file ("MTRJ") */
+constexpr uint32_t TRAJ_FILE_MAGIC = 0x4a52544d;
+/** @brief Magic number at the start of every frame ("MTRF") */
+constexpr uint32_t TRAJ_FRAME_MAGIC = 0x4652544d;
+/** @brief Version of the trajectory format written by this code base */
+constexpr uint32_t TRAJ_VERSION = 1;
+
+/**
+ * @brief Flags describing which optional fields are stored in a frame
+ */
+enum TrajectoryFlags : uint8_t { TRAJ_VELOCITIES = 1, TRAJ_TYPES = 2 };
+
+/**
+ * @brief One decoded (or to be encoded) frame of a compressed trajectory
+ * @details Positions and velocities are quantised to the given precision when encoded, so a
+ * decoded frame reproduces the original values up to half of the precision.
+ */
+struct TrajectoryFrame {
+    unsigned iteration = 0; /**< The iteration the frame was written in */
+    double time = 0; /**< The simulation time the frame was written at */
+    double positionPrecision = 1e-3; /**< The quantisation step of the positions */
+    double velocityPrecision = 1e-3; /**< The quantisation step of the velocities */
+    uint8_t flags = 0; /**< Combination of TrajectoryFlags */
+    std::vector<std::array<double, 3>> positions; /**< The particle positions */
+    std::vector<std::array<double, 3>> velocities; /**< The velocities (if TRAJ_VELOCITIES) */
+    std::vector<int> types; /**< The particle types (if TRAJ_TYPES) */
+
+    /**
+     * @brief Remove all particle data, but keep the allocated memory for the next frame
+     */
+    inline void clear()
+    {
+        positions.clear();
+        velocities.clear();
+        types.clear();
+    }
+};
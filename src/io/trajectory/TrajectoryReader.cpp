@@ -0,0 +1,16 @@
+#include "io/trajectory/TrajectoryReader.h"
+#include "io/trajectory/TrajectoryCodec.h"
+#include <stdexcept>
+
+TrajectoryReader::TrajectoryReader(const std::string& filename)
+    : file(filename, std::ios::binary)
+{
+    if (!file.is_open())
+        throw std::runtime_error("Could not open trajectory file " + filename);
+    trajectory::readHeader(file);
+}
+
+bool TrajectoryReader::readFrame(TrajectoryFrame& frame)
+{
+    return trajectory::readFrame(file, frame);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "io/trajectory/TrajectoryFrame.h"
+#include <fstream>
+#include <string>
+
+/**
+ * @brief Sequential reader for trajectories written by the TrajectoryWriter
+ */
+class TrajectoryReader {
+public:
+    /**
+     * @brief Open a trajectory file and check its header
+     * @param filename The name of the trajectory file
+     * @throws std::runtime_error if the file cannot be opened or is not a trajectory
+     */
+    explicit TrajectoryReader(const std::string& filename);
+
+    /**
+     * @brief Decode the next frame of the trajectory
+     * @param frame The frame to fill, its memory is reused
+     * @return false if all frames have been read, true otherwise
+     * @throws std::runtime_error if the frame is corrupted or truncated
+     */
+    bool readFrame(TrajectoryFrame& frame);
+
+private:
+    /**
+     * @brief The opened trajectory file
+     */
+    std::ifstream file;
+};
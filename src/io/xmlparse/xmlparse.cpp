@@ -51,6 +51,50 @@ void xmlparse(Params& sim_params, std::string& filename)
             sim_params.gravity = params.gravity().get();
         if (params.analysisFreq().present())
             sim_params.analysisInterval = params.analysisFreq().get();
+        if (params.trajPrecision().present())
+            sim_params.traj_precision = params.trajPrecision().get();
+        if (params.trajVelPrecision().present())
+            sim_params.traj_velocity_precision = params.trajVelPrecision().get();
+        if (params.trajVelocities().present())
+            sim_params.traj_velocities = params.trajVelocities().get();
+        if (params.trajTypes().present())
+            sim_params.traj_types = params.trajTypes().get();
+        if (params.outputFields().present()
+            && !sim_params.output_filter.setFields(params.outputFields().get())) {
+            spdlog::error("Unknown output field in {}", params.outputFields().get());
+            exit(EXIT_FAILURE);
+        }
+        if (params.outputTypes().present()
+            && !sim_params.output_filter.setTypes(params.outputTypes().get())) {
+            spdlog::error("Invalid output types {}", params.outputTypes().get());
+            exit(EXIT_FAILURE);
+        }
+        if (params.shmSlots().present())
+            sim_params.shm_slots = params.shmSlots().get();
+        if (params.snapshots().present())
+            sim_params.snapshots = params.snapshots().get();
+        if (params.cellLoad().present())
+            sim_params.cell_load = params.cellLoad().get();
+        if (params.metricsFile().present())
+            sim_params.metrics_file = params.metricsFile().get();
+        if (params.metricsInterval().present())
+            sim_params.metrics_interval = params.metricsInterval().get();
+        if (params.memoryReport().present())
+            sim_params.memory_report = params.memoryReport().get();
+        if (params.respaSteps().present())
+            sim_params.setRespaSteps(params.respaSteps().get());
+        if (params.cellSizeFactor().present())
+            sim_params.setCellSizeFactor(params.cellSizeFactor().get());
+        if (params.outputStride().present())
+            sim_params.output_filter.stride = params.outputStride().get();
+        if (params.outputRegionMin().present())
+            sim_params.output_filter.regionMin = { params.outputRegionMin().get().x(),
+                                                   params.outputRegionMin().get().y(),
+                                                   params.outputRegionMin().get().z() };
+        if (params.outputRegionMax().present())
+            sim_params.output_filter.regionMax = { params.outputRegionMax().get().x(),
+                                                   params.outputRegionMax().get().y(),
+                                                   params.outputRegionMax().get().z() };
         if (params.boundaries().present()) {
             if (params.boundaries().get().bound_four().size()) {
                 sim_params.boundaryConfig = BoundaryConfig(
@@ -107,6 +151,14 @@ void xmlparse(Params& sim_params, std::string& filename)
                     typeID,
                     sigma,
                     epsilon);
+                if (type.cutoff().present()) {
+                    if (type.cutoff().get() <= 0) {
+                        spdlog::error("The cutoff of particle type {} must be positive", typeID);
+                        exit(EXIT_FAILURE);
+                    }
+                    sim_params.typeCutoffs[typeID] = type.cutoff().get();
+                    spdlog::info("Particle type {} has the cutoff {}", typeID, type.cutoff().get());
+                }
                 // Add immobile particle types
                 if (type.immobile().present()) {
                     if (type.immobile().get()) {
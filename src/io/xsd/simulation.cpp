@@ -683,6 +683,30 @@ immobile (const immobile_optional& x)
   this->immobile_ = x;
 }
 
+const ParticleType_t::cutoff_optional& ParticleType_t::
+cutoff () const
+{
+  return this->cutoff_;
+}
+
+ParticleType_t::cutoff_optional& ParticleType_t::
+cutoff ()
+{
+  return this->cutoff_;
+}
+
+void ParticleType_t::
+cutoff (const cutoff_type& x)
+{
+  this->cutoff_.set (x);
+}
+
+void ParticleType_t::
+cutoff (const cutoff_optional& x)
+{
+  this->cutoff_ = x;
+}
+
 
 // ParticleTypeAttr_t
 //
@@ -1771,6 +1795,444 @@ analysisFreq (const analysisFreq_optional& x)
   this->analysisFreq_ = x;
 }
 
+const params_t::trajPrecision_optional& params_t::
+trajPrecision () const
+{
+  return this->trajPrecision_;
+}
+
+params_t::trajPrecision_optional& params_t::
+trajPrecision ()
+{
+  return this->trajPrecision_;
+}
+
+void params_t::
+trajPrecision (const trajPrecision_type& x)
+{
+  this->trajPrecision_.set (x);
+}
+
+void params_t::
+trajPrecision (const trajPrecision_optional& x)
+{
+  this->trajPrecision_ = x;
+}
+
+const params_t::trajVelPrecision_optional& params_t::
+trajVelPrecision () const
+{
+  return this->trajVelPrecision_;
+}
+
+params_t::trajVelPrecision_optional& params_t::
+trajVelPrecision ()
+{
+  return this->trajVelPrecision_;
+}
+
+void params_t::
+trajVelPrecision (const trajVelPrecision_type& x)
+{
+  this->trajVelPrecision_.set (x);
+}
+
+void params_t::
+trajVelPrecision (const trajVelPrecision_optional& x)
+{
+  this->trajVelPrecision_ = x;
+}
+
+const params_t::trajVelocities_optional& params_t::
+trajVelocities () const
+{
+  return this->trajVelocities_;
+}
+
+params_t::trajVelocities_optional& params_t::
+trajVelocities ()
+{
+  return this->trajVelocities_;
+}
+
+void params_t::
+trajVelocities (const trajVelocities_type& x)
+{
+  this->trajVelocities_.set (x);
+}
+
+void params_t::
+trajVelocities (const trajVelocities_optional& x)
+{
+  this->trajVelocities_ = x;
+}
+
+const params_t::trajTypes_optional& params_t::
+trajTypes () const
+{
+  return this->trajTypes_;
+}
+
+params_t::trajTypes_optional& params_t::
+trajTypes ()
+{
+  return this->trajTypes_;
+}
+
+void params_t::
+trajTypes (const trajTypes_type& x)
+{
+  this->trajTypes_.set (x);
+}
+
+void params_t::
+trajTypes (const trajTypes_optional& x)
+{
+  this->trajTypes_ = x;
+}
+
+const params_t::outputFields_optional& params_t::
+outputFields () const
+{
+  return this->outputFields_;
+}
+
+params_t::outputFields_optional& params_t::
+outputFields ()
+{
+  return this->outputFields_;
+}
+
+void params_t::
+outputFields (const outputFields_type& x)
+{
+  this->outputFields_.set (x);
+}
+
+void params_t::
+outputFields (const outputFields_optional& x)
+{
+  this->outputFields_ = x;
+}
+
+void params_t::
+outputFields (::std::unique_ptr< outputFields_type > x)
+{
+  this->outputFields_.set (std::move (x));
+}
+
+const params_t::outputTypes_optional& params_t::
+outputTypes () const
+{
+  return this->outputTypes_;
+}
+
+params_t::outputTypes_optional& params_t::
+outputTypes ()
+{
+  return this->outputTypes_;
+}
+
+void params_t::
+outputTypes (const outputTypes_type& x)
+{
+  this->outputTypes_.set (x);
+}
+
+void params_t::
+outputTypes (const outputTypes_optional& x)
+{
+  this->outputTypes_ = x;
+}
+
+void params_t::
+outputTypes (::std::unique_ptr< outputTypes_type > x)
+{
+  this->outputTypes_.set (std::move (x));
+}
+
+const params_t::outputStride_optional& params_t::
+outputStride () const
+{
+  return this->outputStride_;
+}
+
+params_t::outputStride_optional& params_t::
+outputStride ()
+{
+  return this->outputStride_;
+}
+
+void params_t::
+outputStride (const outputStride_type& x)
+{
+  this->outputStride_.set (x);
+}
+
+void params_t::
+outputStride (const outputStride_optional& x)
+{
+  this->outputStride_ = x;
+}
+
+const params_t::outputRegionMin_optional& params_t::
+outputRegionMin () const
+{
+  return this->outputRegionMin_;
+}
+
+params_t::outputRegionMin_optional& params_t::
+outputRegionMin ()
+{
+  return this->outputRegionMin_;
+}
+
+void params_t::
+outputRegionMin (const outputRegionMin_type& x)
+{
+  this->outputRegionMin_.set (x);
+}
+
+void params_t::
+outputRegionMin (const outputRegionMin_optional& x)
+{
+  this->outputRegionMin_ = x;
+}
+
+void params_t::
+outputRegionMin (::std::unique_ptr< outputRegionMin_type > x)
+{
+  this->outputRegionMin_.set (std::move (x));
+}
+
+const params_t::outputRegionMax_optional& params_t::
+outputRegionMax () const
+{
+  return this->outputRegionMax_;
+}
+
+params_t::outputRegionMax_optional& params_t::
+outputRegionMax ()
+{
+  return this->outputRegionMax_;
+}
+
+void params_t::
+outputRegionMax (const outputRegionMax_type& x)
+{
+  this->outputRegionMax_.set (x);
+}
+
+void params_t::
+outputRegionMax (const outputRegionMax_optional& x)
+{
+  this->outputRegionMax_ = x;
+}
+
+void params_t::
+outputRegionMax (::std::unique_ptr< outputRegionMax_type > x)
+{
+  this->outputRegionMax_.set (std::move (x));
+}
+
+const params_t::snapshots_optional& params_t::
+snapshots () const
+{
+  return this->snapshots_;
+}
+
+params_t::snapshots_optional& params_t::
+snapshots ()
+{
+  return this->snapshots_;
+}
+
+void params_t::
+snapshots (const snapshots_type& x)
+{
+  this->snapshots_.set (x);
+}
+
+void params_t::
+snapshots (const snapshots_optional& x)
+{
+  this->snapshots_ = x;
+}
+
+const params_t::shmSlots_optional& params_t::
+shmSlots () const
+{
+  return this->shmSlots_;
+}
+
+params_t::shmSlots_optional& params_t::
+shmSlots ()
+{
+  return this->shmSlots_;
+}
+
+void params_t::
+shmSlots (const shmSlots_type& x)
+{
+  this->shmSlots_.set (x);
+}
+
+void params_t::
+shmSlots (const shmSlots_optional& x)
+{
+  this->shmSlots_ = x;
+}
+
+const params_t::cellLoad_optional& params_t::
+cellLoad () const
+{
+  return this->cellLoad_;
+}
+
+params_t::cellLoad_optional& params_t::
+cellLoad ()
+{
+  return this->cellLoad_;
+}
+
+void params_t::
+cellLoad (const cellLoad_type& x)
+{
+  this->cellLoad_.set (x);
+}
+
+void params_t::
+cellLoad (const cellLoad_optional& x)
+{
+  this->cellLoad_ = x;
+}
+
+const params_t::metricsFile_optional& params_t::
+metricsFile () const
+{
+  return this->metricsFile_;
+}
+
+params_t::metricsFile_optional& params_t::
+metricsFile ()
+{
+  return this->metricsFile_;
+}
+
+void params_t::
+metricsFile (const metricsFile_type& x)
+{
+  this->metricsFile_.set (x);
+}
+
+void params_t::
+metricsFile (const metricsFile_optional& x)
+{
+  this->metricsFile_ = x;
+}
+
+void params_t::
+metricsFile (::std::unique_ptr< metricsFile_type > x)
+{
+  this->metricsFile_.set (std::move (x));
+}
+
+const params_t::metricsInterval_optional& params_t::
+metricsInterval () const
+{
+  return this->metricsInterval_;
+}
+
+params_t::metricsInterval_optional& params_t::
+metricsInterval ()
+{
+  return this->metricsInterval_;
+}
+
+void params_t::
+metricsInterval (const metricsInterval_type& x)
+{
+  this->metricsInterval_.set (x);
+}
+
+void params_t::
+metricsInterval (const metricsInterval_optional& x)
+{
+  this->metricsInterval_ = x;
+}
+
+const params_t::memoryReport_optional& params_t::
+memoryReport () const
+{
+  return this->memoryReport_;
+}
+
+params_t::memoryReport_optional& params_t::
+memoryReport ()
+{
+  return this->memoryReport_;
+}
+
+void params_t::
+memoryReport (const memoryReport_type& x)
+{
+  this->memoryReport_.set (x);
+}
+
+void params_t::
+memoryReport (const memoryReport_optional& x)
+{
+  this->memoryReport_ = x;
+}
+
+const params_t::respaSteps_optional& params_t::
+respaSteps () const
+{
+  return this->respaSteps_;
+}
+
+params_t::respaSteps_optional& params_t::
+respaSteps ()
+{
+  return this->respaSteps_;
+}
+
+void params_t::
+respaSteps (const respaSteps_type& x)
+{
+  this->respaSteps_.set (x);
+}
+
+void params_t::
+respaSteps (const respaSteps_optional& x)
+{
+  this->respaSteps_ = x;
+}
+
+const params_t::cellSizeFactor_optional& params_t::
+cellSizeFactor () const
+{
+  return this->cellSizeFactor_;
+}
+
+params_t::cellSizeFactor_optional& params_t::
+cellSizeFactor ()
+{
+  return this->cellSizeFactor_;
+}
+
+void params_t::
+cellSizeFactor (const cellSizeFactor_type& x)
+{
+  this->cellSizeFactor_.set (x);
+}
+
+void params_t::
+cellSizeFactor (const cellSizeFactor_optional& x)
+{
+  this->cellSizeFactor_ = x;
+}
+
 
 // simulation_t
 //
@@ -3005,7 +3467,8 @@ ParticleType_t (const sigma_type& sigma,
 : ::xml_schema::type (),
   sigma_ (sigma, this),
   epsilon_ (epsilon, this),
-  immobile_ (this)
+  immobile_ (this),
+  cutoff_ (this)
 {
 }
 
@@ -3016,7 +3479,8 @@ ParticleType_t (const ParticleType_t& x,
 : ::xml_schema::type (x, f, c),
   sigma_ (x.sigma_, f, this),
   epsilon_ (x.epsilon_, f, this),
-  immobile_ (x.immobile_, f, this)
+  immobile_ (x.immobile_, f, this),
+  cutoff_ (x.cutoff_, f, this)
 {
 }
 
@@ -3027,7 +3491,8 @@ ParticleType_t (const ::xercesc::DOMElement& e,
 : ::xml_schema::type (e, f | ::xml_schema::flags::base, c),
   sigma_ (this),
   epsilon_ (this),
-  immobile_ (this)
+  immobile_ (this),
+  cutoff_ (this)
 {
   if ((f & ::xml_schema::flags::base) == 0)
   {
@@ -3079,6 +3544,17 @@ parse (::xsd::cxx::xml::dom::parser< char >& p,
       }
     }
 
+    // cutoff
+    //
+    if (n.name () == "cutoff" && n.namespace_ ().empty ())
+    {
+      if (!this->cutoff_)
+      {
+        this->cutoff_.set (cutoff_traits::create (i, f, this));
+        continue;
+      }
+    }
+
     break;
   }
 
@@ -3113,6 +3589,7 @@ operator= (const ParticleType_t& x)
     this->sigma_ = x.sigma_;
     this->epsilon_ = x.epsilon_;
     this->immobile_ = x.immobile_;
+    this->cutoff_ = x.cutoff_;
   }
 
   return *this;
@@ -4388,7 +4865,24 @@ params_t ()
   boundaries_ (this),
   thermostat_ (this),
   gravity_ (this),
-  analysisFreq_ (this)
+  analysisFreq_ (this),
+  trajPrecision_ (this),
+  trajVelPrecision_ (this),
+  trajVelocities_ (this),
+  trajTypes_ (this),
+  outputFields_ (this),
+  outputTypes_ (this),
+  outputStride_ (this),
+  outputRegionMin_ (this),
+  outputRegionMax_ (this),
+  snapshots_ (this),
+  shmSlots_ (this),
+  cellLoad_ (this),
+  metricsFile_ (this),
+  metricsInterval_ (this),
+  memoryReport_ (this),
+  respaSteps_ (this),
+  cellSizeFactor_ (this)
 {
 }
 
@@ -4411,7 +4905,24 @@ params_t (const params_t& x,
   boundaries_ (x.boundaries_, f, this),
   thermostat_ (x.thermostat_, f, this),
   gravity_ (x.gravity_, f, this),
-  analysisFreq_ (x.analysisFreq_, f, this)
+  analysisFreq_ (x.analysisFreq_, f, this),
+  trajPrecision_ (x.trajPrecision_, f, this),
+  trajVelPrecision_ (x.trajVelPrecision_, f, this),
+  trajVelocities_ (x.trajVelocities_, f, this),
+  trajTypes_ (x.trajTypes_, f, this),
+  outputFields_ (x.outputFields_, f, this),
+  outputTypes_ (x.outputTypes_, f, this),
+  outputStride_ (x.outputStride_, f, this),
+  outputRegionMin_ (x.outputRegionMin_, f, this),
+  outputRegionMax_ (x.outputRegionMax_, f, this),
+  snapshots_ (x.snapshots_, f, this),
+  shmSlots_ (x.shmSlots_, f, this),
+  cellLoad_ (x.cellLoad_, f, this),
+  metricsFile_ (x.metricsFile_, f, this),
+  metricsInterval_ (x.metricsInterval_, f, this),
+  memoryReport_ (x.memoryReport_, f, this),
+  respaSteps_ (x.respaSteps_, f, this),
+  cellSizeFactor_ (x.cellSizeFactor_, f, this)
 {
 }
 
@@ -4434,7 +4945,24 @@ params_t (const ::xercesc::DOMElement& e,
   boundaries_ (this),
   thermostat_ (this),
   gravity_ (this),
-  analysisFreq_ (this)
+  analysisFreq_ (this),
+  trajPrecision_ (this),
+  trajVelPrecision_ (this),
+  trajVelocities_ (this),
+  trajTypes_ (this),
+  outputFields_ (this),
+  outputTypes_ (this),
+  outputStride_ (this),
+  outputRegionMin_ (this),
+  outputRegionMax_ (this),
+  snapshots_ (this),
+  shmSlots_ (this),
+  cellLoad_ (this),
+  metricsFile_ (this),
+  metricsInterval_ (this),
+  memoryReport_ (this),
+  respaSteps_ (this),
+  cellSizeFactor_ (this)
 {
   if ((f & ::xml_schema::flags::base) == 0)
   {
@@ -4443,192 +4971,394 @@ params_t (const ::xercesc::DOMElement& e,
   }
 }
 
-void params_t::
-parse (::xsd::cxx::xml::dom::parser< char >& p,
-       ::xml_schema::flags f)
-{
-  for (; p.more_content (); p.next_content (false))
-  {
-    const ::xercesc::DOMElement& i (p.cur_element ());
-    const ::xsd::cxx::xml::qualified_name< char > n (
-      ::xsd::cxx::xml::dom::name< char > (i));
+void params_t::
+parse (::xsd::cxx::xml::dom::parser< char >& p,
+       ::xml_schema::flags f)
+{
+  for (; p.more_content (); p.next_content (false))
+  {
+    const ::xercesc::DOMElement& i (p.cur_element ());
+    const ::xsd::cxx::xml::qualified_name< char > n (
+      ::xsd::cxx::xml::dom::name< char > (i));
+
+    // start_time
+    //
+    if (n.name () == "start_time" && n.namespace_ ().empty ())
+    {
+      if (!this->start_time_)
+      {
+        this->start_time_.set (start_time_traits::create (i, f, this));
+        continue;
+      }
+    }
+
+    // delta_t
+    //
+    if (n.name () == "delta_t" && n.namespace_ ().empty ())
+    {
+      if (!this->delta_t_)
+      {
+        this->delta_t_.set (delta_t_traits::create (i, f, this));
+        continue;
+      }
+    }
+
+    // end_time
+    //
+    if (n.name () == "end_time" && n.namespace_ ().empty ())
+    {
+      if (!this->end_time_)
+      {
+        this->end_time_.set (end_time_traits::create (i, f, this));
+        continue;
+      }
+    }
+
+    // epsilon
+    //
+    if (n.name () == "epsilon" && n.namespace_ ().empty ())
+    {
+      if (!this->epsilon_)
+      {
+        this->epsilon_.set (epsilon_traits::create (i, f, this));
+        continue;
+      }
+    }
+
+    // sigma
+    //
+    if (n.name () == "sigma" && n.namespace_ ().empty ())
+    {
+      if (!this->sigma_)
+      {
+        this->sigma_.set (sigma_traits::create (i, f, this));
+        continue;
+      }
+    }
+
+    // output
+    //
+    if (n.name () == "output" && n.namespace_ ().empty ())
+    {
+      ::std::unique_ptr< output_type > r (
+        output_traits::create (i, f, this));
+
+      if (!this->output_)
+      {
+        this->output_.set (::std::move (r));
+        continue;
+      }
+    }
+
+    // frequency
+    //
+    if (n.name () == "frequency" && n.namespace_ ().empty ())
+    {
+      if (!this->frequency_)
+      {
+        this->frequency_.set (frequency_traits::create (i, f, this));
+        continue;
+      }
+    }
+
+    // domainOrigin
+    //
+    if (n.name () == "domainOrigin" && n.namespace_ ().empty ())
+    {
+      ::std::unique_ptr< domainOrigin_type > r (
+        domainOrigin_traits::create (i, f, this));
+
+      if (!this->domainOrigin_)
+      {
+        this->domainOrigin_.set (::std::move (r));
+        continue;
+      }
+    }
+
+    // domainSize
+    //
+    if (n.name () == "domainSize" && n.namespace_ ().empty ())
+    {
+      ::std::unique_ptr< domainSize_type > r (
+        domainSize_traits::create (i, f, this));
+
+      if (!this->domainSize_)
+      {
+        this->domainSize_.set (::std::move (r));
+        continue;
+      }
+    }
+
+    // cutoff
+    //
+    if (n.name () == "cutoff" && n.namespace_ ().empty ())
+    {
+      if (!this->cutoff_)
+      {
+        this->cutoff_.set (cutoff_traits::create (i, f, this));
+        continue;
+      }
+    }
+
+    // updateFreq
+    //
+    if (n.name () == "updateFreq" && n.namespace_ ().empty ())
+    {
+      if (!this->updateFreq_)
+      {
+        this->updateFreq_.set (updateFreq_traits::create (i, f, this));
+        continue;
+      }
+    }
+
+    // boundaries
+    //
+    if (n.name () == "boundaries" && n.namespace_ ().empty ())
+    {
+      ::std::unique_ptr< boundaries_type > r (
+        boundaries_traits::create (i, f, this));
+
+      if (!this->boundaries_)
+      {
+        this->boundaries_.set (::std::move (r));
+        continue;
+      }
+    }
+
+    // thermostat
+    //
+    if (n.name () == "thermostat" && n.namespace_ ().empty ())
+    {
+      ::std::unique_ptr< thermostat_type > r (
+        thermostat_traits::create (i, f, this));
+
+      if (!this->thermostat_)
+      {
+        this->thermostat_.set (::std::move (r));
+        continue;
+      }
+    }
+
+    // gravity
+    //
+    if (n.name () == "gravity" && n.namespace_ ().empty ())
+    {
+      if (!this->gravity_)
+      {
+        this->gravity_.set (gravity_traits::create (i, f, this));
+        continue;
+      }
+    }
+
+    // analysisFreq
+    //
+    if (n.name () == "analysisFreq" && n.namespace_ ().empty ())
+    {
+      if (!this->analysisFreq_)
+      {
+        this->analysisFreq_.set (analysisFreq_traits::create (i, f, this));
+        continue;
+      }
+    }
 
-    // start_time
+    // trajPrecision
     //
-    if (n.name () == "start_time" && n.namespace_ ().empty ())
+    if (n.name () == "trajPrecision" && n.namespace_ ().empty ())
     {
-      if (!this->start_time_)
+      if (!this->trajPrecision_)
       {
-        this->start_time_.set (start_time_traits::create (i, f, this));
+        this->trajPrecision_.set (trajPrecision_traits::create (i, f, this));
         continue;
       }
     }
 
-    // delta_t
+    // trajVelPrecision
     //
-    if (n.name () == "delta_t" && n.namespace_ ().empty ())
+    if (n.name () == "trajVelPrecision" && n.namespace_ ().empty ())
     {
-      if (!this->delta_t_)
+      if (!this->trajVelPrecision_)
       {
-        this->delta_t_.set (delta_t_traits::create (i, f, this));
+        this->trajVelPrecision_.set (trajVelPrecision_traits::create (i, f, this));
         continue;
       }
     }
 
-    // end_time
+    // trajVelocities
     //
-    if (n.name () == "end_time" && n.namespace_ ().empty ())
+    if (n.name () == "trajVelocities" && n.namespace_ ().empty ())
     {
-      if (!this->end_time_)
+      if (!this->trajVelocities_)
       {
-        this->end_time_.set (end_time_traits::create (i, f, this));
+        this->trajVelocities_.set (trajVelocities_traits::create (i, f, this));
         continue;
       }
     }
 
-    // epsilon
+    // trajTypes
     //
-    if (n.name () == "epsilon" && n.namespace_ ().empty ())
+    if (n.name () == "trajTypes" && n.namespace_ ().empty ())
     {
-      if (!this->epsilon_)
+      if (!this->trajTypes_)
       {
-        this->epsilon_.set (epsilon_traits::create (i, f, this));
+        this->trajTypes_.set (trajTypes_traits::create (i, f, this));
         continue;
       }
     }
 
-    // sigma
+    // outputFields
     //
-    if (n.name () == "sigma" && n.namespace_ ().empty ())
+    if (n.name () == "outputFields" && n.namespace_ ().empty ())
     {
-      if (!this->sigma_)
+      ::std::unique_ptr< outputFields_type > r (
+        outputFields_traits::create (i, f, this));
+
+      if (!this->outputFields_)
       {
-        this->sigma_.set (sigma_traits::create (i, f, this));
+        this->outputFields_.set (::std::move (r));
         continue;
       }
     }
 
-    // output
+    // outputTypes
     //
-    if (n.name () == "output" && n.namespace_ ().empty ())
+    if (n.name () == "outputTypes" && n.namespace_ ().empty ())
     {
-      ::std::unique_ptr< output_type > r (
-        output_traits::create (i, f, this));
+      ::std::unique_ptr< outputTypes_type > r (
+        outputTypes_traits::create (i, f, this));
 
-      if (!this->output_)
+      if (!this->outputTypes_)
       {
-        this->output_.set (::std::move (r));
+        this->outputTypes_.set (::std::move (r));
         continue;
       }
     }
 
-    // frequency
+    // outputStride
     //
-    if (n.name () == "frequency" && n.namespace_ ().empty ())
+    if (n.name () == "outputStride" && n.namespace_ ().empty ())
     {
-      if (!this->frequency_)
+      if (!this->outputStride_)
       {
-        this->frequency_.set (frequency_traits::create (i, f, this));
+        this->outputStride_.set (outputStride_traits::create (i, f, this));
         continue;
       }
     }
 
-    // domainOrigin
+    // outputRegionMin
     //
-    if (n.name () == "domainOrigin" && n.namespace_ ().empty ())
+    if (n.name () == "outputRegionMin" && n.namespace_ ().empty ())
     {
-      ::std::unique_ptr< domainOrigin_type > r (
-        domainOrigin_traits::create (i, f, this));
+      ::std::unique_ptr< outputRegionMin_type > r (
+        outputRegionMin_traits::create (i, f, this));
 
-      if (!this->domainOrigin_)
+      if (!this->outputRegionMin_)
       {
-        this->domainOrigin_.set (::std::move (r));
+        this->outputRegionMin_.set (::std::move (r));
         continue;
       }
     }
 
-    // domainSize
+    // outputRegionMax
     //
-    if (n.name () == "domainSize" && n.namespace_ ().empty ())
+    if (n.name () == "outputRegionMax" && n.namespace_ ().empty ())
     {
-      ::std::unique_ptr< domainSize_type > r (
-        domainSize_traits::create (i, f, this));
+      ::std::unique_ptr< outputRegionMax_type > r (
+        outputRegionMax_traits::create (i, f, this));
 
-      if (!this->domainSize_)
+      if (!this->outputRegionMax_)
       {
-        this->domainSize_.set (::std::move (r));
+        this->outputRegionMax_.set (::std::move (r));
         continue;
       }
     }
 
-    // cutoff
+    // snapshots
     //
-    if (n.name () == "cutoff" && n.namespace_ ().empty ())
+    if (n.name () == "snapshots" && n.namespace_ ().empty ())
     {
-      if (!this->cutoff_)
+      if (!this->snapshots_)
       {
-        this->cutoff_.set (cutoff_traits::create (i, f, this));
+        this->snapshots_.set (snapshots_traits::create (i, f, this));
         continue;
       }
     }
 
-    // updateFreq
+    // shmSlots
     //
-    if (n.name () == "updateFreq" && n.namespace_ ().empty ())
+    if (n.name () == "shmSlots" && n.namespace_ ().empty ())
     {
-      if (!this->updateFreq_)
+      if (!this->shmSlots_)
       {
-        this->updateFreq_.set (updateFreq_traits::create (i, f, this));
+        this->shmSlots_.set (shmSlots_traits::create (i, f, this));
         continue;
       }
     }
 
-    // boundaries
+    // cellLoad
     //
-    if (n.name () == "boundaries" && n.namespace_ ().empty ())
+    if (n.name () == "cellLoad" && n.namespace_ ().empty ())
     {
-      ::std::unique_ptr< boundaries_type > r (
-        boundaries_traits::create (i, f, this));
+      if (!this->cellLoad_)
+      {
+        this->cellLoad_.set (cellLoad_traits::create (i, f, this));
+        continue;
+      }
+    }
 
-      if (!this->boundaries_)
+    // metricsFile
+    //
+    if (n.name () == "metricsFile" && n.namespace_ ().empty ())
+    {
+      ::std::unique_ptr< metricsFile_type > r (
+        metricsFile_traits::create (i, f, this));
+
+      if (!this->metricsFile_)
       {
-        this->boundaries_.set (::std::move (r));
+        this->metricsFile_.set (::std::move (r));
         continue;
       }
     }
 
-    // thermostat
+    // metricsInterval
     //
-    if (n.name () == "thermostat" && n.namespace_ ().empty ())
+    if (n.name () == "metricsInterval" && n.namespace_ ().empty ())
     {
-      ::std::unique_ptr< thermostat_type > r (
-        thermostat_traits::create (i, f, this));
+      if (!this->metricsInterval_)
+      {
+        this->metricsInterval_.set (metricsInterval_traits::create (i, f, this));
+        continue;
+      }
+    }
 
-      if (!this->thermostat_)
+    // memoryReport
+    //
+    if (n.name () == "memoryReport" && n.namespace_ ().empty ())
+    {
+      if (!this->memoryReport_)
       {
-        this->thermostat_.set (::std::move (r));
+        this->memoryReport_.set (memoryReport_traits::create (i, f, this));
         continue;
       }
     }
 
-    // gravity
+    // respaSteps
     //
-    if (n.name () == "gravity" && n.namespace_ ().empty ())
+    if (n.name () == "respaSteps" && n.namespace_ ().empty ())
     {
-      if (!this->gravity_)
+      if (!this->respaSteps_)
       {
-        this->gravity_.set (gravity_traits::create (i, f, this));
+        this->respaSteps_.set (respaSteps_traits::create (i, f, this));
         continue;
       }
     }
 
-    // analysisFreq
+    // cellSizeFactor
     //
-    if (n.name () == "analysisFreq" && n.namespace_ ().empty ())
+    if (n.name () == "cellSizeFactor" && n.namespace_ ().empty ())
     {
-      if (!this->analysisFreq_)
+      if (!this->cellSizeFactor_)
       {
-        this->analysisFreq_.set (analysisFreq_traits::create (i, f, this));
+        this->cellSizeFactor_.set (cellSizeFactor_traits::create (i, f, this));
         continue;
       }
     }
@@ -4665,6 +5395,23 @@ operator= (const params_t& x)
     this->thermostat_ = x.thermostat_;
     this->gravity_ = x.gravity_;
     this->analysisFreq_ = x.analysisFreq_;
+    this->trajPrecision_ = x.trajPrecision_;
+    this->trajVelPrecision_ = x.trajVelPrecision_;
+    this->trajVelocities_ = x.trajVelocities_;
+    this->trajTypes_ = x.trajTypes_;
+    this->outputFields_ = x.outputFields_;
+    this->outputTypes_ = x.outputTypes_;
+    this->outputStride_ = x.outputStride_;
+    this->outputRegionMin_ = x.outputRegionMin_;
+    this->outputRegionMax_ = x.outputRegionMax_;
+    this->snapshots_ = x.snapshots_;
+    this->shmSlots_ = x.shmSlots_;
+    this->cellLoad_ = x.cellLoad_;
+    this->metricsFile_ = x.metricsFile_;
+    this->metricsInterval_ = x.metricsInterval_;
+    this->memoryReport_ = x.memoryReport_;
+    this->respaSteps_ = x.respaSteps_;
+    this->cellSizeFactor_ = x.cellSizeFactor_;
   }
 
   return *this;
@@ -5518,6 +6265,18 @@ operator<< (::xercesc::DOMElement& e, const ParticleType_t& i)
 
     s << *i.immobile ();
   }
+
+  // cutoff
+  //
+  if (i.cutoff ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "cutoff",
+        e));
+
+    s << ::xml_schema::as_double(*i.cutoff ());
+  }
 }
 
 void
@@ -6121,6 +6880,210 @@ operator<< (::xercesc::DOMElement& e, const params_t& i)
 
     s << *i.analysisFreq ();
   }
+
+  // trajPrecision
+  //
+  if (i.trajPrecision ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "trajPrecision",
+        e));
+
+    s << ::xml_schema::as_double(*i.trajPrecision ());
+  }
+
+  // trajVelPrecision
+  //
+  if (i.trajVelPrecision ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "trajVelPrecision",
+        e));
+
+    s << ::xml_schema::as_double(*i.trajVelPrecision ());
+  }
+
+  // trajVelocities
+  //
+  if (i.trajVelocities ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "trajVelocities",
+        e));
+
+    s << *i.trajVelocities ();
+  }
+
+  // trajTypes
+  //
+  if (i.trajTypes ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "trajTypes",
+        e));
+
+    s << *i.trajTypes ();
+  }
+
+  // outputFields
+  //
+  if (i.outputFields ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "outputFields",
+        e));
+
+    s << *i.outputFields ();
+  }
+
+  // outputTypes
+  //
+  if (i.outputTypes ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "outputTypes",
+        e));
+
+    s << *i.outputTypes ();
+  }
+
+  // outputStride
+  //
+  if (i.outputStride ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "outputStride",
+        e));
+
+    s << *i.outputStride ();
+  }
+
+  // outputRegionMin
+  //
+  if (i.outputRegionMin ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "outputRegionMin",
+        e));
+
+    s << *i.outputRegionMin ();
+  }
+
+  // outputRegionMax
+  //
+  if (i.outputRegionMax ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "outputRegionMax",
+        e));
+
+    s << *i.outputRegionMax ();
+  }
+
+  // snapshots
+  //
+  if (i.snapshots ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "snapshots",
+        e));
+
+    s << *i.snapshots ();
+  }
+
+  // shmSlots
+  //
+  if (i.shmSlots ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "shmSlots",
+        e));
+
+    s << *i.shmSlots ();
+  }
+
+  // cellLoad
+  //
+  if (i.cellLoad ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "cellLoad",
+        e));
+
+    s << *i.cellLoad ();
+  }
+
+  // metricsFile
+  //
+  if (i.metricsFile ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "metricsFile",
+        e));
+
+    s << *i.metricsFile ();
+  }
+
+  // metricsInterval
+  //
+  if (i.metricsInterval ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "metricsInterval",
+        e));
+
+    s << ::xml_schema::as_double(*i.metricsInterval ());
+  }
+
+  // memoryReport
+  //
+  if (i.memoryReport ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "memoryReport",
+        e));
+
+    s << *i.memoryReport ();
+  }
+
+  // respaSteps
+  //
+  if (i.respaSteps ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "respaSteps",
+        e));
+
+    s << *i.respaSteps ();
+  }
+
+  // cellSizeFactor
+  //
+  if (i.cellSizeFactor ())
+  {
+    ::xercesc::DOMElement& s (
+      ::xsd::cxx::xml::dom::create_element (
+        "cellSizeFactor",
+        e));
+
+    s << ::xml_schema::as_double(*i.cellSizeFactor ());
+  }
 }
 
 void
@@ -3134,6 +3134,71 @@ class ParticleType_t: public ::xml_schema::type
 
   //@}
 
+  /**
+   * @name cutoff
+   *
+   * @brief Accessor and modifier functions for the %cutoff
+   * optional element.
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::xml_schema::double_ cutoff_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< cutoff_type > cutoff_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< cutoff_type, char, ::xsd::cxx::tree::schema_type::double_ > cutoff_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const cutoff_optional&
+  cutoff () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  cutoff_optional&
+  cutoff ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  cutoff (const cutoff_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy 
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  cutoff (const cutoff_optional& x);
+
+  //@}
+
   /**
    * @name Constructors
    */
@@ -3219,6 +3284,7 @@ class ParticleType_t: public ::xml_schema::type
   ::xsd::cxx::tree::one< sigma_type > sigma_;
   ::xsd::cxx::tree::one< epsilon_type > epsilon_;
   immobile_optional immobile_;
+  cutoff_optional cutoff_;
 
   //@endcond
 };
@@ -6881,6 +6947,1202 @@ class params_t: public ::xml_schema::type
 
   //@}
 
+  /**
+   * @name trajPrecision
+   *
+   * @brief Accessor and modifier functions for the %trajPrecision
+   * optional element.
+   *
+   * Quantisation step of the positions in the compressed trajectory
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::xml_schema::double_ trajPrecision_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< trajPrecision_type > trajPrecision_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< trajPrecision_type, char, ::xsd::cxx::tree::schema_type::double_ > trajPrecision_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const trajPrecision_optional&
+  trajPrecision () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  trajPrecision_optional&
+  trajPrecision ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  trajPrecision (const trajPrecision_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  trajPrecision (const trajPrecision_optional& x);
+
+  //@}
+
+  /**
+   * @name trajVelPrecision
+   *
+   * @brief Accessor and modifier functions for the %trajVelPrecision
+   * optional element.
+   *
+   * Quantisation step of the velocities in the compressed trajectory
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::xml_schema::double_ trajVelPrecision_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< trajVelPrecision_type > trajVelPrecision_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< trajVelPrecision_type, char, ::xsd::cxx::tree::schema_type::double_ > trajVelPrecision_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const trajVelPrecision_optional&
+  trajVelPrecision () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  trajVelPrecision_optional&
+  trajVelPrecision ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  trajVelPrecision (const trajVelPrecision_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  trajVelPrecision (const trajVelPrecision_optional& x);
+
+  //@}
+
+  /**
+   * @name trajVelocities
+   *
+   * @brief Accessor and modifier functions for the %trajVelocities
+   * optional element.
+   *
+   * Whether to store the velocities in the compressed trajectory
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::xml_schema::boolean trajVelocities_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< trajVelocities_type > trajVelocities_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< trajVelocities_type, char > trajVelocities_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const trajVelocities_optional&
+  trajVelocities () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  trajVelocities_optional&
+  trajVelocities ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  trajVelocities (const trajVelocities_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  trajVelocities (const trajVelocities_optional& x);
+
+  //@}
+
+  /**
+   * @name trajTypes
+   *
+   * @brief Accessor and modifier functions for the %trajTypes
+   * optional element.
+   *
+   * Whether to store the particle types in the compressed trajectory
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::xml_schema::boolean trajTypes_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< trajTypes_type > trajTypes_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< trajTypes_type, char > trajTypes_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const trajTypes_optional&
+  trajTypes () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  trajTypes_optional&
+  trajTypes ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  trajTypes (const trajTypes_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  trajTypes (const trajTypes_optional& x);
+
+  //@}
+
+  /**
+   * @name outputFields
+   *
+   * @brief Accessor and modifier functions for the %outputFields
+   * optional element.
+   *
+   * Comma separated fields to write in addition to the positions (mass, velocity, force, type, all or none)
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::xml_schema::string outputFields_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< outputFields_type > outputFields_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< outputFields_type, char > outputFields_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const outputFields_optional&
+  outputFields () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  outputFields_optional&
+  outputFields ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  outputFields (const outputFields_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  outputFields (const outputFields_optional& x);
+
+  /**
+   * @brief Set the element value without copying.
+   *
+   * @param p A new value to use.
+   *
+   * This function will try to use the passed value directly instead
+   * of making a copy.
+   */
+  void
+  outputFields (::std::unique_ptr< outputFields_type > p);
+
+  //@}
+
+  /**
+   * @name outputTypes
+   *
+   * @brief Accessor and modifier functions for the %outputTypes
+   * optional element.
+   *
+   * Comma separated particle types to write (all types if empty)
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::xml_schema::string outputTypes_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< outputTypes_type > outputTypes_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< outputTypes_type, char > outputTypes_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const outputTypes_optional&
+  outputTypes () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  outputTypes_optional&
+  outputTypes ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  outputTypes (const outputTypes_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  outputTypes (const outputTypes_optional& x);
+
+  /**
+   * @brief Set the element value without copying.
+   *
+   * @param p A new value to use.
+   *
+   * This function will try to use the passed value directly instead
+   * of making a copy.
+   */
+  void
+  outputTypes (::std::unique_ptr< outputTypes_type > p);
+
+  //@}
+
+  /**
+   * @name outputStride
+   *
+   * @brief Accessor and modifier functions for the %outputStride
+   * optional element.
+   *
+   * Only write every k-th particle (selected by id)
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::xml_schema::unsigned_int outputStride_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< outputStride_type > outputStride_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< outputStride_type, char > outputStride_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const outputStride_optional&
+  outputStride () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  outputStride_optional&
+  outputStride ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  outputStride (const outputStride_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  outputStride (const outputStride_optional& x);
+
+  //@}
+
+  /**
+   * @name outputRegionMin
+   *
+   * @brief Accessor and modifier functions for the %outputRegionMin
+   * optional element.
+   *
+   * Lower corner of the region of particles to write
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::doubleVec_t outputRegionMin_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< outputRegionMin_type > outputRegionMin_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< outputRegionMin_type, char > outputRegionMin_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const outputRegionMin_optional&
+  outputRegionMin () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  outputRegionMin_optional&
+  outputRegionMin ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  outputRegionMin (const outputRegionMin_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  outputRegionMin (const outputRegionMin_optional& x);
+
+  /**
+   * @brief Set the element value without copying.
+   *
+   * @param p A new value to use.
+   *
+   * This function will try to use the passed value directly instead
+   * of making a copy.
+   */
+  void
+  outputRegionMin (::std::unique_ptr< outputRegionMin_type > p);
+
+  //@}
+
+  /**
+   * @name outputRegionMax
+   *
+   * @brief Accessor and modifier functions for the %outputRegionMax
+   * optional element.
+   *
+   * Upper corner of the region of particles to write
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::doubleVec_t outputRegionMax_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< outputRegionMax_type > outputRegionMax_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< outputRegionMax_type, char > outputRegionMax_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const outputRegionMax_optional&
+  outputRegionMax () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  outputRegionMax_optional&
+  outputRegionMax ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  outputRegionMax (const outputRegionMax_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  outputRegionMax (const outputRegionMax_optional& x);
+
+  /**
+   * @brief Set the element value without copying.
+   *
+   * @param p A new value to use.
+   *
+   * This function will try to use the passed value directly instead
+   * of making a copy.
+   */
+  void
+  outputRegionMax (::std::unique_ptr< outputRegionMax_type > p);
+
+  //@}
+
+  /**
+   * @name snapshots
+   *
+   * @brief Accessor and modifier functions for the %snapshots
+   * optional element.
+   *
+   * Maximum number of forked processes writing output concurrently (0 writes in the simulation process)
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::xml_schema::unsigned_int snapshots_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< snapshots_type > snapshots_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< snapshots_type, char > snapshots_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const snapshots_optional&
+  snapshots () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  snapshots_optional&
+  snapshots ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  snapshots (const snapshots_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  snapshots (const snapshots_optional& x);
+
+  //@}
+
+  /**
+   * @name shmSlots
+   *
+   * @brief Accessor and modifier functions for the %shmSlots
+   * optional element.
+   *
+   * Number of frames kept in the shared-memory ring buffer
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::xml_schema::unsigned_int shmSlots_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< shmSlots_type > shmSlots_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< shmSlots_type, char > shmSlots_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const shmSlots_optional&
+  shmSlots () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  shmSlots_optional&
+  shmSlots ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  shmSlots (const shmSlots_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  shmSlots (const shmSlots_optional& x);
+
+  //@}
+
+  /**
+   * @name cellLoad
+   *
+   * @brief Accessor and modifier functions for the %cellLoad
+   * optional element.
+   *
+   * Write the particle count, pair checks, interactions and force time of every linked cell as VTK image data next to the particle output
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::xml_schema::boolean cellLoad_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< cellLoad_type > cellLoad_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< cellLoad_type, char > cellLoad_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const cellLoad_optional&
+  cellLoad () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  cellLoad_optional&
+  cellLoad ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  cellLoad (const cellLoad_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  cellLoad (const cellLoad_optional& x);
+
+  //@}
+
+  /**
+   * @name metricsFile
+   *
+   * @brief Accessor and modifier functions for the %metricsFile
+   * optional element.
+   *
+   * File to periodically write live metrics to in the Prometheus text format
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::xml_schema::string metricsFile_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< metricsFile_type > metricsFile_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< metricsFile_type, char > metricsFile_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const metricsFile_optional&
+  metricsFile () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  metricsFile_optional&
+  metricsFile ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  metricsFile (const metricsFile_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  metricsFile (const metricsFile_optional& x);
+
+  /**
+   * @brief Set the element value without copying.
+   *
+   * @param p A new value to use.
+   *
+   * This function will try to use the passed value directly instead
+   * of making a copy.
+   */
+  void
+  metricsFile (::std::unique_ptr< metricsFile_type > p);
+
+  //@}
+
+  /**
+   * @name metricsInterval
+   *
+   * @brief Accessor and modifier functions for the %metricsInterval
+   * optional element.
+   *
+   * Minimum number of seconds between two metrics exports
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::xml_schema::double_ metricsInterval_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< metricsInterval_type > metricsInterval_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< metricsInterval_type, char, ::xsd::cxx::tree::schema_type::double_ > metricsInterval_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const metricsInterval_optional&
+  metricsInterval () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  metricsInterval_optional&
+  metricsInterval ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  metricsInterval (const metricsInterval_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  metricsInterval (const metricsInterval_optional& x);
+
+  //@}
+
+  /**
+   * @name memoryReport
+   *
+   * @brief Accessor and modifier functions for the %memoryReport
+   * optional element.
+   *
+   * Account the memory of the data structures and report its peak and steady state
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::xml_schema::boolean memoryReport_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< memoryReport_type > memoryReport_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< memoryReport_type, char > memoryReport_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const memoryReport_optional&
+  memoryReport () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  memoryReport_optional&
+  memoryReport ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  memoryReport (const memoryReport_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  memoryReport (const memoryReport_optional& x);
+
+  //@}
+
+  /**
+   * @name respaSteps
+   *
+   * @brief Accessor and modifier functions for the %respaSteps
+   * optional element.
+   *
+   * Number of inner steps integrating the bonded membrane forces per time step of the
+   * non-bonded forces (r-RESPA), 1 integrates all forces with the time step
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::xml_schema::unsigned_int respaSteps_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< respaSteps_type > respaSteps_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< respaSteps_type, char > respaSteps_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const respaSteps_optional&
+  respaSteps () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  respaSteps_optional&
+  respaSteps ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  respaSteps (const respaSteps_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  respaSteps (const respaSteps_optional& x);
+
+  //@}
+
+  /**
+   * @name cellSizeFactor
+   *
+   * @brief Accessor and modifier functions for the %cellSizeFactor
+   * optional element.
+   *
+   * Size of the cells of the force calculation relative to the cutoff, e.g. 0.5 for
+   * cells of half the cutoff, 1 uses the cells of the grid
+   */
+  //@{
+
+  /**
+   * @brief Element type.
+   */
+  typedef ::xml_schema::double_ cellSizeFactor_type;
+
+  /**
+   * @brief Element optional container type.
+   */
+  typedef ::xsd::cxx::tree::optional< cellSizeFactor_type > cellSizeFactor_optional;
+
+  /**
+   * @brief Element traits type.
+   */
+  typedef ::xsd::cxx::tree::traits< cellSizeFactor_type, char, ::xsd::cxx::tree::schema_type::double_ > cellSizeFactor_traits;
+
+  /**
+   * @brief Return a read-only (constant) reference to the element
+   * container.
+   *
+   * @return A constant reference to the optional container.
+   */
+  const cellSizeFactor_optional&
+  cellSizeFactor () const;
+
+  /**
+   * @brief Return a read-write reference to the element container.
+   *
+   * @return A reference to the optional container.
+   */
+  cellSizeFactor_optional&
+  cellSizeFactor ();
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x A new value to set.
+   *
+   * This function makes a copy of its argument and sets it as
+   * the new value of the element.
+   */
+  void
+  cellSizeFactor (const cellSizeFactor_type& x);
+
+  /**
+   * @brief Set the element value.
+   *
+   * @param x An optional container with the new value to set.
+   *
+   * If the value is present in @a x then this function makes a copy
+   * of this value and sets it as the new value of the element.
+   * Otherwise the element container is set the 'not present' state.
+   */
+  void
+  cellSizeFactor (const cellSizeFactor_optional& x);
+
+  //@}
+
   /**
    * @name Constructors
    */
@@ -6977,6 +8239,23 @@ class params_t: public ::xml_schema::type
   thermostat_optional thermostat_;
   gravity_optional gravity_;
   analysisFreq_optional analysisFreq_;
+  trajPrecision_optional trajPrecision_;
+  trajVelPrecision_optional trajVelPrecision_;
+  trajVelocities_optional trajVelocities_;
+  trajTypes_optional trajTypes_;
+  outputFields_optional outputFields_;
+  outputTypes_optional outputTypes_;
+  outputStride_optional outputStride_;
+  outputRegionMin_optional outputRegionMin_;
+  outputRegionMax_optional outputRegionMax_;
+  snapshots_optional snapshots_;
+  shmSlots_optional shmSlots_;
+  cellLoad_optional cellLoad_;
+  metricsFile_optional metricsFile_;
+  metricsInterval_optional metricsInterval_;
+  memoryReport_optional memoryReport_;
+  respaSteps_optional respaSteps_;
+  cellSizeFactor_optional cellSizeFactor_;
 
   //@endcond
 };
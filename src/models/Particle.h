@@ -72,6 +72,11 @@ private:
      */
     size_t moleculeId;
 
+    /**
+     * @brief Read-only handle used by the writers to access the fields without locking
+     */
+    friend class ParticleRef;
+
 public:
     /**
      * @brief Construct a new Particle object with given position, velocity, mass and type
@@ -4,6 +4,7 @@
 
 #include "ParticleContainer.h"
 #include "Particle.h"
+#include "utils/NumaUtils.h"
 #include <omp.h>
 
 ParticleContainer::ParticleContainer()
@@ -14,7 +15,8 @@ ParticleContainer::ParticleContainer()
 
 ParticleContainer::ParticleContainer(const std::vector<Particle>& particles)
 {
-    this->particles = particles;
+    NumaUtils::reserveFirstTouch(this->particles, particles.size());
+    this->particles.assign(particles.begin(), particles.end());
 
     activeParticleCount = 0;
     for (auto& p : particles) {
@@ -48,11 +50,16 @@ size_t ParticleContainer::getIndex(size_t id)
     return id - std::distance(lowerBound, upperBound);
 }
 
-std::vector<Particle> ParticleContainer::getContainer() const
+const std::vector<Particle>& ParticleContainer::getContainer() const
 {
     return particles;
 }
 
+ParticleView ParticleContainer::view() const
+{
+    return { particles, static_cast<size_t>(activeParticleCount) };
+}
+
 ParticleContainer::ActiveIterator ParticleContainer::beginActive()
 {
     return { particles.begin(), particles.begin(), particles.end(), inactiveParticleMap };
@@ -6,6 +6,7 @@
 #define PARTICLECONTAINER_H
 
 #include "Particle.h"
+#include "ParticleView.h"
 #include <functional>
 #include <map>
 #include <vector>
@@ -66,9 +67,15 @@ public:
 
     /**
      * @brief Get the particles within the container
-     * @return The vector of particles
+     * @return A reference to the vector of particles (including inactive ones)
      */
-    std::vector<Particle> getContainer() const;
+    const std::vector<Particle>& getContainer() const;
+
+    /**
+     * @brief Get a read-only view of the active particles without copying them
+     * @return The view, invalidated when particles are added
+     */
+    ParticleView view() const;
 
     /**
      * @brief Forward declaration for iteration over active particles
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "models/Particle.h"
+#include <array>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Read-only handle to a particle with direct (unlocked) field access
+ * @details Writers read particles while no thread modifies them, so the accessors skip the
+ * per-particle mutex the getters of Particle lock on every call.
+ */
+class ParticleRef {
+public:
+    /**
+     * @brief Construct a handle to a particle
+     * @param p The particle, has to outlive the handle
+     */
+    ParticleRef(const Particle& p)
+        : p(&p)
+    {
+    }
+
+    /** @brief Get the position of the particle */
+    inline const std::array<double, 3>& x() const { return p->x; }
+    /** @brief Get the velocity of the particle */
+    inline const std::array<double, 3>& v() const { return p->v; }
+    /** @brief Get the force effective on the particle */
+    inline const std::array<double, 3>& f() const { return p->f; }
+    /** @brief Get the force which was effective on the particle */
+    inline const std::array<double, 3>& oldF() const { return p->old_f; }
+    /** @brief Get the mass of the particle */
+    inline double m() const { return p->m; }
+    /** @brief Get the type of the particle */
+    inline int type() const { return p->type; }
+    /** @brief Get the id of the particle */
+    inline size_t id() const { return p->id; }
+    /** @brief Get the activity status of the particle */
+    inline bool active() const { return p->active; }
+    /** @brief Get the referenced particle */
+    inline const Particle& particle() const { return *p; }
+
+private:
+    const Particle* p; /**< The referenced particle */
+};
+
+/**
+ * @brief Non-owning, read-only view of the active particles of a particle vector
+ * @details Cheap to copy (two pointers and a count), so it can be passed by value. Iteration skips
+ * inactive particles and yields ParticleRef handles.
+ */
+class ParticleView {
+public:
+    /**
+     * @brief Forward iterator over the active particles of the view
+     */
+    class Iterator {
+    public:
+        /**
+         * @brief Construct an iterator and move it to the first active particle
+         * @param current The first particle to consider
+         * @param last The end of the viewed particles
+         */
+        Iterator(const Particle* current, const Particle* last)
+            : current(current)
+            , last(last)
+        {
+            skipInactive();
+        }
+
+        /** @brief Get the current particle */
+        inline ParticleRef operator*() const { return *current; }
+
+        /** @brief Advance to the next active particle */
+        inline Iterator& operator++()
+        {
+            ++current;
+            skipInactive();
+            return *this;
+        }
+
+        /** @brief Compare the position of two iterators */
+        inline bool operator!=(const Iterator& other) const { return current != other.current; }
+
+        /** @brief Compare the position of two iterators */
+        inline bool operator==(const Iterator& other) const { return current == other.current; }
+
+    private:
+        /**
+         * @brief Skip inactive particles
+         */
+        inline void skipInactive()
+        {
+            while (current != last && !ParticleRef(*current).active())
+                ++current;
+        }
+
+        const Particle* current; /**< The current particle */
+        const Particle* last; /**< The end of the viewed particles */
+    };
+
+    /**
+     * @brief Construct a view over a vector of particles
+     * @param particles The viewed particles, must not be reallocated while the view is used
+     * @param activeCount The number of active particles in the vector
+     */
+    ParticleView(const std::vector<Particle>& particles, size_t activeCount)
+        : first(particles.data())
+        , last(particles.data() + particles.size())
+        , activeCount(activeCount)
+    {
+    }
+
+    /** @brief Get an iterator to the first active particle */
+    inline Iterator begin() const { return { first, last }; }
+
+    /** @brief Get the end iterator */
+    inline Iterator end() const { return { last, last }; }
+
+    /** @brief Get the number of active particles */
+    inline size_t size() const { return activeCount; }
+
+    /** @brief Check whether there are no active particles */
+    inline bool empty() const { return activeCount == 0; }
+
+private:
+    const Particle* first; /**< The first viewed particle */
+    const Particle* last; /**< The end of the viewed particles */
+    size_t activeCount; /**< The number of active particles */
+};
@@ -1,5 +1,6 @@
 
 #include "ParticleGenerator.h"
+#include "utils/NumaUtils.h"
 #include <spdlog/spdlog.h>
 
 ParticleGenerator::ParticleGenerator(ParticleContainer& container)
@@ -23,16 +24,19 @@ void ParticleGenerator::generateClusters()
 
     spdlog::info("Generating {} particles", totalParticles);
 
-    std::vector<Particle> particles(totalParticles);
+    // the pages of the particles are placed on the nodes of the threads that update them
+    std::vector<Particle> particles;
+    NumaUtils::reserveFirstTouch(particles, totalParticles);
+    particles.resize(totalParticles);
     size_t insertionIndex = 0;
     for (const auto& cluster : clusters) {
         cluster->generateCluster(particles, insertionIndex);
     }
 
-    // Set the particles in the container
-    container.particles = particles;
+    // Set the particles in the container, keeping their pages
+    container.particles = std::move(particles);
     // Initialize counter for active particles
-    container.activeParticleCount = static_cast<int>(particles.size());
+    container.activeParticleCount = static_cast<int>(container.particles.size());
 
     // Clear the clusters
     clusters.clear();
@@ -1,8 +1,10 @@
 
 #include "CellGrid.h"
 #include "models/ParticleContainer.h"
+#include "models/linked_cell/LoadBalancer.h"
 #include "models/linked_cell/cell/Cell.h"
 #include "utils/ArrayUtils.h"
+#include "utils/MemoryUtils.h"
 #include "utils/Position.h"
 #include <cmath>
 #include <cwchar>
@@ -20,6 +22,7 @@ CellGrid::CellGrid(
     , cellSize({ 0.0, 0.0, 0.0 })
     , domainEnd(domainOrigin + domainSize)
     , gridDimensionality((domainSize[2] == 0) ? 2 : 3)
+    , balancer(std::make_unique<LoadBalancer>())
 {
     initializeGrid();
 }
@@ -169,21 +172,48 @@ void CellGrid::initializeGrid()
         cells.at(x).resize(gridDimensions[1]);
         for (size_t y = 0; y < gridDimensions[1]; ++y) {
             cells.at(x).at(y).resize(gridDimensions[2]);
+        }
+    }
+
+    auto createColumn = [&](size_t x, size_t y) {
+        for (size_t z = 0; z < gridDimensions[2]; ++z) {
+            CellType type = determineCellType({ x, y, z });
+            // Initialize vectors for boundary and halo cells
+            std::unique_ptr<Cell> cellPointer = std::make_unique<Cell>(Cell(type, { x, y, z }));
+            // save pointer
+            cells.at(x).at(y).at(z) = std::move(cellPointer);
+            // determine neighbours
+            determineNeighbours({ x, y, z });
+            determineNeighboursStencile({ x, y, z }, gridDimensionality == 2);
+        }
+    };
+
+    // the inner columns are split like in the static force calculation, so every cell and its
+    // neighbour lists are placed on the NUMA node of the thread that calculates it. The particle
+    // references of a cell are allocated by the thread that adds the particles.
+    const size_t innerColumns = (gridDimensions[0] - 2) * (gridDimensions[1] - 2);
+#pragma omp parallel for schedule(static)
+    for (size_t column = 0; column < innerColumns; ++column) {
+        createColumn(column / (gridDimensions[1] - 2) + 1, column % (gridDimensions[1] - 2) + 1);
+    }
+    // the halo columns are not calculated
+    for (size_t x = 0; x < gridDimensions[0]; ++x) {
+        for (size_t y = 0; y < gridDimensions[1]; ++y) {
+            if (x == 0 || y == 0 || x == gridDimensions[0] - 1 || y == gridDimensions[1] - 1)
+                createColumn(x, y);
+        }
+    }
+
+    for (size_t x = 0; x < gridDimensions[0]; ++x) {
+        for (size_t y = 0; y < gridDimensions[1]; ++y) {
             for (size_t z = 0; z < gridDimensions[2]; ++z) {
-                CellType type = determineCellType({ x, y, z });
-                // Initialize vectors for boundary and halo cells
-                std::unique_ptr<Cell> cellPointer = std::make_unique<Cell>(Cell(type, { x, y, z }));
-                // save pointer
-                cells.at(x).at(y).at(z) = std::move(cellPointer);
-                // determine neighbours
-                determineNeighbours({ x, y, z });
+                CellType type = cells.at(x).at(y).at(z)->getType();
                 if (type == CellType::Boundary) {
                     boundaryCells.push_back({ x, y, z });
                 }
                 if (type == CellType::Halo) {
                     haloCells.push_back({ x, y, z });
                 }
-                determineNeighboursStencile({ x, y, z }, gridDimensionality == 2);
             }
         }
     }
@@ -255,7 +285,32 @@ void CellGrid::updateCells()
     }
 }
 
+void CellGrid::clearParticles()
+{
+    for (auto& plane : cells) {
+        for (auto& row : plane) {
+            for (auto& cell : row)
+                cell->clearParticles();
+        }
+    }
+}
+
 // Methods to get boundary and halo particle iterators
+size_t CellGrid::getMemoryBytes() const
+{
+    size_t bytes = MemoryUtils::vectorBytes(cells) + MemoryUtils::vectorBytes(boundaryCells)
+        + MemoryUtils::vectorBytes(haloCells);
+    for (const auto& plane : cells) {
+        bytes += MemoryUtils::vectorBytes(plane);
+        for (const auto& row : plane) {
+            bytes += MemoryUtils::vectorBytes(row);
+            for (const auto& cell : row)
+                bytes += cell->getMemoryBytes();
+        }
+    }
+    return bytes;
+}
+
 CellGrid::BoundaryIterator CellGrid::boundaryCellIterator(Position position) const
 {
     return { position, gridDimensions, gridDimensionality == 2 };
@@ -8,6 +8,9 @@
 #include <memory>
 #include <vector>
 
+// forward declare
+class LoadBalancer;
+
 /** @brief A 3D vector of pointers to Cells. */
 typedef std::vector<std::vector<std::vector<std::unique_ptr<Cell>>>> CellVec;
 
@@ -48,6 +51,12 @@ public:
     /// The square of the cutoff radius
     double cutoffRadiusSquared;
 
+    /// Measure the force calculation time of every cell (see CellLoadScope)
+    bool recordLoad = false;
+
+    /// Partitions the cell columns between the threads of the balanced force calculation
+    std::unique_ptr<LoadBalancer> balancer;
+
     /**
      * @brief Adds a particle to the appropriate cell in the grid.
      * @param particle The particle to be added.
@@ -105,6 +114,12 @@ public:
      */
     void updateCells();
 
+    /**
+     * @brief Removes all particles from the cell lists, e.g. before the particles of a changed
+     * container are added again.
+     */
+    void clearParticles();
+
     // Forward declaration (see bottom)
     class BoundaryIterator;
 
@@ -158,12 +173,30 @@ public:
      */
     inline std::array<size_t, 3> getGridDimensions() const { return gridDimensions; }
 
+    /**
+     * @brief Get the size of a cell
+     * @return The size of a cell in each dimension, 0 in z for 2D grids
+     */
+    inline std::array<double, 3> getCellSize() const { return cellSize; }
+
+    /**
+     * @brief Get the halo cells of all sides
+     * @return The indices of the halo cells
+     */
+    inline const std::vector<CellIndex>& getHaloCells() const { return haloCells; }
+
     /**
      * @brief Returns the cutoff radius.
      * @return The cutoff radius.
      * */
     inline double getCutoffRadius() const { return cutoffRadius; }
 
+    /**
+     * @brief Returns the heap memory of the grid.
+     * @return The bytes of all cells, their particle lists and the cell index lists.
+     */
+    [[nodiscard]] size_t getMemoryBytes() const;
+
     /**
      * @brief Returns the index of the cell containing the specified position.
      * @param pos The 3D position of the cell.
@@ -0,0 +1,431 @@
+
+#include "DomainDecomposition.h"
+#include "models/ParticleContainer.h"
+#include "models/linked_cell/CellGrid.h"
+#include "utils/MPIUtils.h"
+#include "utils/MemoryUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <spdlog/spdlog.h>
+
+namespace {
+
+/** @brief The sides of the global domain per dimension, lower side first */
+const std::array<std::array<Position, 2>, 3> sides { { { Position::LEFT, Position::RIGHT },
+                                                       { Position::BOTTOM, Position::TOP },
+                                                       { Position::BACK, Position::FRONT } } };
+
+/**
+ * @brief Get the number of cells of the global grid per dimension, as built by CellGrid
+ * @param domainSize The size of the domain
+ * @param cutoff The cutoff radius
+ * @param dimensions The dimensionality
+ * @return The cells without the halo
+ */
+std::array<size_t, 3> countCells(
+    const std::array<double, 3>& domainSize, double cutoff, size_t dimensions)
+{
+    std::array<size_t, 3> cells { 1, 1, 1 };
+    for (size_t d = 0; d < dimensions; ++d) {
+        if (domainSize[d] >= cutoff)
+            cells[d] = static_cast<size_t>(std::floor(std::abs(domainSize[d] / cutoff)));
+    }
+    return cells;
+}
+
+} // namespace
+
+DomainDecomposition::DomainDecomposition(
+    int rank,
+    int size,
+    std::array<double, 3> domainOrigin,
+    std::array<double, 3> domainSize,
+    double cutoff,
+    const BoundaryConfig& boundaryConfig,
+    std::array<int, 3> rankGrid)
+    : rank(rank)
+    , size(size)
+    , dimensions(boundaryConfig.boundaryMap.size() == 6 ? 3 : 2)
+    , rankGrid(rankGrid)
+    , coordinates({ 0, 0, 0 })
+    , domainSize(domainSize)
+    , localOrigin(domainOrigin)
+    , localSize(domainSize)
+    , localConfig(boundaryConfig)
+    , neighbors()
+    , wraps()
+{
+    const std::array<size_t, 3> cells = countCells(domainSize, cutoff, dimensions);
+    if (dimensions == 2)
+        this->rankGrid[2] = 1;
+    if (this->rankGrid[0] <= 0 || this->rankGrid[1] <= 0 || this->rankGrid[2] <= 0)
+        this->rankGrid = chooseRankGrid(size, cells, dimensions);
+    if (this->rankGrid[0] * this->rankGrid[1] * this->rankGrid[2] != size) {
+        spdlog::error("Cannot split the {}x{}x{} cells of the domain into {} ranks",
+            cells[0],
+            cells[1],
+            cells[2],
+            size);
+        exit(EXIT_FAILURE);
+    }
+    for (size_t d = 0; d < 3; ++d) {
+        if (static_cast<size_t>(this->rankGrid[d]) > cells[d]) {
+            spdlog::error("Cannot split {} cells into {} ranks", cells[d], this->rankGrid[d]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    // the ranks are numbered row-major
+    const std::array<int, 3>& grid = this->rankGrid;
+    coordinates = { rank / (grid[1] * grid[2]), rank / grid[2] % grid[1], rank % grid[2] };
+    auto rankAt = [&grid](std::array<int, 3> c) {
+        return (c[0] * grid[1] + c[1]) * grid[2] + c[2];
+    };
+
+    for (size_t d = 0; d < dimensions; ++d) {
+        // split along whole cells, so the cells of all ranks have the size of the global cells
+        const double cellSize = domainSize[d] / static_cast<double>(cells[d]);
+        const auto first = static_cast<size_t>(coordinates[d]) * cells[d] / grid[d];
+        const auto last = static_cast<size_t>(coordinates[d] + 1) * cells[d] / grid[d];
+        localOrigin[d] = domainOrigin[d] + static_cast<double>(first) * cellSize;
+        const double localEnd = coordinates[d] == grid[d] - 1
+            ? domainOrigin[d] + domainSize[d]
+            : domainOrigin[d] + static_cast<double>(last) * cellSize;
+        localSize[d] = localEnd - localOrigin[d];
+
+        for (size_t side = 0; side < 2; ++side) {
+            const Position position = sides[d][side];
+            const bool periodic =
+                boundaryConfig.boundaryMap.at(position) == BoundaryType::PERIODIC;
+            const bool atEdge = side ? coordinates[d] == grid[d] - 1 : coordinates[d] == 0;
+            std::array<int, 3> neighbor = coordinates;
+            neighbor[d] = (neighbor[d] + (side ? 1 : -1) + grid[d]) % grid[d];
+
+            wraps[d][side] = atEdge && periodic;
+            neighbors[d][side] = !atEdge || periodic ? rankAt(neighbor) : -1;
+            if (neighbors[d][side] >= 0)
+                localConfig.boundaryMap[position] = BoundaryType::RANK;
+        }
+    }
+}
+
+std::array<int, 3> DomainDecomposition::chooseRankGrid(
+    int size, const std::array<size_t, 3>& cells, size_t dimensions)
+{
+    std::array<int, 3> best { 0, 0, 0 };
+    double bestSurface = std::numeric_limits<double>::max();
+    for (int x = 1; x <= size; ++x) {
+        for (int y = 1; x * y <= size; ++y) {
+            if (size % (x * y))
+                continue;
+            const int z = size / (x * y);
+            const std::array<int, 3> grid { x, y, z };
+            if ((dimensions == 2 && z != 1) || static_cast<size_t>(x) > cells[0]
+                || static_cast<size_t>(y) > cells[1] || static_cast<size_t>(z) > cells[2])
+                continue;
+
+            // the cells on the sides of one subdomain, i.e. the halo to exchange
+            double surface = 0;
+            for (size_t d = 0; d < dimensions; ++d) {
+                double side = 1;
+                for (size_t other = 0; other < dimensions; ++other) {
+                    if (other != d)
+                        side *= static_cast<double>(cells[other]) / grid[other];
+                }
+                surface += side;
+            }
+            if (surface < bestSurface) {
+                bestSurface = surface;
+                best = grid;
+            }
+        }
+    }
+    return best;
+}
+
+void DomainDecomposition::distribute(ParticleContainer& container, const CellGrid& grid) const
+{
+    const std::array<size_t, 3> cells = grid.getGridDimensions();
+    const size_t total = container.particles.size();
+
+    // a particle belongs to this rank, if it is not in the halo of a side shared with another rank
+    auto isForeign = [&](const Particle& particle) {
+        const CellIndex index = grid.getIndexFromPos(particle.getX());
+        for (size_t d = 0; d < dimensions; ++d) {
+            if ((index[d] == 0 && neighbors[d][0] >= 0)
+                || (index[d] == cells[d] - 1 && neighbors[d][1] >= 0))
+                return true;
+        }
+        return !particle.getActivity();
+    };
+    auto& particles = container.particles;
+    particles.erase(std::remove_if(particles.begin(), particles.end(), isForeign), particles.end());
+    container.activeParticleCount = static_cast<int>(particles.size());
+    container.inactiveParticleMap.clear();
+
+    spdlog::debug("Rank {} owns {} of {} particles", rank, particles.size(), total);
+    const size_t owned = MPIUtils::sum(particles.size());
+    if (rank == 0 && owned != total)
+        spdlog::warn("{} of {} particles are outside the domain and are not simulated",
+            total - owned,
+            total);
+}
+
+void DomainDecomposition::splitCells(const CellGrid& grid)
+{
+    const std::array<size_t, 3> cells = grid.getGridDimensions();
+    interiorCells.clear();
+    boundaryCells.clear();
+
+    // a 2D grid has a single layer of cells at z = 0
+    const size_t zBegin = cells[2] == 1 ? 0 : 1;
+    const size_t zEnd = cells[2] == 1 ? 1 : cells[2] - 1;
+    for (size_t x = 1; x < cells[0] - 1; ++x) {
+        for (size_t y = 1; y < cells[1] - 1; ++y) {
+            for (size_t z = zBegin; z < zEnd; ++z) {
+                const CellIndex index { x, y, z };
+                bool boundary = false;
+                for (size_t d = 0; d < dimensions; ++d) {
+                    if ((index[d] == 1 && neighbors[d][0] >= 0)
+                        || (index[d] == cells[d] - 2 && neighbors[d][1] >= 0))
+                        boundary = true;
+                }
+                (boundary ? boundaryCells : interiorCells).push_back(index);
+            }
+        }
+    }
+}
+
+void DomainDecomposition::exchangeGhosts(CellGrid& grid)
+{
+    const std::array<size_t, 3> cells = grid.getGridDimensions();
+    size_t insertionIndex = 0;
+
+    // dimension by dimension, so the halos filled before are forwarded into edges and corners
+    for (size_t d = 0; d < dimensions; ++d) {
+        if (neighbors[d][0] < 0 && neighbors[d][1] < 0)
+            continue;
+
+        std::array<std::vector<GhostRecord>, 2> send;
+        for (size_t side = 0; side < 2; ++side) {
+            if (neighbors[d][side] < 0)
+                continue;
+            const double shift = getShift(d, side);
+            CellIndex index {};
+            index[d] = side ? cells[d] - 2 : 1;
+            const size_t a = (d + 1) % 3;
+            const size_t b = (d + 2) % 3;
+            for (index[a] = 0; index[a] < cells[a]; ++index[a]) {
+                for (index[b] = 0; index[b] < cells[b]; ++index[b]) {
+                    // the halo of a reflecting or outflow side of the global domain is not periodic
+                    bool skip = false;
+                    for (size_t other = 0; other < dimensions && wraps[d][side]; ++other) {
+                        if (other != d
+                            && ((index[other] == 0 && neighbors[other][0] < 0)
+                                || (index[other] == cells[other] - 1 && neighbors[other][1] < 0)))
+                            skip = true;
+                    }
+                    if (skip)
+                        continue;
+
+                    auto& cell = grid.cells[index[0]][index[1]][index[2]];
+                    for (auto& particle : cell->getParticles()) {
+                        GhostRecord record { particle.get().getX(),
+                                             particle.get().getM(),
+                                             particle.get().getType(),
+                                             { static_cast<unsigned>(index[0]),
+                                               static_cast<unsigned>(index[1]),
+                                               static_cast<unsigned>(index[2]) } };
+                        record.x[d] += shift;
+                        send[side].push_back(record);
+                    }
+                }
+            }
+        }
+
+        std::array<std::vector<GhostRecord>, 2> received;
+        exchange(d, send[0], send[1], received[0], received[1]);
+
+        for (size_t side = 0; side < 2; ++side) {
+            for (const GhostRecord& record : received[side]) {
+                CellIndex index { record.cell[0], record.cell[1], record.cell[2] };
+                index[d] = side ? cells[d] - 1 : 0;
+
+                if (insertionIndex < ghosts.size()) {
+                    // simply update, if there is already a particle to reuse
+                    ghosts[insertionIndex]->setX(record.x);
+                    ghosts[insertionIndex]->setV({ 0, 0, 0 });
+                    ghosts[insertionIndex]->setF({ 0, 0, 0 });
+                    ghosts[insertionIndex]->setOldF({ 0, 0, 0 });
+                    ghosts[insertionIndex]->setM(record.m);
+                    ghosts[insertionIndex]->setType(record.type);
+                } else {
+                    ghosts.push_back(std::make_unique<Particle>(record.x,
+                        std::array<double, 3> { 0, 0, 0 },
+                        record.m,
+                        record.type,
+                        0,
+                        false));
+                    ghosts.back()->setActivity(false);
+                }
+                grid.cells[index[0]][index[1]][index[2]]->addParticle(*ghosts[insertionIndex++]);
+            }
+        }
+    }
+
+    // erase all leftover particles, if there are any
+    if (insertionIndex < ghosts.size())
+        ghosts.erase(ghosts.begin() + static_cast<long>(insertionIndex), ghosts.end());
+}
+
+void DomainDecomposition::clearGhosts(CellGrid& grid) const
+{
+    for (size_t d = 0; d < dimensions; ++d) {
+        for (size_t side = 0; side < 2; ++side) {
+            if (neighbors[d][side] < 0)
+                continue;
+            for (CellIndex index : grid.haloCellIterator(sides[d][side]))
+                grid.cells[index[0]][index[1]][index[2]]->clearParticles();
+        }
+    }
+}
+
+void DomainDecomposition::migrate(ParticleContainer& container, CellGrid& grid) const
+{
+    const std::array<size_t, 3> cells = grid.getGridDimensions();
+    auto& particles = container.particles;
+
+    // dimension by dimension, so particles that left through an edge or corner are forwarded
+    for (size_t d = 0; d < dimensions; ++d) {
+        if (neighbors[d][0] < 0 && neighbors[d][1] < 0)
+            continue;
+
+        std::array<std::vector<ParticleRecord>, 2> send;
+        for (auto& particle : particles) {
+            if (!particle.getActivity())
+                continue;
+            const size_t index = grid.getIndexFromPos(particle.getX())[d];
+            const size_t side = index == 0 ? 0 : 1;
+            if ((index != 0 && index != cells[d] - 1) || neighbors[d][side] < 0)
+                continue;
+
+            ParticleRecord record { particle.getX(),
+                                    particle.getV(),
+                                    particle.getF(),
+                                    particle.getOldF(),
+                                    particle.getM(),
+                                    particle.getType(),
+                                    particle.getIsNotStationary(),
+                                    particle.getID(),
+                                    particle.getMoleculeId() };
+            record.x[d] += getShift(d, side);
+            send[side].push_back(record);
+            particle.setActivity(false);
+        }
+
+        std::array<std::vector<ParticleRecord>, 2> received;
+        exchange(d, send[0], send[1], received[0], received[1]);
+
+        for (const auto& fromSide : received) {
+            for (const ParticleRecord& record : fromSide) {
+                particles.emplace_back(record.x,
+                    record.v,
+                    record.m,
+                    record.type,
+                    record.id,
+                    record.isNotStationary != 0,
+                    record.moleculeId);
+                particles.back().setF(record.f);
+                particles.back().setOldF(record.oldF);
+            }
+        }
+    }
+
+    // the cells reference the particles, which moved in the vector, so the cells are rebuilt
+    particles.erase(std::remove_if(particles.begin(),
+                        particles.end(),
+                        [](const Particle& particle) { return !particle.getActivity(); }),
+        particles.end());
+    container.activeParticleCount = static_cast<int>(particles.size());
+    container.inactiveParticleMap.clear();
+    grid.clearParticles();
+    grid.addParticlesFromContainer(container);
+}
+
+int DomainDecomposition::getNeighbor(Position position) const
+{
+    for (size_t d = 0; d < dimensions; ++d) {
+        for (size_t side = 0; side < 2; ++side) {
+            if (sides[d][side] == position)
+                return neighbors[d][side];
+        }
+    }
+    return -1;
+}
+
+size_t DomainDecomposition::getGhostBytes() const
+{
+    return MemoryUtils::vectorBytes(ghosts) + ghosts.size() * sizeof(Particle);
+}
+
+double DomainDecomposition::getShift(size_t dimension, bool upper) const
+{
+    if (!wraps[dimension][upper])
+        return 0;
+    // a particle leaving through the upper side enters at the lower side and vice versa
+    return upper ? -domainSize[dimension] : domainSize[dimension];
+}
+
+template <typename Record>
+void DomainDecomposition::exchange(
+    size_t dimension,
+    const std::vector<Record>& toLower,
+    const std::vector<Record>& toUpper,
+    std::vector<Record>& fromLower,
+    std::vector<Record>& fromUpper) const
+{
+    const int lower = neighbors[dimension][0];
+    const int upper = neighbors[dimension][1];
+#ifdef MOLSIM_MPI
+    if (MPIUtils::isInitialized()) {
+        // with two ranks both neighbors are the same, so the tags tell the directions apart
+        const int downTag = static_cast<int>(4 * dimension);
+        const int upTag = downTag + 1;
+        const int lowerRank = lower < 0 ? MPI_PROC_NULL : lower;
+        const int upperRank = upper < 0 ? MPI_PROC_NULL : upper;
+
+        std::array<unsigned long long, 2> sendCounts { toLower.size(), toUpper.size() };
+        std::array<unsigned long long, 2> receiveCounts { 0, 0 };
+        std::array<MPI_Request, 4> requests {};
+        MPI_Irecv(&receiveCounts[0], 1, MPI_UNSIGNED_LONG_LONG, lowerRank, upTag, MPI_COMM_WORLD,
+            &requests[0]);
+        MPI_Irecv(&receiveCounts[1], 1, MPI_UNSIGNED_LONG_LONG, upperRank, downTag, MPI_COMM_WORLD,
+            &requests[1]);
+        MPI_Isend(&sendCounts[0], 1, MPI_UNSIGNED_LONG_LONG, lowerRank, downTag, MPI_COMM_WORLD,
+            &requests[2]);
+        MPI_Isend(&sendCounts[1], 1, MPI_UNSIGNED_LONG_LONG, upperRank, upTag, MPI_COMM_WORLD,
+            &requests[3]);
+        MPI_Waitall(4, requests.data(), MPI_STATUSES_IGNORE);
+
+        fromLower.resize(receiveCounts[0]);
+        fromUpper.resize(receiveCounts[1]);
+        auto bytes = [](const std::vector<Record>& records) {
+            return static_cast<int>(records.size() * sizeof(Record));
+        };
+        MPI_Irecv(fromLower.data(), bytes(fromLower), MPI_BYTE, lowerRank, upTag + 2,
+            MPI_COMM_WORLD, &requests[0]);
+        MPI_Irecv(fromUpper.data(), bytes(fromUpper), MPI_BYTE, upperRank, downTag + 2,
+            MPI_COMM_WORLD, &requests[1]);
+        MPI_Isend(toLower.data(), bytes(toLower), MPI_BYTE, lowerRank, downTag + 2, MPI_COMM_WORLD,
+            &requests[2]);
+        MPI_Isend(toUpper.data(), bytes(toUpper), MPI_BYTE, upperRank, upTag + 2, MPI_COMM_WORLD,
+            &requests[3]);
+        MPI_Waitall(4, requests.data(), MPI_STATUSES_IGNORE);
+        return;
+    }
+#endif
+    // a single process only exchanges with itself across its periodic sides
+    fromLower = lower == rank ? toUpper : std::vector<Record> {};
+    fromUpper = upper == rank ? toLower : std::vector<Record> {};
+}
@@ -0,0 +1,226 @@
+
+#pragma once
+
+#include "models/Particle.h"
+#include "models/linked_cell/cell/Cell.h"
+#include "physics/boundaryConditions/BoundaryConfig.h"
+#include <array>
+#include <memory>
+#include <vector>
+
+// forward declare
+class CellGrid;
+class ParticleContainer;
+
+/**
+ * @brief The data of a halo particle sent to a neighboring rank
+ */
+struct GhostRecord {
+    std::array<double, 3> x; /**< The position, shifted if it crosses a periodic boundary */
+    double m; /**< The mass */
+    int type; /**< The type */
+    std::array<unsigned, 3> cell; /**< The cell index, the exchanged dimension is set on receipt */
+};
+
+/**
+ * @brief The data of a particle migrating to a neighboring rank
+ */
+struct ParticleRecord {
+    std::array<double, 3> x; /**< The position, shifted if it crosses a periodic boundary */
+    std::array<double, 3> v; /**< The velocity */
+    std::array<double, 3> f; /**< The force */
+    std::array<double, 3> oldF; /**< The force of the previous iteration */
+    double m; /**< The mass */
+    int type; /**< The type */
+    int isNotStationary; /**< Whether the particle moves */
+    size_t id; /**< The id, kept across ranks */
+    size_t moleculeId; /**< The molecule id */
+};
+
+/**
+ * @class DomainDecomposition
+ * @brief Splits the cell grid of a domain into a Cartesian grid of MPI ranks
+ * @details Every rank owns the particles of a block of whole cells of the global grid and builds
+ * its own CellGrid for it. Sides shared with another rank, and all periodic sides, are of
+ * BoundaryType::RANK in the local boundary configuration: their halo cells are filled with copies
+ * of the neighbor's boundary cells every iteration, one dimension after another, so edge and
+ * corner halos are forwarded as well. Particles that left the local domain are migrated to the
+ * owning neighbor whenever the cells are updated. Without MPI, a single rank exchanges with
+ * itself across its periodic sides.
+ */
+class DomainDecomposition {
+public:
+    /**
+     * @brief Construct the decomposition of a domain
+     * @param rank The rank of this process
+     * @param size The number of ranks
+     * @param domainOrigin The origin of the global domain
+     * @param domainSize The size of the global domain
+     * @param cutoff The cutoff radius, which determines the global cell grid
+     * @param boundaryConfig The boundary configuration of the global domain
+     * @param rankGrid The number of ranks per dimension, 0 to choose it automatically
+     */
+    DomainDecomposition(
+        int rank,
+        int size,
+        std::array<double, 3> domainOrigin,
+        std::array<double, 3> domainSize,
+        double cutoff,
+        const BoundaryConfig& boundaryConfig,
+        std::array<int, 3> rankGrid = { 0, 0, 0 });
+
+    /**
+     * @brief Choose the number of ranks per dimension that minimizes the surface of the
+     * subdomains, i.e. the halo that has to be exchanged
+     * @param size The number of ranks
+     * @param cells The number of cells of the global grid per dimension
+     * @param dimensions The dimensionality of the domain, the z dimension is not split in 2D
+     * @return The ranks per dimension, all 0 if the cells cannot be split into size ranks
+     */
+    static std::array<int, 3> chooseRankGrid(
+        int size, const std::array<size_t, 3>& cells, size_t dimensions);
+
+    /**
+     * @brief Keep the particles of the local domain and drop all others
+     * @param container The particles read by every rank
+     * @param grid The local grid
+     */
+    void distribute(ParticleContainer& container, const CellGrid& grid) const;
+
+    /**
+     * @brief Split the domain cells of the local grid into interior cells, whose neighbors are
+     * all local, and boundary cells, which are next to the halo of an exchanged side
+     * @details The interior cells can be calculated while the halos are exchanged.
+     * @param grid The local grid
+     */
+    void splitCells(const CellGrid& grid);
+
+    /**
+     * @brief Fill the halo cells of the exchanged sides with copies of the neighbors' particles
+     * @param grid The local grid, whose halo cells must not contain particles of other sides
+     */
+    void exchangeGhosts(CellGrid& grid);
+
+    /**
+     * @brief Remove the copies of the neighbors' particles from the halo cells
+     * @param grid The local grid
+     */
+    void clearGhosts(CellGrid& grid) const;
+
+    /**
+     * @brief Send particles that left the local domain to their neighbor, receive the arriving
+     * ones and rebuild the cell lists. Inactive particles are removed from the container.
+     * @details This replaces CellGrid::updateCells.
+     * @param container The local particles
+     * @param grid The local grid
+     */
+    void migrate(ParticleContainer& container, CellGrid& grid) const;
+
+    /**
+     * @brief Get the rank of this process
+     * @return The rank
+     */
+    inline int getRank() const { return rank; }
+
+    /**
+     * @brief Get the number of ranks
+     * @return The number of ranks
+     */
+    inline int getSize() const { return size; }
+
+    /**
+     * @brief Get the number of ranks per dimension
+     * @return The ranks per dimension
+     */
+    inline std::array<int, 3> getRankGrid() const { return rankGrid; }
+
+    /**
+     * @brief Get the coordinates of this rank in the rank grid
+     * @return The coordinates
+     */
+    inline std::array<int, 3> getCoordinates() const { return coordinates; }
+
+    /**
+     * @brief Get the origin of the local domain
+     * @return The origin
+     */
+    inline std::array<double, 3> getLocalOrigin() const { return localOrigin; }
+
+    /**
+     * @brief Get the size of the local domain
+     * @return The size
+     */
+    inline std::array<double, 3> getLocalSize() const { return localSize; }
+
+    /**
+     * @brief Get the boundary configuration of the local domain
+     * @return The global boundaries at the sides of the global domain, RANK at all others
+     */
+    inline const BoundaryConfig& getLocalBoundaryConfig() const { return localConfig; }
+
+    /**
+     * @brief Get the rank on the other side of a side of the local domain
+     * @param position The side
+     * @return The neighbor, -1 if the side is a non-periodic side of the global domain
+     */
+    int getNeighbor(Position position) const;
+
+    /**
+     * @brief Get the domain cells that do not depend on the halos of the exchanged sides
+     * @return The interior cells, empty before splitCells
+     */
+    inline const std::vector<CellIndex>& getInteriorCells() const { return interiorCells; }
+
+    /**
+     * @brief Get the domain cells next to the halo of an exchanged side
+     * @return The boundary cells, empty before splitCells
+     */
+    inline const std::vector<CellIndex>& getBoundaryCells() const { return boundaryCells; }
+
+    /**
+     * @brief Get the heap memory of the halo particles, which are kept for recycling
+     * @return The bytes of the halo particles
+     */
+    size_t getGhostBytes() const;
+
+private:
+    int rank; /**< The rank of this process */
+    int size; /**< The number of ranks */
+    size_t dimensions; /**< The dimensionality of the domain */
+    std::array<int, 3> rankGrid; /**< The number of ranks per dimension */
+    std::array<int, 3> coordinates; /**< The coordinates of this rank in the rank grid */
+    std::array<double, 3> domainSize; /**< The size of the global domain */
+    std::array<double, 3> localOrigin; /**< The origin of the local domain */
+    std::array<double, 3> localSize; /**< The size of the local domain */
+    BoundaryConfig localConfig; /**< The boundaries of the local domain */
+    std::array<std::array<int, 2>, 3> neighbors; /**< Lower and upper neighbor per dimension */
+    std::array<std::array<bool, 2>, 3> wraps; /**< Whether a side is a periodic side */
+
+    std::vector<std::unique_ptr<Particle>> ghosts; /**< The halo particles, recycled */
+    std::vector<CellIndex> interiorCells; /**< The cells independent of the exchanged halos */
+    std::vector<CellIndex> boundaryCells; /**< The cells next to the exchanged halos */
+
+    /**
+     * @brief Get the shift of the positions sent across a side
+     * @param dimension The dimension
+     * @param upper Whether the upper side of the dimension
+     * @return The shift, non-zero if the side is periodic
+     */
+    double getShift(size_t dimension, bool upper) const;
+
+    /**
+     * @brief Send a buffer to both neighbors of a dimension and receive theirs
+     * @param dimension The dimension
+     * @param toLower The records for the lower neighbor
+     * @param toUpper The records for the upper neighbor
+     * @param fromLower The records received from the lower neighbor
+     * @param fromUpper The records received from the upper neighbor
+     */
+    template <typename Record>
+    void exchange(
+        size_t dimension,
+        const std::vector<Record>& toLower,
+        const std::vector<Record>& toUpper,
+        std::vector<Record>& fromLower,
+        std::vector<Record>& fromUpper) const;
+};
@@ -0,0 +1,133 @@
+
+#include "LoadBalancer.h"
+#include "models/linked_cell/CellGrid.h"
+#include <algorithm>
+#include <numeric>
+#include <spdlog/spdlog.h>
+
+namespace {
+
+/**
+ * @brief Split a block into parts blocks of about equal cost and append them
+ * @param cost The cost of every column, x major
+ * @param yColumns The number of columns in y
+ * @param block The block to split
+ * @param parts The number of blocks to split it into
+ * @param blocks The blocks to append to
+ */
+void bisectBlock(const std::vector<double>& cost,
+    size_t yColumns,
+    ColumnBlock block,
+    size_t parts,
+    std::vector<ColumnBlock>& blocks)
+{
+    if (parts == 1 || block.size() <= 1) {
+        blocks.push_back(block);
+        // a single column cannot be split, the remaining parts are empty
+        for (size_t i = 1; i < parts; ++i)
+            blocks.push_back({ block.xBegin, block.xBegin, block.yBegin, block.yBegin });
+        return;
+    }
+
+    // cut across the longer side into slabs, so the blocks stay compact
+    const bool alongX = block.xEnd - block.xBegin >= block.yEnd - block.yBegin;
+    const size_t begin = alongX ? block.xBegin : block.yBegin;
+    const size_t end = alongX ? block.xEnd : block.yEnd;
+    std::vector<double> slabs(end - begin, 0);
+    for (size_t x = block.xBegin; x < block.xEnd; ++x) {
+        for (size_t y = block.yBegin; y < block.yEnd; ++y)
+            slabs[(alongX ? x : y) - begin] += cost[(x - 1) * yColumns + (y - 1)];
+    }
+    double total = std::accumulate(slabs.begin(), slabs.end(), 0.0);
+    if (total <= 0) {
+        // nothing was measured, so every column costs the same
+        std::fill(slabs.begin(), slabs.end(), 1.0);
+        total = static_cast<double>(slabs.size());
+    }
+
+    // the lower block takes the slabs whose center lies below its share of the cost
+    const size_t lowerParts = parts / 2;
+    const double target = total * static_cast<double>(lowerParts) / static_cast<double>(parts);
+    size_t cut = begin + 1;
+    double prefix = slabs[0];
+    while (cut < end - 1 && prefix + slabs[cut - begin] / 2 < target) {
+        prefix += slabs[cut - begin];
+        ++cut;
+    }
+
+    ColumnBlock lower = block;
+    ColumnBlock upper = block;
+    (alongX ? lower.xEnd : lower.yEnd) = cut;
+    (alongX ? upper.xBegin : upper.yBegin) = cut;
+    bisectBlock(cost, yColumns, lower, lowerParts, blocks);
+    bisectBlock(cost, yColumns, upper, parts - lowerParts, blocks);
+}
+
+} // namespace
+
+LoadBalancer::LoadBalancer(size_t interval)
+    : interval(interval)
+{
+}
+
+void LoadBalancer::update(const CellGrid& grid, size_t parts)
+{
+    const std::array<size_t, 3> cells = grid.getGridDimensions();
+    const size_t xColumns = cells[0] - 2;
+    const size_t yColumns = cells[1] - 2;
+
+    if (xColumns != xSize || yColumns != ySize || parts != blocks.size()) {
+        // nothing was measured yet, so the particles of a column estimate its cost
+        xSize = xColumns;
+        ySize = yColumns;
+        cost.assign(xSize * ySize, 0);
+        for (size_t x = 1; x <= xSize; ++x) {
+            for (size_t y = 1; y <= ySize; ++y) {
+                double& column = cost[(x - 1) * ySize + (y - 1)];
+                for (size_t z = 0; z < cells[2]; ++z)
+                    column += static_cast<double>(grid.cells[x][y][z]->getParticles().size());
+                column += 1;
+            }
+        }
+        blocks = bisect(cost, xSize, ySize, parts);
+        std::fill(cost.begin(), cost.end(), 0.0);
+        calls = 0;
+        return;
+    }
+
+    if (!interval || ++calls < interval)
+        return;
+
+    // the slowest block determines the time of the force calculation
+    double slowest = 0;
+    double sum = 0;
+    for (const ColumnBlock& block : blocks) {
+        double blockCost = 0;
+        for (size_t x = block.xBegin; x < block.xEnd; ++x) {
+            for (size_t y = block.yBegin; y < block.yEnd; ++y)
+                blockCost += cost[(x - 1) * ySize + (y - 1)];
+        }
+        slowest = std::max(slowest, blockCost);
+        sum += blockCost;
+    }
+    imbalance = sum > 0 ? slowest * static_cast<double>(blocks.size()) / sum : 1;
+    spdlog::debug("Rebalancing {} blocks, imbalance of the last {} iterations: {:.3f}",
+        blocks.size(),
+        calls,
+        imbalance);
+
+    blocks = bisect(cost, xSize, ySize, parts);
+    std::fill(cost.begin(), cost.end(), 0.0);
+    calls = 0;
+    ++rebalances;
+}
+
+std::vector<ColumnBlock> LoadBalancer::bisect(
+    const std::vector<double>& cost, size_t xColumns, size_t yColumns, size_t parts)
+{
+    std::vector<ColumnBlock> blocks;
+    blocks.reserve(parts);
+    bisectBlock(cost, yColumns, { 1, xColumns + 1, 1, yColumns + 1 }, std::max<size_t>(parts, 1),
+        blocks);
+    return blocks;
+}
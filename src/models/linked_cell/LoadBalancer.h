@@ -0,0 +1,115 @@
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// forward declare
+class CellGrid;
+
+/**
+ * @brief A rectangle of cell columns, i.e. all cells with x in [xBegin, xEnd) and y in
+ * [yBegin, yEnd) of a grid
+ */
+struct ColumnBlock {
+    size_t xBegin; /**< The first x index */
+    size_t xEnd; /**< The x index after the last one */
+    size_t yBegin; /**< The first y index */
+    size_t yEnd; /**< The y index after the last one */
+
+    /**
+     * @brief Get the number of columns of the block
+     * @return The columns, 0 if the block is empty
+     */
+    inline size_t size() const { return (xEnd - xBegin) * (yEnd - yBegin); }
+};
+
+/**
+ * @class LoadBalancer
+ * @brief Partitions the cell columns of a grid into one block per thread, so that every thread
+ * spends about the same time in the force calculation
+ * @details The blocks are found by orthogonal recursive bisection: a block of columns is cut
+ * across its longer side where the cost on both sides matches the number of threads assigned to
+ * them. The first partition estimates the cost of a column by its particles, afterwards the
+ * force calculation time of every column is measured and the columns are partitioned again after
+ * every interval, so the blocks follow the particles, e.g. of a falling drop.
+ */
+class LoadBalancer {
+public:
+    /**
+     * @brief Construct a new load balancer
+     * @param interval The number of force calculations between two partitions (default = 100)
+     */
+    explicit LoadBalancer(size_t interval = 100);
+
+    /**
+     * @brief Partition the columns if the grid or the number of blocks changed or the interval
+     * has passed, called before every force calculation
+     * @param grid The grid whose domain columns are partitioned
+     * @param parts The number of blocks, usually the number of threads
+     */
+    void update(const CellGrid& grid, size_t parts);
+
+    /**
+     * @brief Add the force calculation time of a column, every column must be measured by a
+     * single thread
+     * @param x The x index of the column
+     * @param y The y index of the column
+     * @param seconds The time of the column
+     */
+    inline void addCost(size_t x, size_t y, double seconds)
+    {
+        cost[(x - 1) * ySize + (y - 1)] += seconds;
+    }
+
+    /**
+     * @brief Get the blocks of the current partition
+     * @return The blocks, some may be empty if there are fewer columns than blocks
+     */
+    inline const std::vector<ColumnBlock>& getBlocks() const { return blocks; }
+
+    /**
+     * @brief Get the number of force calculations between two partitions
+     * @return The interval, 0 if the columns are only partitioned once
+     */
+    inline size_t getInterval() const { return interval; }
+
+    /**
+     * @brief Set the number of force calculations between two partitions
+     * @param newInterval The interval, 0 to only partition the columns once
+     */
+    inline void setInterval(size_t newInterval) { interval = newInterval; }
+
+    /**
+     * @brief Get the number of partitions based on measured costs
+     * @return The number of rebalances
+     */
+    inline size_t getRebalanceCount() const { return rebalances; }
+
+    /**
+     * @brief Get the ratio of the slowest block to the mean block in the last measured interval
+     * @return The imbalance, 1 for a perfect balance
+     */
+    inline double getImbalance() const { return imbalance; }
+
+    /**
+     * @brief Partition a grid of columns by orthogonal recursive bisection
+     * @param cost The cost of every column, x major
+     * @param xColumns The number of columns in x
+     * @param yColumns The number of columns in y
+     * @param parts The number of blocks
+     * @return The blocks with column indices starting at 1, as the domain cells of a grid
+     */
+    static std::vector<ColumnBlock> bisect(
+        const std::vector<double>& cost, size_t xColumns, size_t yColumns, size_t parts);
+
+private:
+    size_t interval; /**< The force calculations between two partitions */
+    size_t calls = 0; /**< The force calculations since the last partition */
+    size_t rebalances = 0; /**< The partitions based on measured costs */
+    double imbalance = 1; /**< The imbalance of the last measured interval */
+    size_t xSize = 0; /**< The number of domain columns in x */
+    size_t ySize = 0; /**< The number of domain columns in y */
+    std::vector<double> cost; /**< The cost of every domain column since the last partition */
+    std::vector<ColumnBlock> blocks; /**< The current partition */
+};
@@ -0,0 +1,112 @@
+
+#include "models/linked_cell/MultiLevelGrid.h"
+#include "models/linked_cell/CellGrid.h"
+#include "utils/ArrayUtils.h"
+#include "utils/MemoryUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <spdlog/spdlog.h>
+
+MultiLevelGrid::MultiLevelGrid(
+    const CellGrid& grid, const std::map<std::pair<int, int>, double>& pairCutoffs)
+    : origin(grid.getDomainOrigin() - grid.getCellSize())
+{
+    for (const auto& [types, cutoff] : pairCutoffs) {
+        const auto largest = static_cast<size_t>(std::max(types.first, types.second));
+        typeCount = std::max(typeCount, largest + 1);
+    }
+    cutoffsSquared.assign(typeCount * typeCount, 0);
+    for (const auto& [types, cutoff] : pairCutoffs) {
+        const auto [type1, type2] = types;
+        cutoffsSquared[type1 * typeCount + type2] = cutoff * cutoff;
+        cutoffsSquared[type2 * typeCount + type1] = cutoff * cutoff;
+    }
+
+    // the types with the same cutoff among themselves share a level
+    std::map<double, std::vector<int>> typesOfCutoff;
+    for (const auto& [types, cutoff] : pairCutoffs) {
+        if (types.first == types.second)
+            typesOfCutoff[cutoff].push_back(types.first);
+    }
+    // the levels span the domain and the halo of the grid
+    const std::array<double, 3> extent = grid.getDomainSize() + 2 * grid.getCellSize();
+    levelOfType.assign(typeCount, -1);
+    for (const auto& [cutoff, types] : typesOfCutoff) {
+        CellLevel level;
+        level.types = types;
+        level.cutoff = cutoff;
+        for (size_t d = 0; d < 3; ++d) {
+            level.dimensions[d] = 1;
+            if (d < grid.gridDimensionality && extent[d] >= cutoff)
+                level.dimensions[d] = static_cast<size_t>(std::floor(extent[d] / cutoff));
+            level.cellSize[d] = d < grid.gridDimensionality
+                ? extent[d] / static_cast<double>(level.dimensions[d])
+                : 0;
+        }
+        level.cells.resize(level.dimensions[0] * level.dimensions[1] * level.dimensions[2]);
+        for (int type : types)
+            levelOfType[type] = static_cast<int>(levels.size());
+        levels.push_back(std::move(level));
+    }
+
+    searchRadii.assign(typeCount * levels.size(), 0);
+    for (size_t type = 0; type < typeCount; ++type) {
+        for (size_t l = 0; l < levels.size(); ++l) {
+            double& radius = searchRadii[type * levels.size() + l];
+            for (int other : levels[l].types)
+                radius = std::max(radius, std::sqrt(cutoffSquared(static_cast<int>(type), other)));
+        }
+    }
+
+    for (const CellLevel& level : levels)
+        spdlog::info("Cell level of cutoff {} with {}x{}x{} cells",
+            level.cutoff,
+            level.dimensions[0],
+            level.dimensions[1],
+            level.dimensions[2]);
+}
+
+void MultiLevelGrid::rebuild(const CellGrid& grid)
+{
+    for (CellLevel& level : levels) {
+        for (auto& cell : level.cells)
+            cell.clear();
+    }
+
+    for (const auto& plane : grid.cells) {
+        for (const auto& row : plane) {
+            for (const auto& cell : row) {
+                const bool owned = cell->getType() != CellType::Halo;
+                for (auto particle : cell->getParticles()) {
+                    LevelEntry entry { &particle.get(),
+                                       particle.get().getX(),
+                                       particle.get().getType(),
+                                       owned };
+                    if (entry.type < 0 || static_cast<size_t>(entry.type) >= typeCount
+                        || levelOfType[entry.type] < 0) {
+                        spdlog::error("Particle type {} has no cutoff", entry.type);
+                        exit(EXIT_FAILURE);
+                    }
+                    CellLevel& level = levels[levelOfType[entry.type]];
+                    const size_t x = index(level, 0, entry.x[0]);
+                    const size_t y = index(level, 1, entry.x[1]);
+                    const size_t z = index(level, 2, entry.x[2]);
+                    level.cells[(x * level.dimensions[1] + y) * level.dimensions[2] + z].push_back(
+                        entry);
+                }
+            }
+        }
+    }
+}
+
+size_t MultiLevelGrid::getMemoryBytes() const
+{
+    size_t bytes = MemoryUtils::vectorBytes(levels) + MemoryUtils::vectorBytes(levelOfType)
+        + MemoryUtils::vectorBytes(cutoffsSquared) + MemoryUtils::vectorBytes(searchRadii);
+    for (const CellLevel& level : levels) {
+        bytes += MemoryUtils::vectorBytes(level.types) + MemoryUtils::vectorBytes(level.cells);
+        for (const auto& cell : level.cells)
+            bytes += MemoryUtils::vectorBytes(cell);
+    }
+    return bytes;
+}
@@ -0,0 +1,154 @@
+
+#pragma once
+
+#include "models/Particle.h"
+#include <array>
+#include <map>
+#include <utility>
+#include <vector>
+
+// forward declare
+class CellGrid;
+
+/**
+ * @brief A particle in a cell of a level, with the position and type it had when the levels
+ * were built
+ */
+struct LevelEntry {
+    Particle* particle; /**< The particle */
+    std::array<double, 3> x; /**< The position of the particle */
+    int type; /**< The type of the particle */
+    bool owned; /**< False for halo particles, whose pairs are calculated by the other particle */
+};
+
+/**
+ * @brief The cells of the particle types that share one cutoff, sized to that cutoff
+ */
+struct CellLevel {
+    std::vector<int> types; /**< The particle types of the level */
+    double cutoff; /**< The cutoff of the types of the level with each other */
+    std::array<size_t, 3> dimensions; /**< The cells per dimension */
+    std::array<double, 3> cellSize; /**< The size of a cell per dimension, 0 in z for 2D grids */
+    std::vector<std::vector<LevelEntry>> cells; /**< The particles per cell, x-major */
+};
+
+/**
+ * @class MultiLevelGrid
+ * @brief Linked cells with one level of cells per cutoff of the particle types, for mixtures
+ * whose types interact over very different distances
+ * @details A single grid needs cells of the largest cutoff, so small particles search a
+ * neighbourhood sized for the largest type. Here the particle types with the same cutoff among
+ * themselves share a level whose cells match that cutoff. A particle searches every level within
+ * the largest cutoff of its type with the types of that level, so every pair class is searched
+ * with cells matched to its own cutoff. The levels cover the domain and the halo of the cell
+ * grid and are built from its cells before every force calculation.
+ */
+class MultiLevelGrid {
+public:
+    /**
+     * @brief Construct the levels of a grid
+     * @param grid The cell grid, whose cutoff is the largest cutoff of all pairs
+     * @param pairCutoffs The cutoff of every pair of types, with the smaller type first
+     */
+    MultiLevelGrid(const CellGrid& grid, const std::map<std::pair<int, int>, double>& pairCutoffs);
+
+    /**
+     * @brief Sort the particles of the cell grid into the cells of their levels
+     * @param grid The cell grid, the particles of its halo cells are not owned
+     */
+    void rebuild(const CellGrid& grid);
+
+    /**
+     * @brief Call a function for every particle a particle of the domain has to be checked
+     * against, every pair is visited once
+     * @param owner The particle, which must be owned
+     * @param function Called with the other particle and the squared cutoff of the pair
+     */
+    template <typename Function>
+    void forEachCandidate(const LevelEntry& owner, Function&& function) const
+    {
+        for (size_t l = 0; l < levels.size(); ++l) {
+            const CellLevel& level = levels[l];
+            const double search = searchRadius(owner.type, l);
+            if (search <= 0)
+                continue;
+            std::array<size_t, 3> low {};
+            std::array<size_t, 3> high {};
+            for (size_t d = 0; d < 3; ++d) {
+                low[d] = index(level, d, owner.x[d] - search);
+                high[d] = index(level, d, owner.x[d] + search);
+            }
+            for (size_t x = low[0]; x <= high[0]; ++x) {
+                for (size_t y = low[1]; y <= high[1]; ++y) {
+                    for (size_t z = low[2]; z <= high[2]; ++z) {
+                        const size_t cell = (x * level.dimensions[1] + y) * level.dimensions[2] + z;
+                        for (const LevelEntry& other : level.cells[cell]) {
+                            // pairs of two owned particles are visited from the first one
+                            if (other.particle == owner.particle
+                                || (other.owned && other.particle < owner.particle))
+                                continue;
+                            function(other, cutoffSquared(owner.type, other.type));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Get the levels
+     * @return The levels, sorted by their cutoff
+     */
+    inline const std::vector<CellLevel>& getLevels() const { return levels; }
+
+    /**
+     * @brief Get the squared cutoff of a pair of types
+     * @param type1 The type of the first particle
+     * @param type2 The type of the second particle
+     * @return The squared cutoff
+     */
+    inline double cutoffSquared(int type1, int type2) const
+    {
+        return cutoffsSquared[static_cast<size_t>(type1) * typeCount + static_cast<size_t>(type2)];
+    }
+
+    /**
+     * @brief Returns the heap memory of the levels
+     * @return The bytes of all cells and their particle lists
+     */
+    [[nodiscard]] size_t getMemoryBytes() const;
+
+private:
+    /**
+     * @brief Get the largest cutoff of a type with the types of a level
+     * @param type The type
+     * @param level The index of the level
+     * @return The distance to search the level within
+     */
+    inline double searchRadius(int type, size_t level) const
+    {
+        return searchRadii[static_cast<size_t>(type) * levels.size() + level];
+    }
+
+    /**
+     * @brief Get the cell index of a coordinate in one dimension, clamped to the level
+     * @param level The level
+     * @param d The dimension
+     * @param coordinate The coordinate
+     * @return The cell index in this dimension
+     */
+    inline size_t index(const CellLevel& level, size_t d, double coordinate) const
+    {
+        if (level.dimensions[d] == 1 || coordinate <= origin[d])
+            return 0;
+        auto i = static_cast<size_t>((coordinate - origin[d]) / level.cellSize[d]);
+        return i < level.dimensions[d] ? i : level.dimensions[d] - 1;
+    }
+
+    std::array<double, 3> origin; /**< The lower corner of the halo of the cell grid */
+    std::vector<CellLevel> levels; /**< The levels, sorted by their cutoff */
+    size_t typeCount = 0; /**< The largest type plus one */
+    std::vector<int> levelOfType; /**< The level of every type, -1 for unknown types */
+    std::vector<double> cutoffsSquared; /**< The squared cutoff of every pair of types */
+    std::vector<double> searchRadii; /**< The largest cutoff of every type with every level */
+};
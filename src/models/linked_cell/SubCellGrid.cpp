@@ -0,0 +1,95 @@
+
+#include "models/linked_cell/SubCellGrid.h"
+#include "models/linked_cell/CellGrid.h"
+#include "utils/ArrayUtils.h"
+#include "utils/MemoryUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <spdlog/spdlog.h>
+
+SubCellGrid::SubCellGrid(const CellGrid& grid, double cellSizeFactor)
+    : origin(grid.getDomainOrigin() - grid.getCellSize())
+{
+    const double cutoff = grid.getCutoffRadius();
+    const std::array<size_t, 3> gridDimensions = grid.getGridDimensions();
+    const std::array<double, 3> gridCellSize = grid.getCellSize();
+    for (size_t d = 0; d < 3; ++d) {
+        size_t subdivisions = 1;
+        if (d < grid.gridDimensionality) {
+            // cells wider than the cutoff leave room for more sub cells of the factor
+            const double fit = std::floor(gridCellSize[d] / (cellSizeFactor * cutoff) + 1e-9);
+            subdivisions = std::max<size_t>(1, static_cast<size_t>(fit));
+        }
+        dimensions[d] = gridDimensions[d] * subdivisions;
+        cellSize[d] = gridCellSize[d] / static_cast<double>(subdivisions);
+    }
+    cells.resize(dimensions[0] * dimensions[1] * dimensions[2]);
+    stencil = halfShell(cellSize, cutoff, grid.gridDimensionality);
+
+    spdlog::info("Sub cells of size {}x{}x{} with {}x{}x{} cells and {} stencil neighbours",
+        cellSize[0],
+        cellSize[1],
+        cellSize[2],
+        dimensions[0],
+        dimensions[1],
+        dimensions[2],
+        stencil.size());
+}
+
+std::vector<std::array<int, 3>> SubCellGrid::halfShell(
+    const std::array<double, 3>& cellSize, double cutoff, size_t dimensionality)
+{
+    std::array<int, 3> reach { 0, 0, 0 };
+    for (size_t d = 0; d < dimensionality; ++d)
+        reach[d] = static_cast<int>(std::ceil(cutoff / cellSize[d] - 1e-9));
+
+    std::vector<std::array<int, 3>> offsets;
+    for (int x = 0; x <= reach[0]; ++x) {
+        for (int y = x > 0 ? -reach[1] : 0; y <= reach[1]; ++y) {
+            for (int z = x > 0 || y > 0 ? -reach[2] : 1; z <= reach[2]; ++z) {
+                // the closest points of two cells are one cell less apart than the offset
+                double distanceSquared = 0;
+                const std::array<int, 3> offset { x, y, z };
+                for (size_t d = 0; d < dimensionality; ++d) {
+                    const double gap = std::max(0, std::abs(offset[d]) - 1) * cellSize[d];
+                    distanceSquared += gap * gap;
+                }
+                if (distanceSquared <= cutoff * cutoff)
+                    offsets.push_back(offset);
+            }
+        }
+    }
+    return offsets;
+}
+
+void SubCellGrid::rebuild(const CellGrid& grid)
+{
+    for (auto& cell : cells)
+        cell.clear();
+
+    for (const auto& plane : grid.cells) {
+        for (const auto& row : plane) {
+            for (const auto& cell : row) {
+                const bool owned = cell->getType() != CellType::Halo;
+                for (auto particle : cell->getParticles()) {
+                    SubCellEntry entry { &particle.get(),
+                                         particle.get().getX(),
+                                         particle.get().getType(),
+                                         owned };
+                    const size_t x = index(0, entry.x[0]);
+                    const size_t y = index(1, entry.x[1]);
+                    const size_t z = index(2, entry.x[2]);
+                    cells[(x * dimensions[1] + y) * dimensions[2] + z].push_back(entry);
+                }
+            }
+        }
+    }
+}
+
+size_t SubCellGrid::getMemoryBytes() const
+{
+    size_t bytes = MemoryUtils::vectorBytes(cells) + MemoryUtils::vectorBytes(stencil);
+    for (const auto& cell : cells)
+        bytes += MemoryUtils::vectorBytes(cell);
+    return bytes;
+}
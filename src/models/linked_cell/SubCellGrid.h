@@ -0,0 +1,149 @@
+
+#pragma once
+
+#include "models/Particle.h"
+#include <array>
+#include <vector>
+
+// forward declare
+class CellGrid;
+
+/**
+ * @brief A particle in a sub cell, with the position and type it had when the sub cells were built
+ */
+struct SubCellEntry {
+    Particle* particle; /**< The particle */
+    std::array<double, 3> x; /**< The position of the particle */
+    int type; /**< The type of the particle */
+    bool owned; /**< False for halo particles, whose pairs with each other are not calculated */
+};
+
+/**
+ * @class SubCellGrid
+ * @brief Linked cells smaller than the cutoff, searched with a half-shell stencil that is
+ * generated for their size
+ * @details Cells of the cutoff make every particle check the 27 cells around it, which hold
+ * about 27 rc³ of particles for a cutoff sphere of 4.2 rc³. Splitting every cell of the grid into
+ * cells of a fraction of the cutoff fits the neighbourhood closer to the sphere. The stencil holds
+ * every offset within the cutoff in positive lexicographic order, so every pair of cells is
+ * visited once, and drops the offsets whose cells are further apart than the cutoff at their
+ * closest points. The sub cells cover the domain and the halo of the cell grid and are built from
+ * the positions of its particles before every force calculation.
+ */
+class SubCellGrid {
+public:
+    /**
+     * @brief Construct the sub cells of a grid
+     * @param grid The cell grid
+     * @param cellSizeFactor The size of the sub cells relative to the cutoff, every cell of the
+     * grid is split into the largest number of sub cells that are not smaller than this
+     */
+    SubCellGrid(const CellGrid& grid, double cellSizeFactor);
+
+    /**
+     * @brief Generate the half-shell stencil of cells of a size
+     * @param cellSize The size of a cell per dimension
+     * @param cutoff The cutoff radius
+     * @param dimensionality The dimensions of the grid, 2 or 3
+     * @return The offsets of the neighbour cells whose first non-zero coordinate is positive and
+     * whose closest points are within the cutoff
+     */
+    static std::vector<std::array<int, 3>> halfShell(
+        const std::array<double, 3>& cellSize, double cutoff, size_t dimensionality);
+
+    /**
+     * @brief Sort the particles of the cell grid into the sub cells of their positions
+     * @param grid The cell grid, the particles of its halo cells are not owned
+     */
+    void rebuild(const CellGrid& grid);
+
+    /**
+     * @brief Call a function for every pair of a sub cell with itself and its stencil neighbours
+     * with at least one owned particle, every pair of the grid is visited from one sub cell only
+     * @param cell The index of the sub cell
+     * @param function Called with both particles of the pair
+     */
+    template <typename Function>
+    void forEachPair(size_t cell, Function&& function) const
+    {
+        const std::vector<SubCellEntry>& particles = cells[cell];
+        if (particles.empty())
+            return;
+        for (size_t i = 0; i < particles.size(); ++i) {
+            for (size_t j = i + 1; j < particles.size(); ++j) {
+                if (particles[i].owned || particles[j].owned)
+                    function(particles[i], particles[j]);
+            }
+        }
+
+        const size_t z = cell % dimensions[2];
+        const size_t y = cell / dimensions[2] % dimensions[1];
+        const size_t x = cell / dimensions[2] / dimensions[1];
+        for (const std::array<int, 3>& offset : stencil) {
+            // negative neighbours wrap around and fail the bounds check
+            const size_t nx = x + static_cast<size_t>(offset[0]);
+            const size_t ny = y + static_cast<size_t>(offset[1]);
+            const size_t nz = z + static_cast<size_t>(offset[2]);
+            if (nx >= dimensions[0] || ny >= dimensions[1] || nz >= dimensions[2])
+                continue;
+            const auto& neighbours = cells[(nx * dimensions[1] + ny) * dimensions[2] + nz];
+            for (const SubCellEntry& particle : particles) {
+                for (const SubCellEntry& other : neighbours) {
+                    if (particle.owned || other.owned)
+                        function(particle, other);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Get the number of sub cells
+     * @return The number of sub cells, which are indexed x-major
+     */
+    inline size_t getCellCount() const { return cells.size(); }
+
+    /**
+     * @brief Get the dimensions of the sub cells
+     * @return The sub cells per dimension, including the halo
+     */
+    inline std::array<size_t, 3> getDimensions() const { return dimensions; }
+
+    /**
+     * @brief Get the size of a sub cell
+     * @return The size of a sub cell in each dimension, 0 in z for 2D grids
+     */
+    inline std::array<double, 3> getCellSize() const { return cellSize; }
+
+    /**
+     * @brief Get the stencil of the sub cells
+     * @return The offsets of the neighbours every sub cell is paired with
+     */
+    inline const std::vector<std::array<int, 3>>& getStencil() const { return stencil; }
+
+    /**
+     * @brief Returns the heap memory of the sub cells
+     * @return The bytes of all sub cells, their particle lists and the stencil
+     */
+    [[nodiscard]] size_t getMemoryBytes() const;
+
+private:
+    /**
+     * @brief Get the sub cell index of a coordinate in one dimension, clamped to the grid
+     * @param d The dimension
+     * @param coordinate The coordinate
+     * @return The sub cell index in this dimension
+     */
+    inline size_t index(size_t d, double coordinate) const
+    {
+        if (dimensions[d] == 1 || coordinate <= origin[d])
+            return 0;
+        auto i = static_cast<size_t>((coordinate - origin[d]) / cellSize[d]);
+        return i < dimensions[d] ? i : dimensions[d] - 1;
+    }
+
+    std::array<double, 3> origin; /**< The lower corner of the halo of the cell grid */
+    std::array<size_t, 3> dimensions; /**< The sub cells per dimension */
+    std::array<double, 3> cellSize; /**< The size of a sub cell per dimension */
+    std::vector<std::vector<SubCellEntry>> cells; /**< The particles per sub cell, x-major */
+    std::vector<std::array<int, 3>> stencil; /**< The half-shell offsets of the neighbours */
+};
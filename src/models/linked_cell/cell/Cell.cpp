@@ -1,5 +1,6 @@
 
 #include "Cell.h"
+#include "utils/MemoryUtils.h"
 #include <spdlog/spdlog.h>
 
 Cell::Cell(const CellIndex index)
@@ -65,6 +66,17 @@ CellType Cell::getType() const
     return type;
 }
 
+size_t Cell::getMemoryBytes() const
+{
+    size_t bytes = sizeof(Cell) + MemoryUtils::listBytes(particles);
+    for (const auto* neighbours : { &boundaryNeighbours, &haloNeighbours, &innerNeighbours }) {
+        bytes += MemoryUtils::vectorBytes(*neighbours);
+        for (const auto& neighbour : *neighbours)
+            bytes += MemoryUtils::vectorBytes(neighbour.second);
+    }
+    return bytes + MemoryUtils::vectorBytes(stencilNeighbours);
+}
+
 ParticleRefList::iterator Cell::begin()
 {
     return particles.begin();
@@ -66,6 +66,12 @@ public:
      */
     [[nodiscard]] CellType getType() const;
 
+    /**
+     * @brief Returns the heap memory of the cell.
+     * @return The bytes of the cell, its particle list and its neighbour lists.
+     */
+    [[nodiscard]] size_t getMemoryBytes() const;
+
     /**
      * @brief Returns an iterator pointing to the beginning of the particle list.
      * @return An iterator to the beginning of the particle list.
@@ -113,6 +119,10 @@ public:
     // Stencil neighbours
     std::vector<CellIndex> stencilNeighbours;
 
+    /** @brief Force calculation time of the cell in seconds, only measured if the grid records the
+     * cell load */
+    double forceTime = 0;
+
     // Forward declaration.
     class PairListIterator;
 
@@ -5,6 +5,7 @@
 #include "spdlog/spdlog.h"
 #include "utils/ArrayUtils.h"
 #include "utils/MaxwellBoltzmannDistribution.h"
+#include "utils/MemoryUtils.h"
 #include <sstream>
 
 Membrane::Membrane(
@@ -171,8 +172,9 @@ void Membrane::calculateIntraMolecularForces(const Simulation& sim)
     const MembraneSimulation& mem_sim = static_cast<const MembraneSimulation&>(sim);
     const CellGrid& cellGrid = mem_sim.getGrid();
 
-    // Calculate harmonic forces
-    calculateHarmonicForces(mem_sim.container);
+    // Calculate harmonic forces, unless they are integrated in the inner steps
+    if (mem_sim.getRespaSteps() <= 1)
+        calculateHarmonicForces(mem_sim.container);
 
     // Calculate repulsive-LJ forces for the membrane particles to avoid self-penetration
     // See forceCal.h for the same structure
@@ -253,6 +255,40 @@ void Membrane::calculateHarmonicForces(ParticleContainer& container)
                         container.particles[pair.first], container.particles[neighbor], k, diagR0);
 }
 
+void Membrane::calculateBondedForces(
+    const ParticleContainer& container, std::vector<std::array<double, 3>>& forces) const
+{
+    // the same forces as harmonic_calc, but into the buffer
+    auto addForce = [&](size_t id1, size_t id2, double equilibrium) {
+        const Particle& p1 = container.particles[id1];
+        const Particle& p2 = container.particles[id2];
+        if (!p1.getActivity() || !p2.getActivity())
+            return;
+        double dist = ArrayUtils::L2Norm(p1.getX() - p2.getX());
+        std::array<double, 3> force = (k * (dist - equilibrium) / dist) * (p2.getX() - p1.getX());
+        forces[id1] = forces[id1] + force;
+        forces[id2] = forces[id2] - force;
+    };
+
+    for (const auto& pair : directNeighbors)
+        for (size_t neighbor : pair.second)
+            addForce(pair.first, neighbor, r0);
+    for (const auto& pair : diagNeighbors)
+        for (size_t neighbor : pair.second)
+            addForce(pair.first, neighbor, diagR0);
+}
+
+size_t Membrane::getTopologyBytes() const
+{
+    size_t bytes = MemoryUtils::mapBytes(directNeighbors) + MemoryUtils::mapBytes(diagNeighbors)
+        + MemoryUtils::mapBytes(neighboringRelations);
+    for (const auto* neighbors : { &directNeighbors, &diagNeighbors }) {
+        for (const auto& entry : *neighbors)
+            bytes += MemoryUtils::vectorBytes(entry.second);
+    }
+    return bytes;
+}
+
 bool Membrane::isNeighbor(size_t particleID1, size_t particleID2)
 {
     return neighboringRelations.find(getKey(particleID1, particleID2)) !=
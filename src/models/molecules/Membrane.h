@@ -61,10 +61,19 @@ public:
 
     /**
      * @brief Calculate the membrane specific intra-molecular forces using the harmonic potential
+     * @details The harmonic forces are left out if the simulation integrates them in inner steps
      * @param sim The simulation to calculate the forces for
      */
     void calculateIntraMolecularForces(const Simulation& sim) override;
 
+    /**
+     * @brief Add the harmonic forces of the membrane to a force buffer
+     * @param container The container of the particles
+     * @param forces The forces indexed by particle ID
+     */
+    void calculateBondedForces(const ParticleContainer& container,
+        std::vector<std::array<double, 3>>& forces) const override;
+
     /**
      * @brief Get the string representation of the membrane
      * @return The string representation of the membrane
@@ -83,6 +92,12 @@ public:
      */
     [[nodiscard]] const NeighborParticleMap& getDiagNeighbors() const { return diagNeighbors; }
 
+    /**
+     * @brief Get the heap memory of the neighbor maps
+     * @return The bytes of the direct and diagonal neighbors and the neighboring relations
+     */
+    [[nodiscard]] size_t getTopologyBytes() const override;
+
 protected:
     /**
      * Idea: Only store the neighbors TOP, TOP-RIGHT, RIGHT, BOTTOM-RIGHT
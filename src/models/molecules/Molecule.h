@@ -37,6 +37,17 @@ public:
      */
     virtual void calculateIntraMolecularForces(const Simulation& sim) = 0;
 
+    /**
+     * @brief Add the bonded forces of the molecule to a force buffer instead of the particles,
+     * used for the inner steps of multiple time stepping
+     * @param container The container of the particles
+     * @param forces The forces indexed by particle ID
+     */
+    virtual void calculateBondedForces(
+        const ParticleContainer& container, std::vector<std::array<double, 3>>& forces) const
+    {
+    }
+
     /**
      * @brief Initialize the Lennard-Jones parameters for the membrane
      * @param epsilon The epsilon value
@@ -50,6 +61,12 @@ public:
      */
     [[nodiscard]] unsigned getPtype() const { return ptype; }
 
+    /**
+     * @brief Get the heap memory of the topology of the molecule (e.g. its neighbor maps)
+     * @return The bytes of the topology
+     */
+    [[nodiscard]] virtual size_t getTopologyBytes() const { return 0; }
+
 protected:
     unsigned ptype; /**< The particle type */
     double alpha; /**< The alpha value for the LJ potential */
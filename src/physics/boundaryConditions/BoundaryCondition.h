@@ -62,6 +62,18 @@ public:
         return relevantDimension;
     }
 
+    /**
+     * @brief Get the position of the boundary condition
+     * @return The position of the boundary
+     */
+    inline Position getPosition() const { return position; }
+
+    /**
+     * @brief Get the heap memory of the ghost particles the boundary inserts into the halo
+     * @return The bytes of the ghost particles, 0 if the boundary inserts none
+     */
+    virtual size_t getGhostBytes() const { return 0; }
+
 protected:
     Position position; /**< The position of the boundary condition */
 };
@@ -1,4 +1,5 @@
 #include "physics/boundaryConditions/BoundaryConditionHandler.h"
+#include "analytics/Tracer.h"
 #include "physics/boundaryConditions/BoundaryConfig.h"
 #include "physics/boundaryConditions/OverflowBoundary.h"
 #include "physics/boundaryConditions/PeriodicBoundary.h"
@@ -53,6 +54,9 @@ BoundaryConditionHandler::BoundaryConditionHandler(
             boundaryConditions.push_back(
                 std::make_unique<PeriodicBoundary>(position, boundaryConfig, cellGrid));
             break;
+        case BoundaryType::RANK:
+            // the halo of this side is exchanged with the neighboring rank
+            break;
         default:
             spdlog::error("Boundary type not recognized.");
             exit(EXIT_FAILURE);
@@ -64,6 +68,7 @@ void BoundaryConditionHandler::preUpdateBoundaryHandling(Simulation& simulation)
 {
     spdlog::debug("preUpdateBoundaryHandling...");
     for (auto& bc : boundaryConditions) {
+        TraceScope scope("preUpdate", "boundary", bc->getPosition());
         bc->preUpdateBoundaryHandling(simulation);
     }
 }
@@ -72,6 +77,15 @@ void BoundaryConditionHandler::postUpdateBoundaryHandling(Simulation& simulation
 {
     spdlog::debug("postUpdateBoundaryHandling...");
     for (auto& bc : boundaryConditions) {
+        TraceScope scope("postUpdate", "boundary", bc->getPosition());
         bc->postUpdateBoundaryHandling(simulation);
     }
 }
+
+size_t BoundaryConditionHandler::getGhostBytes() const
+{
+    size_t bytes = 0;
+    for (const auto& bc : boundaryConditions)
+        bytes += bc->getGhostBytes();
+    return bytes;
+}
@@ -34,6 +34,12 @@ public:
      */
     void postUpdateBoundaryHandling(Simulation& simulation);
 
+    /**
+     * @brief Get the heap memory of the ghost particles of all boundary conditions
+     * @return The bytes of the ghost particles
+     */
+    size_t getGhostBytes() const;
+
     /** The dimensionality of the simulation as by the provided boundaries */
     size_t dimensionality;
 
@@ -5,7 +5,11 @@
 #include <spdlog/spdlog.h>
 #include <string>
 
-enum class BoundaryType { OUTFLOW, SOFT_REFLECTIVE, PERIODIC };
+/**
+ * @brief The types of boundaries. RANK marks a side shared with another MPI rank, whose halo is
+ * filled by the DomainDecomposition instead of a boundary condition
+ */
+enum class BoundaryType { OUTFLOW, SOFT_REFLECTIVE, PERIODIC, RANK };
 
 class BoundaryConfig {
 public:
@@ -63,6 +67,8 @@ inline std::string getBoundaryString(const BoundaryType type)
         return "soft_reflective";
     } else if (type == BoundaryType::PERIODIC) {
         return "periodic";
+    } else if (type == BoundaryType::RANK) {
+        return "rank";
     } else {
         spdlog::warn("Unknown boundary type, choosing OUTFLOW");
         return "overflow";
@@ -83,6 +89,8 @@ inline size_t boundaryToPriority(const BoundaryType& type)
         return 1;
     case BoundaryType::SOFT_REFLECTIVE:
         return 2;
+    case BoundaryType::RANK:
+        return 3;
     default:
         spdlog::error("Boundary type not recognized. Its priority has not been specified.");
         throw std::invalid_argument("Boundary type not recognized");
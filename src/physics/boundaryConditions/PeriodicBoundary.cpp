@@ -2,6 +2,7 @@
 #include "PeriodicBoundary.h"
 #include "simulation/LennardJonesDomainSimulation.h"
 #include "utils/ArrayUtils.h"
+#include "utils/MemoryUtils.h"
 
 PeriodicBoundary::PeriodicBoundary(
     Position position, const BoundaryConfig& boundaryConfig, const CellGrid& cellGrid)
@@ -244,3 +245,9 @@ bool PeriodicBoundary::isThisSideResponsibleForShifts(
     // This side is responsible, if it is the first periodic side
     return boundarySides[i] == position;
 }
+
+size_t PeriodicBoundary::getGhostBytes() const
+{
+    return MemoryUtils::vectorBytes(insertedParticles)
+        + insertedParticles.size() * sizeof(Particle);
+}
@@ -56,6 +56,12 @@ public:
      */
     MultiDimPeriodicBoundShiftsMap getTranslationMap() const { return translationMap; }
 
+    /**
+     * @brief Get the heap memory of the inserted halo particles, which are kept for recycling
+     * @return The bytes of the inserted particles
+     */
+    size_t getGhostBytes() const override;
+
 private:
     std::vector<std::unique_ptr<Particle>>
         insertedParticles; /**< The particles that were inserted. These will be recycled */
@@ -1,9 +1,15 @@
 
 #include "physics/forceCal/forceCal.h"
+#include "analytics/CellLoad.h"
+#include "analytics/Tracer.h"
 #include "models/linked_cell/CellGrid.h"
+#include "models/linked_cell/LoadBalancer.h"
 #include "simulation/MembraneSimulation.h"
 #include "simulation/baseSimulation.h"
 #include "utils/ArrayUtils.h"
+#include "utils/WorkStealing.h"
+#include <chrono>
+#include <omp.h>
 #include <sys/wait.h>
 
 void force_gravity(const Simulation& sim)
@@ -119,6 +125,10 @@ void force_lennard_jones_lc(const Simulation& sim)
 #pragma omp parallel for collapse(2)
     for (size_t x = 1; x < cellGrid.cells.size() - 1; ++x) {
         for (size_t y = 1; y < cellGrid.cells[0].size() - 1; ++y) {
+            // the 0-based index of the inner column, like the other kernels
+            const size_t ySize = cellGrid.cells[0].size();
+            TraceScope scope(
+                "cellColumn", "force", static_cast<int64_t>((x - 1) * (ySize - 2) + y - 1));
             // This bool controls the 2D case, where we do need to calc the forces
             // This will be true iff the simulation is 2D
             // Then the condition of the loop will be true and the loop will be executed
@@ -129,6 +139,7 @@ void force_lennard_jones_lc(const Simulation& sim)
                     doLoopFor2D = false; // only do it once
                     z = 0;
                 }
+                CellLoadScope load(cellGrid, *cellGrid.cells[x][y][z]);
                 std::list<CellIndex> neighbors = cellGrid.getNeighbourCells({ x, y, z });
 
                 // calculate the LJ forces in the cell
@@ -164,6 +175,63 @@ void force_lennard_jones_lc(const Simulation& sim)
     cellGrid.postCalcSetup();
 }
 
+namespace {
+
+/**
+ * @brief Calculate the mixed LJ forces of the particles of a cell with each other and with the
+ * particles of its stencil neighbours
+ * @param len_sim The simulation
+ * @param cellGrid The grid of the simulation
+ * @param x The x index of the cell
+ * @param y The y index of the cell
+ * @param z The z index of the cell
+ */
+void mixed_LJ_cell(
+    const MixedLJSimulation& len_sim, const CellGrid& cellGrid, size_t x, size_t y, size_t z)
+{
+    CellLoadScope load(cellGrid, *cellGrid.cells[x][y][z]);
+
+    auto& neighbours = cellGrid.cells.at(x).at(y).at(z)->stencilNeighbours;
+
+    // calculate the LJ forces in the cell
+    for (auto it = cellGrid.cells.at(x).at(y).at(z)->beginPairs();
+         it != cellGrid.cells.at(x).at(y).at(z)->endPairs();
+         ++it) {
+        auto pair = *it;
+        std::array<double, 3> delta = pair.first.get().getX() - pair.second.get().getX();
+        // check if the distance is less than the cutoff
+        if (ArrayUtils::DotProduct(delta) <= len_sim.getGrid().cutoffRadiusSquared) {
+            const int type1 = pair.first.get().getType();
+            const int type2 = pair.second.get().getType();
+            double alpha = len_sim.getAlpha(type1, type2);
+            double beta = len_sim.getBeta(type1, type2);
+            double gamma = len_sim.getGamma(type1, type2);
+            lj_calc(pair.first, pair.second, alpha, beta, gamma, delta);
+        }
+    }
+
+    // calculate LJ forces with the neighbours
+    for (auto i : neighbours) {
+        // for all particles in the cell
+        for (auto p1 : cellGrid.cells.at(x).at(y).at(z)->getParticles()) {
+            // go over all particles in the neighbour
+            for (auto p2 : cellGrid.cells[i[0]][i[1]][i[2]]->getParticles()) {
+                // Check if the distance is less than the cutoff
+                std::array<double, 3> delta = p1.get().getX() - p2.get().getX();
+                if (ArrayUtils::DotProduct(delta) <= len_sim.getGrid().cutoffRadiusSquared) {
+                    // then calculate the force
+                    double alpha = len_sim.getAlpha(p1.get().getType(), p2.get().getType());
+                    double beta = len_sim.getBeta(p1.get().getType(), p2.get().getType());
+                    double gamma = len_sim.getGamma(p1.get().getType(), p2.get().getType());
+                    lj_calc(p1, p2, alpha, beta, gamma, delta);
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
 void force_mixed_LJ_gravity_lc(const Simulation& sim)
 {
     const MixedLJSimulation& len_sim = static_cast<const MixedLJSimulation&>(sim);
@@ -175,11 +243,12 @@ void force_mixed_LJ_gravity_lc(const Simulation& sim)
     size_t xSize = cellGrid.cells.size();
     size_t ySize = cellGrid.cells[0].size();
 
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
     // for all cells in the grid
     for (size_t index = 0; index < (xSize - 2) * (ySize - 2); ++index) {
         size_t x = index / (ySize - 2) + 1;
         size_t y = index % (ySize - 2) + 1;
+        TraceScope scope("cellColumn", "force", static_cast<int64_t>(index));
         // This bool controls the 2D case, where we do need to calc the forces
         // This will be true iff the simulation is 2D
         // Then the condition of the loop will be true and the loop will be executed
@@ -195,46 +264,7 @@ void force_mixed_LJ_gravity_lc(const Simulation& sim)
                 doLoopFor2D = false; // only do it once
                 z = 0;
             }
-
-            auto& neighbours = cellGrid.cells.at(x).at(y).at(z)->stencilNeighbours;
-
-            // calculate the LJ forces in the cell
-            for (auto it = cellGrid.cells.at(x).at(y).at(z)->beginPairs();
-                 it != cellGrid.cells.at(x).at(y).at(z)->endPairs();
-                 ++it) {
-                auto pair = *it;
-                std::array<double, 3> delta = pair.first.get().getX() - pair.second.get().getX();
-                // check if the distance is less than the cutoff
-                if (ArrayUtils::DotProduct(delta) <= len_sim.getGrid().cutoffRadiusSquared) {
-                    double alpha =
-                        len_sim.getAlpha(pair.first.get().getType(), pair.second.get().getType());
-                    double beta =
-                        len_sim.getBeta(pair.first.get().getType(), pair.second.get().getType());
-                    double gamma =
-                        len_sim.getGamma(pair.first.get().getType(), pair.second.get().getType());
-                    lj_calc(pair.first, pair.second, alpha, beta, gamma, delta);
-                }
-            }
-
-            // calculate LJ forces with the neighbours
-            for (auto i : neighbours) {
-                // for all particles in the cell
-                for (auto p1 : cellGrid.cells.at(x).at(y).at(z)->getParticles()) {
-                    // go over all particles in the neighbour
-                    for (auto p2 : cellGrid.cells[i[0]][i[1]][i[2]]->getParticles()) {
-                        // Check if the distance is less than the cutoff
-                        std::array<double, 3> delta = p1.get().getX() - p2.get().getX();
-                        if (ArrayUtils::DotProduct(delta) <=
-                            len_sim.getGrid().cutoffRadiusSquared) {
-                            // then calculate the force
-                            double alpha = len_sim.getAlpha(p1.get().getType(), p2.get().getType());
-                            double beta = len_sim.getBeta(p1.get().getType(), p2.get().getType());
-                            double gamma = len_sim.getGamma(p1.get().getType(), p2.get().getType());
-                            lj_calc(p1, p2, alpha, beta, gamma, delta);
-                        }
-                    }
-                }
-            }
+            mixed_LJ_cell(len_sim, cellGrid, x, y, z);
         }
     }
 }
@@ -264,65 +294,202 @@ void force_mixed_LJ_gravity_lc_task(const Simulation& sim)
                 bool doLoopFor2D = cellGrid.cells[0][0].size() == 1;
 
 // Create a task for each cell
-#pragma omp task firstprivate(x, y, doLoopFor2D)
+#pragma omp task firstprivate(x, y, doLoopFor2D, index)
                 {
+                    TraceScope scope("cellTask", "force", static_cast<int64_t>(index));
                     for (size_t z = 1; z < cellGrid.cells[0][0].size() - 1 || doLoopFor2D; ++z) {
                         if (doLoopFor2D) {
                             doLoopFor2D = false; // only do it once
                             z = 0;
                         }
+                        mixed_LJ_cell(len_sim, cellGrid, x, y, z);
+                    }
+                }
+            }
+        }
+    }
+}
 
-                        auto& neighbours = cellGrid.cells.at(x).at(y).at(z)->stencilNeighbours;
+void force_mixed_LJ_gravity_lc_balanced(const Simulation& sim)
+{
+    const MixedLJSimulation& len_sim = static_cast<const MixedLJSimulation&>(sim);
+    const CellGrid& cellGrid = len_sim.getGrid();
 
-                        // Calculate the LJ forces in the cell
-                        for (auto it = cellGrid.cells.at(x).at(y).at(z)->beginPairs();
-                             it != cellGrid.cells.at(x).at(y).at(z)->endPairs();
-                             ++it) {
-                            auto pair = *it;
-                            std::array<double, 3> delta =
-                                pair.first.get().getX() - pair.second.get().getX();
-                            // Check if the distance is less than the cutoff
-                            if (ArrayUtils::DotProduct(delta) <=
-                                len_sim.getGrid().cutoffRadiusSquared) {
-                                double alpha = len_sim.getAlpha(
-                                    pair.first.get().getType(), pair.second.get().getType());
-                                double beta = len_sim.getBeta(
-                                    pair.first.get().getType(), pair.second.get().getType());
-                                double gamma = len_sim.getGamma(
-                                    pair.first.get().getType(), pair.second.get().getType());
-                                lj_calc(pair.first, pair.second, alpha, beta, gamma, delta);
-                            }
-                        }
+    cellGrid.preCalcSetupGravity(len_sim.container, len_sim.getGravityConstant());
+    spdlog::debug("Calculating forces...");
 
-                        // Calculate LJ forces with the neighbours
-                        for (auto i : neighbours) {
-                            // For all particles in the cell
-                            for (auto p1 : cellGrid.cells.at(x).at(y).at(z)->getParticles()) {
-                                // Go over all particles in the neighbour
-                                for (auto p2 : cellGrid.cells[i[0]][i[1]][i[2]]->getParticles()) {
-                                    // Check if the distance is less than the cutoff
-                                    std::array<double, 3> delta = p1.get().getX() - p2.get().getX();
-                                    if (ArrayUtils::DotProduct(delta) <=
-                                        len_sim.getGrid().cutoffRadiusSquared) {
-                                        // Then calculate the force
-                                        double alpha = len_sim.getAlpha(
-                                            p1.get().getType(), p2.get().getType());
-                                        double beta =
-                                            len_sim.getBeta(p1.get().getType(), p2.get().getType());
-                                        double gamma = len_sim.getGamma(
-                                            p1.get().getType(), p2.get().getType());
-                                        lj_calc(p1, p2, alpha, beta, gamma, delta);
-                                    }
-                                }
-                            }
-                        }
+    LoadBalancer& balancer = *cellGrid.balancer;
+    balancer.update(cellGrid, static_cast<size_t>(omp_get_max_threads()));
+    const std::vector<ColumnBlock>& blocks = balancer.getBlocks();
+    // a 2D grid has a single layer of cells at z = 0
+    const size_t zSize = cellGrid.cells[0][0].size();
+    const size_t zBegin = zSize == 1 ? 0 : 1;
+    const size_t zEnd = zSize == 1 ? 1 : zSize - 1;
+
+#pragma omp parallel num_threads(static_cast<int>(blocks.size()))
+    // every thread calculates its block, or several if the runtime provides fewer threads
+    for (auto b = static_cast<size_t>(omp_get_thread_num()); b < blocks.size();
+         b += static_cast<size_t>(omp_get_num_threads())) {
+        TraceScope scope("cellBlock", "force", static_cast<int64_t>(b));
+        const ColumnBlock& block = blocks[b];
+        for (size_t x = block.xBegin; x < block.xEnd; ++x) {
+            for (size_t y = block.yBegin; y < block.yEnd; ++y) {
+                auto start = std::chrono::steady_clock::now();
+                for (size_t z = zBegin; z < zEnd; ++z)
+                    mixed_LJ_cell(len_sim, cellGrid, x, y, z);
+                balancer.addCost(x,
+                    y,
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+                        .count());
+            }
+        }
+    }
+}
+
+void force_mixed_LJ_gravity_lc_stealing(const Simulation& sim)
+{
+    const MixedLJSimulation& len_sim = static_cast<const MixedLJSimulation&>(sim);
+    const CellGrid& cellGrid = len_sim.getGrid();
+
+    cellGrid.preCalcSetupGravity(len_sim.container, len_sim.getGravityConstant());
+    spdlog::debug("Calculating forces...");
+
+    size_t xSize = cellGrid.cells.size();
+    size_t ySize = cellGrid.cells[0].size();
+    // a 2D grid has a single layer of cells at z = 0
+    const size_t zSize = cellGrid.cells[0][0].size();
+    const size_t zBegin = zSize == 1 ? 0 : 1;
+    const size_t zEnd = zSize == 1 ? 1 : zSize - 1;
+
+    // a column costs about its particles, every cell adds some overhead even if it is empty
+    std::vector<size_t> weights((xSize - 2) * (ySize - 2));
+    for (size_t index = 0; index < weights.size(); ++index) {
+        size_t x = index / (ySize - 2) + 1;
+        size_t y = index % (ySize - 2) + 1;
+        for (size_t z = zBegin; z < zEnd; ++z)
+            weights[index] += cellGrid.cells[x][y][z]->getParticles().size() + 1;
+    }
+
+    WorkStealingScheduler scheduler;
+    scheduler.run(weights, [&](size_t index) {
+        size_t x = index / (ySize - 2) + 1;
+        size_t y = index % (ySize - 2) + 1;
+        TraceScope scope("cellColumn", "force", static_cast<int64_t>(index));
+        for (size_t z = zBegin; z < zEnd; ++z)
+            mixed_LJ_cell(len_sim, cellGrid, x, y, z);
+    });
+    spdlog::debug("Stole {} of {} chunks of cell columns",
+        scheduler.getSteals(),
+        scheduler.getChunkCount());
+}
+
+void force_mixed_LJ_gravity_levels(const Simulation& sim)
+{
+    const MixedLJSimulation& len_sim = static_cast<const MixedLJSimulation&>(sim);
+    const CellGrid& cellGrid = len_sim.getGrid();
+    MultiLevelGrid& levels = *len_sim.getLevels();
+
+    cellGrid.preCalcSetupGravity(len_sim.container, len_sim.getGravityConstant());
+    levels.rebuild(cellGrid);
+    spdlog::debug("Calculating forces on {} cell levels...", levels.getLevels().size());
+
+    for (const CellLevel& level : levels.getLevels()) {
+#pragma omp parallel for schedule(dynamic)
+        for (size_t cell = 0; cell < level.cells.size(); ++cell) {
+            TraceScope scope("levelCell", "force", static_cast<int64_t>(cell));
+            for (const LevelEntry& owner : level.cells[cell]) {
+                if (!owner.owned)
+                    continue;
+                levels.forEachCandidate(owner, [&](const LevelEntry& other, double cutoffSquared) {
+                    std::array<double, 3> delta = owner.x - other.x;
+                    if (ArrayUtils::DotProduct(delta) <= cutoffSquared) {
+                        double alpha = len_sim.getAlpha(owner.type, other.type);
+                        double beta = len_sim.getBeta(owner.type, other.type);
+                        double gamma = len_sim.getGamma(owner.type, other.type);
+                        lj_calc(*owner.particle, *other.particle, alpha, beta, gamma, delta);
                     }
-                }
+                });
             }
         }
     }
 }
 
+void force_mixed_LJ_gravity_subcells(const Simulation& sim)
+{
+    const MixedLJSimulation& len_sim = static_cast<const MixedLJSimulation&>(sim);
+    const CellGrid& cellGrid = len_sim.getGrid();
+    SubCellGrid& subCells = *len_sim.getSubCells();
+    const double cutoffSquared = cellGrid.cutoffRadiusSquared;
+
+    cellGrid.preCalcSetupGravity(len_sim.container, len_sim.getGravityConstant());
+    subCells.rebuild(cellGrid);
+    spdlog::debug("Calculating forces on {} sub cells...", subCells.getCellCount());
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t cell = 0; cell < subCells.getCellCount(); ++cell) {
+        TraceScope scope("subCell", "force", static_cast<int64_t>(cell));
+        subCells.forEachPair(cell, [&](const SubCellEntry& p1, const SubCellEntry& p2) {
+            std::array<double, 3> delta = p1.x - p2.x;
+            if (ArrayUtils::DotProduct(delta) <= cutoffSquared) {
+                double alpha = len_sim.getAlpha(p1.type, p2.type);
+                double beta = len_sim.getBeta(p1.type, p2.type);
+                double gamma = len_sim.getGamma(p1.type, p2.type);
+                lj_calc(*p1.particle, *p2.particle, alpha, beta, gamma, delta);
+            }
+        });
+    }
+}
+
+void force_mixed_LJ_cells(
+    const Simulation& sim, const std::array<size_t, 3>& begin, const std::array<size_t, 3>& end)
+{
+    const MixedLJSimulation& len_sim = static_cast<const MixedLJSimulation&>(sim);
+    const CellGrid& cellGrid = len_sim.getGrid();
+
+    for (size_t x = begin[0]; x < end[0]; ++x) {
+        for (size_t y = begin[1]; y < end[1]; ++y) {
+            for (size_t z = begin[2]; z < end[2]; ++z) {
+                if (cellGrid.cells[x][y][z]->getType() != CellType::Halo)
+                    mixed_LJ_cell(len_sim, cellGrid, x, y, z);
+            }
+        }
+    }
+}
+
+void force_mixed_LJ_gravity_lc_overlap(
+    const Simulation& sim, const std::function<void()>& exchange)
+{
+    const MixedLJSimulation& len_sim = static_cast<const MixedLJSimulation&>(sim);
+    const CellGrid& cellGrid = len_sim.getGrid();
+    const std::vector<CellIndex>& interior = len_sim.decomposition->getInteriorCells();
+    const std::vector<CellIndex>& boundary = len_sim.decomposition->getBoundaryCells();
+
+    cellGrid.preCalcSetupGravity(len_sim.container, len_sim.getGravityConstant());
+    spdlog::debug("Calculating forces while exchanging the halos...");
+
+#pragma omp parallel
+    {
+        // only the master thread communicates (MPI_THREAD_FUNNELED), the others start with the
+        // interior cells and the master joins them once the halos are filled
+#pragma omp master
+        exchange();
+
+#pragma omp for schedule(dynamic) nowait
+        for (size_t i = 0; i < interior.size(); ++i) {
+            TraceScope scope("interiorCell", "force", static_cast<int64_t>(i));
+            mixed_LJ_cell(len_sim, cellGrid, interior[i][0], interior[i][1], interior[i][2]);
+        }
+
+        // the boundary cells need the halos
+#pragma omp barrier
+#pragma omp for schedule(dynamic)
+        for (size_t i = 0; i < boundary.size(); ++i) {
+            TraceScope scope("boundaryCell", "force", static_cast<int64_t>(i));
+            mixed_LJ_cell(len_sim, cellGrid, boundary[i][0], boundary[i][1], boundary[i][2]);
+        }
+    }
+}
+
 void force_membrane(const Simulation& sim)
 {
     const MembraneSimulation& len_sim = static_cast<const MembraneSimulation&>(sim);
@@ -343,6 +510,7 @@ void force_membrane(const Simulation& sim)
     for (size_t index = 0; index < (xSize - 2) * (ySize - 2); ++index) {
         size_t x = index / (ySize - 2) + 1;
         size_t y = index % (ySize - 2) + 1;
+        TraceScope scope("cellColumn", "force", static_cast<int64_t>(index));
 
         // This bool controls the 2D case, where we do need to calc the forces
         // This will be true iff the simulation is 2D
@@ -355,6 +523,7 @@ void force_membrane(const Simulation& sim)
                 doLoopFor2D = false; // only do it once
                 z = 0;
             }
+            CellLoadScope load(cellGrid, *cellGrid.cells[x][y][z]);
             auto& neighbours = cellGrid.cells.at(x).at(y).at(z)->stencilNeighbours;
 
             // calculate the LJ forces in the cell
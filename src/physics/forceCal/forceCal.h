@@ -1,6 +1,7 @@
 
 #pragma once
 #include "simulation/baseSimulation.h"
+#include <functional>
 
 /**
  * @brief Calculate the forces between particles using the Stroemer-Verlet algorithm
@@ -74,3 +75,54 @@ void lj_calc(
     std::array<double, 3> delta);
 
 void force_mixed_LJ_gravity_lc_task(const Simulation& sim);
+
+/**
+ * @brief Calculate the forces like force_mixed_LJ_gravity_lc, but every thread calculates the
+ * block of cell columns assigned to it by the load balancer of the grid, which measures the time
+ * of every column and moves the block boundaries periodically
+ * @param sim The simulation to calculate the forces for
+ */
+void force_mixed_LJ_gravity_lc_balanced(const Simulation& sim);
+
+/**
+ * @brief Calculate the forces like force_mixed_LJ_gravity_lc, but the cell columns are cut into
+ * chunks of about the same number of particles and idle threads steal chunks from the others
+ * @param sim The simulation to calculate the forces for
+ */
+void force_mixed_LJ_gravity_lc_stealing(const Simulation& sim);
+
+/**
+ * @brief Calculate the forces like force_mixed_LJ_gravity_lc, but with the cutoff of every pair
+ * of types, searched on the multi-level grid of the simulation
+ * @param sim The simulation to calculate the forces for, it must have type cutoffs
+ */
+void force_mixed_LJ_gravity_levels(const Simulation& sim);
+
+/**
+ * @brief Calculate the forces like force_mixed_LJ_gravity_lc, but on the sub cells of the
+ * simulation with their generated stencil
+ * @param sim The simulation to calculate the forces for, it must have a cell size factor below 1
+ */
+void force_mixed_LJ_gravity_subcells(const Simulation& sim);
+
+/**
+ * @brief Calculate the forces like force_mixed_LJ_gravity_lc for a domain decomposed simulation,
+ * while its halos are exchanged
+ * @details The master thread exchanges the halos while the other threads calculate the interior
+ * cells of the decomposition. After the exchange, all threads calculate the boundary cells.
+ * @param sim The mixed simulation, which must have a decomposition
+ * @param exchange Fills the halo cells of the exchanged sides, called by the master thread
+ */
+void force_mixed_LJ_gravity_lc_overlap(
+    const Simulation& sim, const std::function<void()>& exchange);
+
+/**
+ * @brief Calculate the LJ forces of the domain cells within a box of cells like
+ * force_mixed_LJ_gravity_lc, without resetting the forces first
+ * @details Used by the task graph step, which resets the forces of every block of cells itself
+ * @param sim The mixed simulation to calculate the forces for
+ * @param begin The first cell of the box, halo cells in it are skipped
+ * @param end The cell after the last one in every dimension
+ */
+void force_mixed_LJ_cells(
+    const Simulation& sim, const std::array<size_t, 3>& begin, const std::array<size_t, 3>& end);
@@ -0,0 +1,191 @@
+
+#include "physics/stepCal/stepCal.h"
+#include "analytics/Tracer.h"
+#include "physics/forceCal/forceCal.h"
+#include "simulation/MixedLJSimulation.h"
+#include "utils/ArrayUtils.h"
+#include "utils/TaskGraph.h"
+#include <omp.h>
+#include <spdlog/spdlog.h>
+
+namespace {
+
+/**
+ * @brief A box of cells calculated by the tasks of one block
+ */
+struct CellBlock {
+    std::array<size_t, 3> begin; /**< The first cell */
+    std::array<size_t, 3> end; /**< The cell after the last one in every dimension */
+    bool halo; /**< Whether the block contains halo cells */
+};
+
+/**
+ * @brief Split the cells of a grid into blocks along the dimensions with the most cells per block
+ * @param dims The cells per dimension, including the halo
+ * @param targetBlocks The number of blocks to reach, if there are enough cells
+ * @param blockCounts The number of blocks per dimension
+ * @return The blocks, with the halo cells added to the outermost blocks, z fastest
+ */
+std::vector<CellBlock> splitGrid(
+    const std::array<size_t, 3>& dims, size_t targetBlocks, std::array<size_t, 3>& blockCounts)
+{
+    // a 2D grid has a single layer of cells without halo in z
+    const size_t dimensionality = dims[2] == 1 ? 2 : 3;
+    const std::array<size_t, 3> domain { dims[0] - 2,
+        dims[1] - 2,
+        dimensionality == 3 ? dims[2] - 2 : 1 };
+
+    blockCounts = { 1, 1, 1 };
+    while (blockCounts[0] * blockCounts[1] * blockCounts[2] < targetBlocks) {
+        size_t split = 3;
+        for (size_t d = 0; d < dimensionality; ++d) {
+            if (blockCounts[d] < domain[d]
+                && (split == 3
+                    || domain[d] * blockCounts[split] > domain[split] * blockCounts[d]))
+                split = d;
+        }
+        if (split == 3)
+            break;
+        ++blockCounts[split];
+    }
+
+    std::array<std::vector<size_t>, 3> edges;
+    for (size_t d = 0; d < 3; ++d) {
+        if (d == 2 && dimensionality == 2) {
+            edges[d] = { 0, 1 };
+            continue;
+        }
+        for (size_t b = 0; b <= blockCounts[d]; ++b)
+            edges[d].push_back(1 + domain[d] * b / blockCounts[d]);
+        edges[d].front() = 0;
+        edges[d].back() = dims[d];
+    }
+
+    std::vector<CellBlock> blocks;
+    for (size_t i = 0; i < blockCounts[0]; ++i) {
+        for (size_t j = 0; j < blockCounts[1]; ++j) {
+            for (size_t k = 0; k < blockCounts[2]; ++k) {
+                CellBlock block { { edges[0][i], edges[1][j], edges[2][k] },
+                                  { edges[0][i + 1], edges[1][j + 1], edges[2][k + 1] },
+                                  false };
+                for (size_t d = 0; d < dimensionality; ++d)
+                    block.halo |= block.begin[d] == 0 || block.end[d] == dims[d];
+                blocks.push_back(block);
+            }
+        }
+    }
+    return blocks;
+}
+
+/**
+ * @brief Call a function for every particle in the cells of a block
+ * @param grid The grid of the cells
+ * @param block The block
+ * @param halo Whether to include the halo cells of the block
+ * @param function The function to call with every particle
+ */
+template <typename Function>
+void forEachParticle(const CellGrid& grid, const CellBlock& block, bool halo, Function&& function)
+{
+    for (size_t x = block.begin[0]; x < block.end[0]; ++x) {
+        for (size_t y = block.begin[1]; y < block.end[1]; ++y) {
+            for (size_t z = block.begin[2]; z < block.end[2]; ++z) {
+                if (!halo && grid.cells[x][y][z]->getType() == CellType::Halo)
+                    continue;
+                for (auto& particle : grid.cells[x][y][z]->getParticles())
+                    function(particle.get());
+            }
+        }
+    }
+}
+
+/**
+ * @brief Reset the force of a particle to its gravity like CellGrid::preCalcSetupGravity
+ * @param p The particle, the ghosts of the boundaries are inactive and keep their forces
+ * @param g The gravity constant
+ */
+inline void resetForce(Particle& p, double g)
+{
+    if (p.getActivity())
+        p.resetF({ 0, g * p.getM(), 0 });
+}
+
+} // namespace
+
+void step_mixed_LJ_task_graph(Simulation& sim)
+{
+    MixedLJSimulation& len_sim = static_cast<MixedLJSimulation&>(sim);
+    const CellGrid& cellGrid = len_sim.getGrid();
+    const double g = len_sim.getGravityConstant();
+    const double delta_t = len_sim.delta_t;
+    spdlog::debug("Calculating the time step as a task graph...");
+
+    std::array<size_t, 3> counts {};
+    const std::vector<CellBlock> blocks = splitGrid(
+        cellGrid.getGridDimensions(), 4 * static_cast<size_t>(omp_get_max_threads()), counts);
+    auto blockId = [&](size_t i, size_t j, size_t k) {
+        return (i * counts[1] + j) * counts[2] + k;
+    };
+
+    TaskGraph graph;
+    // the boundary handling fills the halo cells, so it also resets the particles left in them
+    const size_t pre = graph.addTask([&] {
+        len_sim.bcHandler.preUpdateBoundaryHandling(len_sim);
+        for (const CellIndex& index : cellGrid.getHaloCells()) {
+            for (auto& particle : cellGrid.cells[index[0]][index[1]][index[2]]->getParticles())
+                resetForce(particle.get(), g);
+        }
+    });
+    std::vector<size_t> reset(blocks.size());
+    std::vector<size_t> force(blocks.size());
+    std::vector<size_t> update(blocks.size());
+    for (size_t b = 0; b < blocks.size(); ++b) {
+        const CellBlock& block = blocks[b];
+        reset[b] = graph.addTask([&, b] {
+            TraceScope scope("blockReset", "taskGraph", static_cast<int64_t>(b));
+            forEachParticle(cellGrid, block, false, [&](Particle& p) { resetForce(p, g); });
+        });
+        force[b] = graph.addTask([&, b] {
+            TraceScope scope("blockForce", "taskGraph", static_cast<int64_t>(b));
+            force_mixed_LJ_cells(len_sim, block.begin, block.end);
+        });
+        update[b] = graph.addTask([&, b] {
+            TraceScope scope("blockUpdate", "taskGraph", static_cast<int64_t>(b));
+            forEachParticle(cellGrid, block, true, [&](Particle& p) {
+                if (p.getIsNotStationary() && p.getActivity()) {
+                    // v = v + Δt * (F + F_old) / (2 * m)
+                    p.setV(p.getV() + (delta_t / (2 * p.getM())) * (p.getOldF() + p.getF()));
+                    // x = x + Δt * v + (Δt)^2 * F / (2 * m)
+                    p.setX(p.getX() + delta_t * p.getV()
+                        + (delta_t * delta_t / (2 * p.getM())) * p.getF());
+                }
+            });
+        });
+        if (block.halo)
+            graph.addDependency(pre, force[b]);
+    }
+    const size_t post =
+        graph.addTask([&] { len_sim.bcHandler.postUpdateBoundaryHandling(len_sim); });
+
+    // the stencil of a cell reaches the cells next to it, i.e. at most the neighboring blocks
+    for (size_t i = 0; i < counts[0]; ++i) {
+        for (size_t j = 0; j < counts[1]; ++j) {
+            for (size_t k = 0; k < counts[2]; ++k) {
+                const size_t b = blockId(i, j, k);
+                for (size_t ni = i ? i - 1 : i; ni <= std::min(i + 1, counts[0] - 1); ++ni) {
+                    for (size_t nj = j ? j - 1 : j; nj <= std::min(j + 1, counts[1] - 1); ++nj) {
+                        for (size_t nk = k ? k - 1 : k; nk <= std::min(k + 1, counts[2] - 1);
+                             ++nk) {
+                            graph.addDependency(reset[blockId(ni, nj, nk)], force[b]);
+                            graph.addDependency(force[blockId(ni, nj, nk)], update[b]);
+                        }
+                    }
+                }
+                if (blocks[b].halo)
+                    graph.addDependency(update[b], post);
+            }
+        }
+    }
+
+    graph.run();
+}
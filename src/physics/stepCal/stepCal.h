@@ -0,0 +1,18 @@
+
+#pragma once
+#include "simulation/baseSimulation.h"
+
+/**
+ * @brief Calculate a whole time step of a mixed LJ simulation as a task graph
+ * @details The cells are split into blocks of about four per thread. The boundary handling before
+ * the forces, the forces of every block, the velocities and positions of every block and the
+ * boundary handling after the positions are tasks that start as soon as the tasks they depend on
+ * have finished:
+ * - the forces of a block wait for the reset forces of the neighboring blocks and, if the block
+ * touches a halo, for the boundary handling, so the inner blocks run while the ghosts are created
+ * - the velocities and positions of a block wait for the forces of the neighboring blocks, which
+ * add forces to its particles and read their positions
+ * - the boundary handling after the update waits for the blocks touching a halo only
+ * @param sim The mixed simulation, which must not be domain decomposed
+ */
+void step_mixed_LJ_task_graph(Simulation& sim);
@@ -2,6 +2,7 @@
 #include "physics/stratFactory.h"
 #include "physics/forceCal/forceCal.h"
 #include "physics/locationCal/locationCal.h"
+#include "physics/stepCal/stepCal.h"
 #include "physics/strategy.h"
 #include "physics/velocityCal/velocityCal.h"
 #include <spdlog/spdlog.h>
@@ -29,6 +30,25 @@ PhysicsStrategy stratFactory(SimulationType simulation_type, ParallelType parall
                      velocity_stroemer_verlet,
                      force_mixed_LJ_gravity_lc };
         }
+        else if (parallel_type == ParallelType::BALANCED) {
+            spdlog::info("Parallel strategy: balanced");
+            return { location_stroemer_verlet,
+                     velocity_stroemer_verlet,
+                     force_mixed_LJ_gravity_lc_balanced };
+        }
+        else if (parallel_type == ParallelType::STEALING) {
+            spdlog::info("Parallel strategy: stealing");
+            return { location_stroemer_verlet,
+                     velocity_stroemer_verlet,
+                     force_mixed_LJ_gravity_lc_stealing };
+        }
+        else if (parallel_type == ParallelType::GRAPH) {
+            spdlog::info("Parallel strategy: graph");
+            return { location_stroemer_verlet,
+                     velocity_stroemer_verlet,
+                     force_mixed_LJ_gravity_lc,
+                     step_mixed_LJ_task_graph };
+        }
         else {
             spdlog::info("Parallel strategy: task");
             return { location_stroemer_verlet,
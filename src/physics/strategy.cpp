@@ -5,9 +5,11 @@
 PhysicsStrategy::PhysicsStrategy(
     std::function<void(const Simulation&)> calX,
     std::function<void(const Simulation&)> calV,
-    std::function<void(const Simulation&)> calF)
+    std::function<void(const Simulation&)> calF,
+    std::function<void(Simulation&)> step)
 {
     this->calX = calX;
     this->calV = calV;
     this->calF = calF;
+    this->step = step;
 }
@@ -19,12 +19,14 @@ public:
      * @param calX The function to calculate the position from the passed simulation
      * @param calV The function to calculate the velocity from the passed simulation
      * @param calF The function to calculate the force from the passed simulation
+     * @param step The function to calculate a whole time step, empty to use the others
      * @return PhysicsStrategy object
      */
     PhysicsStrategy(
         std::function<void(const Simulation&)> calX,
         std::function<void(const Simulation&)> calV,
-        std::function<void(const Simulation&)> calF);
+        std::function<void(const Simulation&)> calF,
+        std::function<void(Simulation&)> step = nullptr);
 
     /**
      * @brief Function to calculate the positions within the simulation
@@ -38,4 +40,9 @@ public:
      * @brief Function to calculate the forces within the simulation
      */
     std::function<void(const Simulation&)> calF;
+    /**
+     * @brief Function to calculate the boundary handling, forces, velocities and positions of a
+     * time step at once, only used by the simulations supporting it if set
+     */
+    std::function<void(Simulation&)> step;
 };
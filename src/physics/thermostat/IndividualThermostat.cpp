@@ -1,6 +1,7 @@
 
 #include "IndividualThermostat.h"
 #include "utils/ArrayUtils.h"
+#include "utils/MPIUtils.h"
 #include <spdlog/spdlog.h>
 
 IndividualThermostat::IndividualThermostat(double init, double target, double delta, size_t dim)
@@ -15,10 +16,10 @@ void IndividualThermostat::updateT(Simulation& sim)
     if (!isInitialized)
         initialize(sim);
 
-    // Calculate current Temperature
-    double T_current =
-        getTotalKineticEnergy(sim) /
-        static_cast<double>((sim.container.activeParticleCount - numFixParticles) * dim);
+    // Calculate current Temperature of the particles of all ranks
+    const size_t count = MPIUtils::sum(
+        static_cast<size_t>(sim.container.activeParticleCount - numFixParticles));
+    double T_current = MPIUtils::sum(getTotalKineticEnergy(sim)) / static_cast<double>(count * dim);
 
     double beta = getBeta(T_current);
 
@@ -48,9 +49,9 @@ std::array<double, 3> IndividualThermostat::getMeanVelocity(Simulation& sim) con
         if (p.getActivity() && p.getIsNotStationary())
             meanVelocity = meanVelocity + p.getV();
 
-    meanVelocity =
-        (1.0 / static_cast<double>(sim.container.activeParticleCount - numFixParticles)) *
-        meanVelocity;
+    const size_t count = MPIUtils::sum(
+        static_cast<size_t>(sim.container.activeParticleCount - numFixParticles));
+    meanVelocity = (1.0 / static_cast<double>(count)) * MPIUtils::sum(meanVelocity);
     return meanVelocity;
 }
 
@@ -1,6 +1,7 @@
 
 #include "Thermostat.h"
 #include "utils/ArrayUtils.h"
+#include "utils/MPIUtils.h"
 #include "utils/MaxwellBoltzmannDistribution.h"
 #include <cmath>
 #include <spdlog/spdlog.h>
@@ -22,9 +23,9 @@ void Thermostat::initializeBrownianMotion(Simulation& sim) const
 
 void Thermostat::updateT(Simulation& sim)
 {
-    // Calculate current Temperature
-    double T_current =
-        getTotalKineticEnergy(sim) / (double)(sim.container.activeParticleCount * dim);
+    // Calculate current Temperature of the particles of all ranks
+    const size_t count = MPIUtils::sum(static_cast<size_t>(sim.container.activeParticleCount));
+    double T_current = MPIUtils::sum(getTotalKineticEnergy(sim)) / (double)(count * dim);
 
     double beta = getBeta(T_current);
 
@@ -0,0 +1,331 @@
+
+#include "simulation/EnsembleRunner.h"
+#include "analytics/RunReport.h"
+#include "io/argparse/argparse.h"
+#include "io/fileReader/readerFactory.h"
+#include "io/fileWriter/writerFactory.h"
+#include "io/xmlparse/xmlparse.h"
+#include "physics/stratFactory.h"
+#include "physics/strategy.h"
+#include "physics/thermostat/ThermostatFactory.h"
+#include "simulation/linkedLennardJonesSim.h"
+#include "simulation/simFactory.h"
+#include "utils/MaxwellBoltzmannDistribution.h"
+#include "utils/NumaUtils.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <getopt.h>
+#include <omp.h>
+#include <spdlog/spdlog.h>
+#include <sstream>
+
+EnsembleRunner::EnsembleRunner(
+    std::vector<std::string> baseArgs, size_t groups, PinningType pinning)
+    : baseArgs(std::move(baseArgs))
+    , groups(groups)
+    , pinning(pinning)
+{
+}
+
+std::pair<size_t, size_t> EnsembleRunner::partition(size_t runs, size_t threads, size_t groups)
+{
+    size_t count = groups > 0 ? groups : std::min(runs, threads);
+    count = std::max<size_t>(1, std::min(count, runs));
+    return { count, std::max<size_t>(1, threads / count) };
+}
+
+std::vector<std::string> EnsembleRunner::expand(const std::string& word)
+{
+    const size_t open = word.find('{');
+    const size_t close = open == std::string::npos ? open : word.find('}', open);
+    if (close == std::string::npos)
+        return { word };
+
+    std::vector<std::string> words;
+    std::stringstream values(word.substr(open + 1, close - open - 1));
+    std::string value;
+    while (std::getline(values, value, ',')) {
+        // the rest of the word may contain further braces
+        for (std::string& expanded : expand(word.substr(0, open) + value + word.substr(close + 1)))
+            words.push_back(std::move(expanded));
+    }
+    return words;
+}
+
+void EnsembleRunner::setParameter(Params& params, const std::string& name, const std::string& value)
+{
+    try {
+        if (name == "output")
+            params.output_file = value;
+        else if (name == "delta_t")
+            params.delta_t = std::stod(value);
+        else if (name == "end_time")
+            params.end_time = std::stod(value);
+        else if (name == "epsilon")
+            params.epsilon = std::stod(value);
+        else if (name == "sigma")
+            params.sigma = std::stod(value);
+        else if (name == "cutoff")
+            params.cutoff = std::stod(value);
+        else if (name == "gravity")
+            params.gravity = std::stod(value);
+        else if (name == "init_temp")
+            params.init_temp = std::stod(value);
+        else if (name == "target_temp")
+            params.target_temp = std::stod(value);
+        else if (name == "max_temp_delta")
+            params.max_temp_delta = std::stod(value);
+        else if (name == "thermo_freq")
+            params.thermo_freq = static_cast<unsigned>(std::stoul(value));
+        else if (name == "plot_frequency")
+            params.plot_frequency = static_cast<unsigned>(std::stoul(value));
+        else if (name == "update_frequency")
+            params.update_frequency = static_cast<unsigned>(std::stoul(value));
+        else if (name == "respa_steps")
+            params.setRespaSteps(static_cast<unsigned>(std::stoul(value)));
+        else if (name == "cell_size_factor")
+            params.setCellSizeFactor(std::stod(value));
+        else {
+            spdlog::error("Unknown ensemble parameter {}", name);
+            exit(EXIT_FAILURE);
+        }
+    } catch (std::logic_error& e) {
+        spdlog::error("Invalid value {} of the ensemble parameter {}", value, name);
+        exit(EXIT_FAILURE);
+    }
+}
+
+void EnsembleRunner::readList(const std::string& filename)
+{
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        spdlog::error("Error: could not open file {}", filename);
+        exit(EXIT_FAILURE);
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        const size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#')
+            continue;
+        addLine(line);
+    }
+    if (runs.empty()) {
+        spdlog::error("The ensemble list {} contains no runs", filename);
+        exit(EXIT_FAILURE);
+    }
+}
+
+void EnsembleRunner::addLine(const std::string& line)
+{
+    // every combination of the values of the braces is a run
+    std::vector<std::vector<std::string>> combinations { {} };
+    std::stringstream words(line);
+    std::string word;
+    while (words >> word) {
+        std::vector<std::vector<std::string>> extended;
+        for (const std::vector<std::string>& combination : combinations) {
+            for (const std::string& value : expand(word)) {
+                extended.push_back(combination);
+                extended.back().push_back(value);
+            }
+        }
+        combinations = std::move(extended);
+    }
+
+    for (const std::vector<std::string>& combination : combinations) {
+        EnsembleRun run;
+        run.args = baseArgs;
+        for (const std::string& value : combination) {
+            const size_t equals = value.find('=');
+            if (value[0] != '-' && equals != std::string::npos)
+                run.overrides.emplace_back(value.substr(0, equals), value.substr(equals + 1));
+            else
+                run.args.push_back(value);
+        }
+
+        // getopt keeps its position between calls, 0 restarts it
+        optind = 0;
+        std::vector<char*> argv;
+        for (std::string& arg : run.args)
+            argv.push_back(arg.data());
+        run.params = std::make_unique<Params>();
+        Params& params = *run.params;
+        // the options of a run, e.g. -l, do not change the log of the ensemble
+        const spdlog::level::level_enum level = spdlog::get_level();
+        argparse(static_cast<int>(argv.size()), argv.data(), params);
+        spdlog::set_level(level);
+        if (params.reader_type == ReaderType::XML)
+            xmlparse(params, params.input_file);
+
+        bool output = false;
+        for (const auto& [name, value] : run.overrides) {
+            setParameter(params, name, value);
+            output |= name == "output";
+        }
+        if (!output)
+            params.output_file += "_" + std::to_string(runs.size());
+        params.outName = params.output_file + "_" + params.outName;
+        if (!params.metrics_file.empty())
+            params.metrics_file += "_" + std::to_string(runs.size());
+        // the tracer and the counters record the threads of the process, which the runs share
+        if (!params.trace_file.empty() || params.perf_counters) {
+            spdlog::warn("Run {} of the ensemble ignores --trace and --counters", runs.size());
+            params.trace_file.clear();
+            params.perf_counters = false;
+        }
+        // forking within the nested parallel regions of the groups may deadlock the child
+        if (params.snapshots > 0) {
+            spdlog::warn("Run {} of the ensemble writes its output synchronously", runs.size());
+            params.snapshots = 0;
+        }
+        for (const EnsembleRun& other : runs) {
+            if (other.params->output_file == params.output_file) {
+                spdlog::error("Two runs of the ensemble write to {}", params.output_file);
+                exit(EXIT_FAILURE);
+            }
+        }
+        runs.push_back(std::move(run));
+    }
+}
+
+void EnsembleRunner::run()
+{
+    const auto [groupCount, threads] =
+        partition(runs.size(), static_cast<size_t>(omp_get_max_threads()), groups);
+    spdlog::info("Running {} simulations in {} groups of {} threads",
+        runs.size(),
+        groupCount,
+        threads);
+
+    // the nested teams inherit the CPUs of their group thread, so every group is pinned to a block
+    const std::map<int, std::vector<int>> nodes = NumaUtils::getNodes();
+    std::vector<int> order;
+    if (pinning != PinningType::UNPINNED)
+        order = NumaUtils::pinningOrder(nodes, pinning);
+    if (groupCount * threads > order.size() && !order.empty())
+        spdlog::warn("{} threads share {} CPUs", groupCount * threads, order.size());
+
+    // the simulations open their parallel regions within the region of their group
+    omp_set_max_active_levels(2);
+    std::atomic<size_t> next { 0 };
+#pragma omp parallel num_threads(static_cast<int>(groupCount))
+    {
+        const auto group = static_cast<size_t>(omp_get_thread_num());
+        if (!order.empty()) {
+            std::vector<int> block;
+            for (size_t i = group * threads; i < (group + 1) * threads; ++i)
+                block.push_back(order[i % order.size()]);
+            if (!NumaUtils::pinThread(block))
+                spdlog::warn("Thread group {} could not be pinned", group);
+        }
+        const std::vector<int> cpus = NumaUtils::getThreadCpus();
+        std::string groupNodes;
+        for (const auto& [node, nodeCpus] : nodes) {
+            if (std::any_of(cpus.begin(), cpus.end(), [&](int cpu) {
+                    return std::binary_search(nodeCpus.begin(), nodeCpus.end(), cpu);
+                }))
+                groupNodes += fmt::format("{}{}", groupNodes.empty() ? "" : ",", node);
+        }
+        spdlog::info("Thread group {} on CPUs {} of NUMA nodes {}",
+            group,
+            NumaUtils::formatCpuList(cpus),
+            groupNodes);
+
+        omp_set_num_threads(static_cast<int>(threads));
+        for (size_t index = next++; index < runs.size(); index = next++) {
+            runs[index].group = group;
+            simulate(runs[index], index);
+        }
+    }
+
+    spdlog::info("{:>4} {:>5} {:>10} {:>10} {:>8}  {}",
+        "run",
+        "group",
+        "iterations",
+        "time [s]",
+        "MUP/s",
+        "output");
+    for (size_t index = 0; index < runs.size(); ++index) {
+        const EnsembleRun& run = runs[index];
+        spdlog::info("{:>4} {:>5} {:>10} {:>10.3f} {:>8.2f}  {}",
+            index,
+            run.group,
+            run.iterations,
+            run.wallTime,
+            run.wallTime > 0 ? static_cast<double>(run.particleUpdates) / run.wallTime / 1e6 : 0.0,
+            run.params->output_file);
+    }
+}
+
+void EnsembleRunner::simulate(EnsembleRun& run, size_t index)
+{
+    Params& params = *run.params;
+    const size_t dimensions = params.domain_size[2] > 1 ? 3 : 2;
+    ParticleContainer particles {};
+    std::unique_ptr<PhysicsStrategy> strat;
+    std::unique_ptr<Simulation> sim;
+    {
+        std::lock_guard<std::mutex> lock(setupMutex);
+        spdlog::info("Starting run {} ({}) in group {}", index, params.input_file, run.group);
+        // the velocities are drawn while the input is read, so every run starts from the seed
+        resetMaxwellBoltzmannSeed();
+        strat = std::make_unique<PhysicsStrategy>(
+            stratFactory(params.simulation_type, params.parallel_type));
+        sim = simFactory(params,
+            particles,
+            *strat,
+            writerFactory(params.writer_type, params.output_file, params),
+            readerFactory(params.input_file, params.reader_type),
+            thermostatFactory(params.thermostat_type,
+                params.init_temp,
+                params.target_temp,
+                params.max_temp_delta,
+                dimensions),
+            nullptr);
+    }
+    if (params.cell_load) {
+        if (auto* linkedSim = dynamic_cast<LinkedLennardJonesSimulation*>(sim.get()))
+            linkedSim->setRecordCellLoad(true);
+        else
+            spdlog::warn("The cell load is only recorded by linked cell simulations");
+    }
+    if (params.parallel_type == ParallelType::BALANCED) {
+        if (auto* linkedSim = dynamic_cast<LinkedLennardJonesSimulation*>(sim.get()))
+            linkedSim->setBalanceInterval(params.balance_interval);
+    }
+    if (!params.metrics_file.empty()) {
+        sim->metrics = std::make_unique<MetricsExporter>(
+            params.metrics_file, params.metrics_interval, dimensions);
+    }
+    if (params.memory_report) {
+        sim->memory = std::make_unique<MemoryTracker>();
+        sim->memory->sample(*sim);
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    sim->runSim();
+    std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - startTime;
+    run.iterations = sim->iteration;
+    run.particleUpdates = sim->particleUpdates;
+    run.wallTime = wallTime.count();
+
+    if (sim->metrics)
+        sim->metrics->write(*sim);
+    if (sim->memory) {
+        sim->memory->sample(*sim);
+        // the tables of the groups would interleave
+        std::lock_guard<std::mutex> lock(setupMutex);
+        spdlog::info("Memory of run {}", index);
+        logMemoryTable({ { "peak", sim->memory->getPeak() },
+                           { "steady", sim->memory->getSteadyState() } },
+            static_cast<size_t>(particles.activeParticleCount));
+        spdlog::info("Accounted peak memory of run {}: {:.1f} MiB",
+            index,
+            static_cast<double>(sim->memory->getPeakTotal()) / (1024 * 1024));
+    }
+
+    if (params.doPerformanceMeasurements)
+        writeRunReport(params.output_file + "_report.json", *sim, params, run.wallTime);
+}
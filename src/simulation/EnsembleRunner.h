@@ -0,0 +1,114 @@
+
+#pragma once
+
+#include "utils/Params.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief A single simulation of an ensemble and its result
+ */
+struct EnsembleRun {
+    std::vector<std::string> args; /**< The command line of the run, starting with the program */
+    std::vector<std::pair<std::string, std::string>>
+        overrides; /**< The parameters set after the input file was read */
+    std::unique_ptr<Params> params; /**< The parameters, set up before the runs start */
+    size_t group = 0; /**< The thread group that ran the simulation */
+    unsigned iterations = 0; /**< The iterations of the finished run */
+    unsigned long long particleUpdates = 0; /**< The particle updates of the finished run */
+    double wallTime = 0; /**< The wall time of the simulation in seconds */
+};
+
+/**
+ * @class EnsembleRunner
+ * @brief Runs many small, independent simulations concurrently in one process, e.g. parameter
+ * sweeps that cannot use all threads on their own
+ * @details Every line of an ensemble list is a MolSim command line without the program, e.g.
+ * `-x input/falling_drop.xml -s 4 -P task`, which extends the options of the ensemble itself.
+ * Words of the form `name=value` set a parameter after the input file was read, so they also
+ * change XML inputs. Braces expand to one run per value and a line with several braces to every
+ * combination, e.g. `gravity={-9.81,-12.44} target_temp={20,40}` gives four runs. Every run writes
+ * its output suffixed with its index unless it sets `output`. The OpenMP threads are split into
+ * groups, every group runs one simulation after another with its share of the threads as nested
+ * parallel regions. The nested teams inherit the CPUs of their group thread, so a pinned group
+ * gets a block of CPUs. Every run draws its random velocities like a single run, independent of
+ * the order in which the groups set up their runs. The metrics of a run are suffixed with its
+ * index, the trace and the hardware counters record the whole process and are ignored. The runs
+ * write their output synchronously, as forking within their nested parallel regions may deadlock.
+ */
+class EnsembleRunner {
+public:
+    /**
+     * @brief Construct a new ensemble runner
+     * @param baseArgs The command line of the ensemble, whose options every run starts from
+     * @param groups The number of thread groups, 0 for one per run up to one per thread
+     * @param pinning The placement of the groups, every group is pinned to a block of CPUs
+     */
+    EnsembleRunner(std::vector<std::string> baseArgs,
+        size_t groups,
+        PinningType pinning = PinningType::UNPINNED);
+
+    /**
+     * @brief Read the runs of an ensemble list and set up their parameters
+     * @param filename The list, empty lines and lines starting with # are skipped
+     */
+    void readList(const std::string& filename);
+
+    /**
+     * @brief Add a line of an ensemble list, i.e. one run per combination of its braces
+     * @param line The options, input file and parameters of the runs
+     */
+    void addLine(const std::string& line);
+
+    /**
+     * @brief Run all simulations and log a summary of their results
+     */
+    void run();
+
+    /**
+     * @brief Get the runs of the ensemble
+     * @return The runs in the order of the list
+     */
+    inline const std::vector<EnsembleRun>& getRuns() const { return runs; }
+
+    /**
+     * @brief Get the number of thread groups and the threads of every group
+     * @param runs The number of runs
+     * @param threads The number of threads
+     * @param groups The requested number of groups, 0 for one per run up to one per thread
+     * @return The groups and the threads per group
+     */
+    static std::pair<size_t, size_t> partition(size_t runs, size_t threads, size_t groups);
+
+    /**
+     * @brief Expand the braces of a word
+     * @param word The word, e.g. `sigma={1,1.2}`
+     * @return One word per value of the braces, the word itself if it has none
+     */
+    static std::vector<std::string> expand(const std::string& word);
+
+    /**
+     * @brief Set a parameter of a run after its input file was read
+     * @param params The parameters of the run
+     * @param name The parameter, e.g. delta_t, end_time, gravity, target_temp or output
+     * @param value The value
+     */
+    static void setParameter(Params& params, const std::string& name, const std::string& value);
+
+private:
+    /**
+     * @brief Set up the simulation of a run under the setup lock and run it
+     * @param run The run
+     * @param index The index of the run, used for its output
+     */
+    void simulate(EnsembleRun& run, size_t index);
+
+    std::vector<std::string> baseArgs; /**< The command line of the ensemble */
+    size_t groups; /**< The requested number of thread groups */
+    PinningType pinning; /**< The placement of the thread groups */
+    std::vector<EnsembleRun> runs; /**< The runs in the order of the list */
+    std::mutex setupMutex; /**< Serializes reading the inputs and the memory tables of the runs */
+};
@@ -28,7 +28,8 @@ LennardJonesDomainSimulation::LennardJonesDomainSimulation(
     unsigned frequency,
     unsigned updateFrequency,
     size_t analysisFrequency,
-    bool read_file)
+    bool read_file,
+    std::unique_ptr<DomainDecomposition> decomposition)
     : LinkedLennardJonesSimulation(
           time,
           delta_t,
@@ -47,12 +48,18 @@ LennardJonesDomainSimulation::LennardJonesDomainSimulation(
           updateFrequency,
           false)
     , bcHandler(boundaryConfig, cellGrid)
+    , decomposition(std::move(decomposition))
     , repulsiveDistance(std::pow(2, 1 / 6) * sigma)
     , analysisFrequency(analysisFrequency)
     , analyzer(std::move(analyzer))
 {
+    if (this->decomposition)
+        this->decomposition->splitCells(cellGrid);
     if (read_file) {
         this->reader->readFile(*this);
+        // every rank keeps the particles of its subdomain
+        if (this->decomposition)
+            this->decomposition->distribute(container, cellGrid);
         cellGrid.addParticlesFromContainer(container);
     }
 }
@@ -69,29 +76,45 @@ void LennardJonesDomainSimulation::runSim()
     }
 
     while (time < end_time) {
-        bcHandler.preUpdateBoundaryHandling(*this);
+        phaseTimer.time(Phase::PRE_BOUNDARY, [&] { bcHandler.preUpdateBoundaryHandling(*this); });
+        if (decomposition) {
+            phaseTimer.time(
+                Phase::HALO_EXCHANGE, [&] { decomposition->exchangeGhosts(cellGrid); });
+        }
 
-        strategy.calF(*this);
-        strategy.calV(*this);
-        strategy.calX(*this);
+        phaseTimer.time(Phase::FORCE, [&] { strategy.calF(*this); });
+        phaseTimer.time(Phase::VELOCITY, [&] { strategy.calV(*this); });
+        phaseTimer.time(Phase::POSITION, [&] { strategy.calX(*this); });
 
-        bcHandler.postUpdateBoundaryHandling(*this);
+        phaseTimer.time(
+            Phase::POST_BOUNDARY, [&] { bcHandler.postUpdateBoundaryHandling(*this); });
+        if (decomposition)
+            decomposition->clearGhosts(cellGrid);
 
         ++iteration;
+        particleUpdates += container.activeParticleCount;
         if (iteration % frequency == 0) {
-            writer->plotParticles(*this);
+            phaseTimer.time(Phase::WRITER, [&] { writer->plotParticles(*this); });
         }
-        if (iteration % updateFrequency == 0) {
-            cellGrid.updateCells();
+        if (iteration % updateFrequency == 0 && decomposition) {
+            phaseTimer.time(
+                Phase::MIGRATION, [&] { decomposition->migrate(container, cellGrid); });
+        } else if (iteration % updateFrequency == 0) {
+            phaseTimer.time(Phase::UPDATE_CELLS, [&] { cellGrid.updateCells(); });
         }
         if (iteration % analysisFrequency == 0) {
-            analyzer->analyze(*this);
+            phaseTimer.time(Phase::ANALYZER, [&] { analyzer->analyze(*this); });
         }
-        progressLogger.logProgress(iteration);
+        progressLogger.logProgress(iteration, phaseTimer);
+        if (metrics)
+            metrics->update(*this);
+        if (memory)
+            memory->update(*this);
         spdlog::trace("Iteration {} finished.", iteration);
 
         time += delta_t;
     }
+    phaseTimer.logSummary();
 }
 
 double LennardJonesDomainSimulation::getRepulsiveDistance(int type) const
@@ -1,6 +1,7 @@
 
 #pragma once
 
+#include "models/linked_cell/DomainDecomposition.h"
 #include "physics/boundaryConditions/BoundaryConditionHandler.h"
 #include "simulation/linkedLennardJonesSim.h"
 
@@ -42,6 +43,8 @@ public:
      * @param updateFrequency The frequency for updating the grid (default = 10)
      * @param analysisFrequency The frequency for analyzing the simulation (default = 10000)
      * @param read_file Whether to read the input file (default = true)
+     * @param decomposition The decomposition of the domain across MPI ranks, nullptr to simulate
+     * the whole domain in this process (default = nullptr)
      */
     LennardJonesDomainSimulation(
         double time,
@@ -62,7 +65,8 @@ public:
         unsigned frequency = 10,
         unsigned updateFrequency = 10,
         size_t analysisFrequency = 10000,
-        bool read_file = true);
+        bool read_file = true,
+        std::unique_ptr<DomainDecomposition> decomposition = nullptr);
 
     /**
      * @brief Run the simulation
@@ -72,6 +76,9 @@ public:
 
     BoundaryConditionHandler bcHandler; /**< The boundary condition handler */
 
+    /** The decomposition across MPI ranks, nullptr if this process simulates the whole domain */
+    std::unique_ptr<DomainDecomposition> decomposition;
+
     /**
      * @brief Gets the distance for a particle where repulsion starts
      * @param type The type of the particle
@@ -79,6 +86,12 @@ public:
      */
     virtual double getRepulsiveDistance(int type) const;
 
+    /**
+     * @brief Get the analyzer of the simulation
+     * @return The analyzer, nullptr if there is none
+     */
+    inline const Analyzer* getAnalyzer() const { return analyzer.get(); }
+
 protected:
     size_t analysisFrequency; /**< The frequency for analyzing the simulation */
     std::unique_ptr<Analyzer> analyzer; /**< The analyzer object */
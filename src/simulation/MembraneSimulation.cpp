@@ -3,6 +3,8 @@
 #include "io/fileReader/FileReader.h"
 #include "io/fileWriter/FileWriter.h"
 #include "physics/strategy.h"
+#include "utils/ArrayUtils.h"
+#include <spdlog/spdlog.h>
 
 MembraneSimulation::MembraneSimulation(
     double time,
@@ -27,7 +29,8 @@ MembraneSimulation::MembraneSimulation(
     size_t analysisFrequency,
     bool read_file,
     unsigned n_thermostat,
-    bool doProfile)
+    bool doProfile,
+    unsigned respaSteps)
     : MixedLJSimulation(
           time,
           delta_t,
@@ -52,6 +55,7 @@ MembraneSimulation::MembraneSimulation(
           n_thermostat,
           doProfile)
     , molecules(std::move(molecules_arg))
+    , respaSteps(respaSteps > 0 ? respaSteps : 1)
 {
     if (read_file) {
         this->reader->readFile(*this);
@@ -72,3 +76,82 @@ void MembraneSimulation::runSim()
     // Simply run parent simulation
     MixedLJSimulation::runSim();
 }
+
+void MembraneSimulation::calculateFastForces()
+{
+    fastForces.assign(container.particles.size(), { 0, 0, 0 });
+    for (auto& molecule : molecules)
+        molecule->calculateBondedForces(container, fastForces);
+}
+
+void MembraneSimulation::calculateSlowForces(bool pulled)
+{
+    spdlog::debug("Slow force calculation...");
+    phaseTimer.time(Phase::FORCE, [&] { strategy.calF(*this); });
+    if (pulled) {
+        for (size_t id : pulledParticles) {
+            Particle& p = container.particles[id];
+            p.setF(p.getF() + pullForce);
+        }
+    }
+}
+
+void MembraneSimulation::kickSlow()
+{
+    spdlog::debug("Slow velocity calculation...");
+    phaseTimer.time(Phase::VELOCITY, [&] {
+#pragma omp parallel for
+        for (auto& p : container.particles) {
+            if (p.getIsNotStationary() && p.getActivity())
+                p.setV(p.getV() + (delta_t / (2 * p.getM())) * p.getF());
+        }
+    });
+}
+
+void MembraneSimulation::integrate()
+{
+    if (respaSteps <= 1) {
+        MixedLJSimulation::integrate();
+        return;
+    }
+
+    // later steps start from the slow forces calculated at the end of the previous one
+    if (firstStep) {
+        phaseTimer.time(Phase::PRE_BOUNDARY, [&] { bcHandler.preUpdateBoundaryHandling(*this); });
+        calculateSlowForces(isPulled());
+        firstStep = false;
+    }
+    kickSlow();
+
+    spdlog::debug("Inner steps...");
+    phaseTimer.time(Phase::INNER_STEPS, [&] {
+        // the boundaries may have moved or removed particles since the last inner step
+        calculateFastForces();
+        const double h = delta_t / respaSteps;
+        for (unsigned step = 0; step < respaSteps; ++step) {
+#pragma omp parallel for
+            for (size_t id = 0; id < container.particles.size(); ++id) {
+                Particle& p = container.particles[id];
+                if (p.getIsNotStationary() && p.getActivity()) {
+                    p.setV(p.getV() + (h / (2 * p.getM())) * fastForces[id]);
+                    p.setX(p.getX() + h * p.getV());
+                }
+            }
+            calculateFastForces();
+#pragma omp parallel for
+            for (size_t id = 0; id < container.particles.size(); ++id) {
+                Particle& p = container.particles[id];
+                if (p.getIsNotStationary() && p.getActivity())
+                    p.setV(p.getV() + (h / (2 * p.getM())) * fastForces[id]);
+            }
+        }
+    });
+    phaseTimer.time(Phase::POST_BOUNDARY, [&] { bcHandler.postUpdateBoundaryHandling(*this); });
+
+    // the slow forces of the new positions close the step, so the velocities match the positions
+    // for the writer, the analyzer and the thermostat
+    phaseTimer.time(Phase::UPDATE_CELLS, [&] { cellGrid.updateCells(); });
+    phaseTimer.time(Phase::PRE_BOUNDARY, [&] { bcHandler.preUpdateBoundaryHandling(*this); });
+    calculateSlowForces(isPulled(time + delta_t));
+    kickSlow();
+}
@@ -37,6 +37,8 @@ public:
      * @param read_file Whether to read the input file (default = true)
      * @param n_thermostat The number of steps between thermostat updates (default = 1000)
      * @param doProfile Whether to profile the simulation (default = false)
+     * @param respaSteps The inner steps of the bonded forces per time step, 1 to integrate them
+     * with the other forces (default = 1)
      */
     MembraneSimulation(
         double time,
@@ -61,7 +63,8 @@ public:
         size_t analysisFrequency = 10000,
         bool read_file = true,
         unsigned n_thermostat = 1000,
-        bool doProfile = false);
+        bool doProfile = false,
+        unsigned respaSteps = 1);
 
     /**
      * @brief Run the simulation
@@ -75,5 +78,52 @@ public:
      */
     [[nodiscard]] const std::vector<std::unique_ptr<Molecule>>& getMolecules() const { return molecules; }
 
+    /**
+     * @brief Get the inner steps of the bonded forces per time step
+     * @return The inner steps, 1 if multiple time stepping is disabled
+     */
+    [[nodiscard]] unsigned getRespaSteps() const { return respaSteps; }
+
+    /**
+     * @brief Get the bonded forces of the inner steps
+     * @return The forces indexed by particle ID, empty if multiple time stepping is disabled
+     */
+    [[nodiscard]] const std::vector<std::array<double, 3>>& getFastForces() const
+    {
+        return fastForces;
+    }
+
     std::vector<std::unique_ptr<Molecule>> molecules; /**< The molecules in the simulation */
+
+protected:
+    /**
+     * @brief Integrate one time step with multiple time stepping (r-RESPA)
+     * @details The stiff bonded forces of the molecules are integrated with respaSteps velocity
+     * Verlet steps of delta_t / respaSteps, within one step of the slow forces (Lennard-Jones,
+     * gravity, membrane repulsion and pull force), which are only calculated once per delta_t.
+     * Every step kicks the velocities by half a step of the slow forces, runs the inner steps,
+     * calculates the slow forces of the new positions and kicks by the other half. The particle
+     * forces hold the slow forces only.
+     */
+    void integrate() override;
+
+    /**
+     * @brief Recalculate the bonded forces of all molecules into fastForces
+     */
+    void calculateFastForces();
+
+    /**
+     * @brief Calculate the slow forces of the current positions into the particle forces
+     * @param pulled Whether the pulled particles get their extra force
+     */
+    void calculateSlowForces(bool pulled);
+
+    /**
+     * @brief Kick the velocities by the slow forces for half a time step
+     */
+    void kickSlow();
+
+    unsigned respaSteps; /**< The inner steps of the bonded forces per time step */
+    std::vector<std::array<double, 3>> fastForces; /**< The bonded forces indexed by particle ID */
+    bool firstStep = true; /**< Whether the slow forces of the positions are not calculated */
 };
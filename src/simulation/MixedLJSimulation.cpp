@@ -3,8 +3,10 @@
 #include "analytics/Analyzer.h"
 #include "io/fileReader/FileReader.h"
 #include "io/fileWriter/FileWriter.h"
+#include "physics/forceCal/forceCal.h"
 #include "physics/strategy.h"
 #include "utils/ArrayUtils.h"
+#include "utils/MPIUtils.h"
 #include <utility>
 
 MixedLJSimulation::MixedLJSimulation(
@@ -29,7 +31,8 @@ MixedLJSimulation::MixedLJSimulation(
     size_t analysisFrequency,
     bool read_file,
     unsigned int n_thermostat,
-    bool doProfile)
+    bool doProfile,
+    std::unique_ptr<DomainDecomposition> decomposition)
     : LennardJonesDomainSimulation(
           time,
           delta_t,
@@ -49,7 +52,8 @@ MixedLJSimulation::MixedLJSimulation(
           frequency,
           updateFrequency,
           analysisFrequency,
-          false)
+          false,
+          std::move(decomposition))
     , gravityConstant(gravityConstant)
     , thermostat(std::move(p_thermostat))
     , T_init(p_thermostat->getInit())
@@ -59,8 +63,31 @@ MixedLJSimulation::MixedLJSimulation(
     , ljparams(LJParams)
     , doProfile(doProfile)
 {
-    if (read_file) {
+    if (read_file)
         this->reader->readFile(*this);
+
+    if (n_thermostat) {
+        // Initialize thermostat
+        spdlog::info(
+            "Initializing thermostat of type={} with T_init={}K, T_target={}K, delta_T={}K with"
+            " a frequency of {}",
+            thermostat->getName(),
+            T_init,
+            T_target,
+            delta_T,
+            n_thermostat);
+
+        // Intialize temperature
+        spdlog::info("Setting initial temperature to {} K", T_init);
+        thermostat->initializeBrownianMotion(*this);
+    } else {
+        spdlog::info("Themostat is turned off.");
+    }
+
+    // the velocities are drawn for all particles, so every rank draws the same ones
+    if (read_file) {
+        if (this->decomposition)
+            this->decomposition->distribute(container, cellGrid);
         cellGrid.addParticlesFromContainer(container);
     }
 
@@ -132,86 +159,44 @@ MixedLJSimulation::MixedLJSimulation(
             cellGrid.gridDimensionality);
         exit(EXIT_FAILURE);
     }
-
-    if (n_thermostat) {
-        // Initialize thermostat
-        spdlog::info(
-            "Initializing thermostat of type={} with T_init={}K, T_target={}K, delta_T={}K with"
-            " a frequency of {}",
-            thermostat->getName(),
-            T_init,
-            T_target,
-            delta_T,
-            n_thermostat);
-
-        // Intialize temperature
-        spdlog::info("Setting initial temperature to {} K", T_init);
-        thermostat->initializeBrownianMotion(*this);
-    } else {
-        spdlog::info("Themostat is turned off.");
-    }
 }
 
 void MixedLJSimulation::runSim()
 {
 
     if (container.particles.size() == 2500) {
-        container.particles[874].setType(2);
-        container.particles[875].setType(2);
-        container.particles[924].setType(2);
-        container.particles[925].setType(2);
+        for (size_t id : pulledParticles)
+            container.particles[id].setType(2);
     }
 
 
     auto startTime = std::chrono::steady_clock::now();
-    unsigned long long particleUpdates = 0;
     while (time < end_time) {
-        bcHandler.preUpdateBoundaryHandling(*this);
-
-        spdlog::debug("Force calculation...");
-        strategy.calF(*this);
-        spdlog::debug("Velocity calculation...");
-
-        if (time < 150 && container.particles.size() == 2500) {
-            std::array<double, 3> Fz_up = { 0, 0, 0.8 };
-            Particle& p1 = container.particles[874];
-            Particle& p2 = container.particles[875];
-            Particle& p3 = container.particles[924];
-            Particle& p4 = container.particles[925];
-            p1.setOldF(p1.getF());
-            p1.setF(p1.getF() + Fz_up);
-            p2.setOldF(p2.getF());
-            p2.setF(p2.getF() + Fz_up);
-            p3.setOldF(p3.getF());
-            p3.setF(p3.getF() + Fz_up);
-            p4.setOldF(p4.getF());
-            p4.setF(p4.getF() + Fz_up);
-        }
-
-        strategy.calV(*this);
-        spdlog::debug("Position calculation...");
-        strategy.calX(*this);
-
-        bcHandler.postUpdateBoundaryHandling(*this);
+        integrate();
 
         ++iteration;
+        particleUpdates += container.activeParticleCount;
         if (frequency && iteration % frequency == 0) {
-            writer->plotParticles(*this);
+            phaseTimer.time(Phase::WRITER, [&] { writer->plotParticles(*this); });
         }
-        if (updateFrequency && iteration % updateFrequency == 0) {
-            cellGrid.updateCells();
+        if (updateFrequency && iteration % updateFrequency == 0 && decomposition) {
+            phaseTimer.time(
+                Phase::MIGRATION, [&] { decomposition->migrate(container, cellGrid); });
+        } else if (updateFrequency && iteration % updateFrequency == 0) {
+            phaseTimer.time(Phase::UPDATE_CELLS, [&] { cellGrid.updateCells(); });
         }
         if (analysisFrequency && iteration % analysisFrequency == 0) {
-            analyzer->analyze(*this);
+            phaseTimer.time(Phase::ANALYZER, [&] { analyzer->analyze(*this); });
         }
         if (n_thermostat && iteration % n_thermostat == 0) {
-            thermostat->updateT(*this);
-        }
-        if (doProfile) {
-            particleUpdates += container.activeParticleCount;
+            phaseTimer.time(Phase::THERMOSTAT, [&] { thermostat->updateT(*this); });
         }
         spdlog::debug("Iteration {} finished.", iteration);
-        progressLogger.logProgress(iteration);
+        progressLogger.logProgress(iteration, phaseTimer);
+        if (metrics)
+            metrics->update(*this);
+        if (memory)
+            memory->update(*this);
 
         time += delta_t;
     }
@@ -220,17 +205,137 @@ void MixedLJSimulation::runSim()
         std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count();
     long elapsedTimeInS =
         std::chrono::duration_cast<std::chrono::seconds>(endTime - startTime).count();
+    // runs shorter than a second must not divide by zero
+    std::chrono::duration<double> elapsedTime = endTime - startTime;
+    unsigned iterations = iteration > 1 ? iteration - 1 : 1;
 
     if (doProfile) {
         // Set log level to info, as it was off for the measurements
         spdlog::set_level(spdlog::level::info);
         spdlog::info(
             "Simulation ran for {} seconds ({} iterations)", elapsedTimeInS, iteration - 1);
-        spdlog::info("Average time per iteration: {} ms", elapsedTimeInMS / (iteration - 1));
+        spdlog::info("Average time per iteration: {} ms", elapsedTimeInMS / iterations);
         spdlog::info(
             "MUP/S = {} (MUP = force+vel+pos calc i.e. one update per particle per iteration)",
-            particleUpdates / elapsedTimeInS);
+            static_cast<double>(particleUpdates) / elapsedTime.count());
+    }
+    phaseTimer.logSummary();
+}
+
+void MixedLJSimulation::integrate()
+{
+    // the pulled particles of the membrane input get their extra force between the phases
+    const bool pulled = isPulled();
+    if (strategy.step && !decomposition && !pulled && !levels && !subCells) {
+        // boundary handling, forces, velocities and positions overlap in one task graph
+        phaseTimer.time(Phase::TASK_GRAPH, [&] { strategy.step(*this); });
+        return;
     }
+    phaseTimer.time(Phase::PRE_BOUNDARY, [&] { bcHandler.preUpdateBoundaryHandling(*this); });
+
+    spdlog::debug("Force calculation...");
+    const bool overlap = decomposition && MPIUtils::isFunneled() && !levels && !subCells;
+    // the levels and sub cells are built from the cells including the halos
+    if (decomposition && !overlap) {
+        phaseTimer.time(Phase::HALO_EXCHANGE, [&] { decomposition->exchangeGhosts(cellGrid); });
+    }
+    if (levels) {
+        phaseTimer.time(Phase::FORCE, [&] { force_mixed_LJ_gravity_levels(*this); });
+    } else if (subCells) {
+        phaseTimer.time(Phase::FORCE, [&] { force_mixed_LJ_gravity_subcells(*this); });
+    } else if (overlap) {
+        // the halos are exchanged while the interior cells are calculated
+        phaseTimer.time(Phase::FORCE, [&] {
+            force_mixed_LJ_gravity_lc_overlap(*this, [&] {
+                auto start = std::chrono::steady_clock::now();
+                decomposition->exchangeGhosts(cellGrid);
+                phaseTimer.record(Phase::HALO_EXCHANGE, std::chrono::steady_clock::now() - start);
+            });
+        });
+    } else {
+        phaseTimer.time(Phase::FORCE, [&] { strategy.calF(*this); });
+    }
+    spdlog::debug("Velocity calculation...");
+
+    if (pulled) {
+        for (size_t id : pulledParticles) {
+            Particle& p = container.particles[id];
+            p.setOldF(p.getF());
+            p.setF(p.getF() + pullForce);
+        }
+    }
+
+    phaseTimer.time(Phase::VELOCITY, [&] { strategy.calV(*this); });
+    spdlog::debug("Position calculation...");
+    phaseTimer.time(Phase::POSITION, [&] { strategy.calX(*this); });
+
+    phaseTimer.time(Phase::POST_BOUNDARY, [&] { bcHandler.postUpdateBoundaryHandling(*this); });
+    if (decomposition)
+        decomposition->clearGhosts(cellGrid);
+}
+
+const char* MixedLJSimulation::getForceOverride() const
+{
+    if (levels)
+        return "on the levels of the type cutoffs";
+    if (subCells)
+        return "on the sub cells of the cell size factor";
+    if (decomposition && MPIUtils::isFunneled())
+        return "while the halos are exchanged";
+    return nullptr;
+}
+
+void MixedLJSimulation::setTypeCutoffs(const std::map<unsigned, double>& typeCutoffs)
+{
+    const double cutoff = cellGrid.getCutoffRadius();
+    auto typeCutoff = [&](int type) {
+        auto it = typeCutoffs.find(static_cast<unsigned>(type));
+        return it == typeCutoffs.end() ? cutoff : it->second;
+    };
+    for (const auto& [type, typeCut] : typeCutoffs) {
+        if (typeCut > cutoff)
+            spdlog::warn(
+                "The cutoff {} of particle type {} exceeds the cutoff of the simulation {}",
+                typeCut,
+                type,
+                cutoff);
+    }
+
+    cutoffs.clear();
+    bool differ = false;
+    for (const auto& sigmaPair : sigmas) {
+        const auto [type1, type2] = sigmaPair.first;
+        // the cells of the grid must not be smaller than the cutoff of any pair
+        const double pairCutoff = std::min(cutoff, (typeCutoff(type1) + typeCutoff(type2)) / 2);
+        cutoffs.insert({ sigmaPair.first, pairCutoff });
+        differ |= pairCutoff != cutoff;
+    }
+
+    levels.reset();
+    if (differ)
+        levels = std::make_unique<MultiLevelGrid>(cellGrid, cutoffs);
+    else
+        spdlog::info("All particle types use the cutoff {}", cutoff);
+}
+
+void MixedLJSimulation::setCellSizeFactor(double factor)
+{
+    subCells.reset();
+    if (factor >= 1)
+        return;
+    if (levels) {
+        spdlog::warn("The cell size factor {} is ignored, the type cutoffs use their own cells",
+            factor);
+        return;
+    }
+    subCells = std::make_unique<SubCellGrid>(cellGrid, factor);
+}
+
+double MixedLJSimulation::getCutoff(int type1, int type2) const
+{
+    if (cutoffs.empty())
+        return cellGrid.getCutoffRadius();
+    return cutoffs.at(getMixKey(type1, type2));
 }
 
 double MixedLJSimulation::getRepulsiveDistance(int type) const
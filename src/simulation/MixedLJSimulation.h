@@ -1,6 +1,8 @@
 
 #pragma once
 #include "LennardJonesDomainSimulation.h"
+#include "models/linked_cell/MultiLevelGrid.h"
+#include "models/linked_cell/SubCellGrid.h"
 #include "physics/thermostat/Thermostat.h"
 
 /**
@@ -40,6 +42,9 @@ public:
      * @param analysisFrequency The frequency for analyzing the simulation (default = 10000)
      * @param read_file Whether to read the input file (default = true)
      * @param n_thermostat The number of steps between thermostat updates (default = 1000
+     * @param doProfile Whether to log the performance of the run (default = false)
+     * @param decomposition The decomposition of the domain across MPI ranks, nullptr to simulate
+     * the whole domain in this process (default = nullptr)
      */
     MixedLJSimulation(
         double time,
@@ -63,7 +68,8 @@ public:
         size_t analysisFrequency = 10000,
         bool read_file = true,
         unsigned n_thermostat = 1000,
-        bool doProfile = false);
+        bool doProfile = false,
+        std::unique_ptr<DomainDecomposition> decomposition = nullptr);
 
     /**
      * @brief Run the simulation
@@ -126,6 +132,54 @@ public:
      */
     double getGamma(int type1, int type2) const { return gammas.at(getMixKey(type1, type2)); }
 
+    /**
+     * @brief Set the cutoff radius of the particle types, the cutoff of a pair of types is the
+     * mean of both (like their sigma), at most the cutoff of the simulation
+     * @details If the pairs have different cutoffs, the forces are calculated on a multi-level
+     * grid with cells matched to the cutoff of every pair class instead of the cell traversal of
+     * the strategy
+     * @param typeCutoffs The cutoff of every type, types without one use the cutoff of the
+     * simulation
+     */
+    void setTypeCutoffs(const std::map<unsigned, double>& typeCutoffs);
+
+    /**
+     * @brief Get the cutoff of a combination of particles
+     * @param type1 Type of the first particle
+     * @param type2 Type of the second particle
+     * @return The cutoff of the pair, the cutoff of the simulation if no type cutoffs are set
+     */
+    double getCutoff(int type1, int type2) const;
+
+    /**
+     * @brief Get the multi-level grid of the type cutoffs
+     * @return The levels, nullptr if all pairs use the cutoff of the simulation
+     */
+    MultiLevelGrid* getLevels() const { return levels.get(); }
+
+    /**
+     * @brief Set the size of the cells of the force calculation relative to the cutoff
+     * @details A factor below 1 calculates the forces on sub cells of the grid with a stencil
+     * generated for their size instead of the cell traversal of the strategy. The levels of type
+     * cutoffs take precedence.
+     * @param factor The size of the cells relative to the cutoff, e.g. 0.5 for half the cutoff
+     */
+    void setCellSizeFactor(double factor);
+
+    /**
+     * @brief Get the sub cells of the cell size factor
+     * @return The sub cells, nullptr if the forces are calculated on the cells of the grid
+     */
+    SubCellGrid* getSubCells() const { return subCells.get(); }
+
+    /**
+     * @brief Get the force calculation that replaces the cell traversal of the strategy
+     * @details The levels, the sub cells and the overlapped halo exchange bypass the force
+     * calculation of the parallel strategy, and the levels and sub cells record no cell load.
+     * @return A description of the force calculation, nullptr if the strategy calculates the forces
+     */
+    const char* getForceOverride() const;
+
     /**
      * @brief get the gravity constant
      * @return The gravity constant used in the simulation
@@ -169,12 +223,41 @@ public:
     const std::map<unsigned, std::pair<double, double>> ljparams;
 
 protected:
+    /**
+     * @brief Calculate one time step: the boundary handling, forces, velocities and positions
+     */
+    virtual void integrate();
+
+    /**
+     * @brief Check if the pulled particles of the membrane input get their extra force
+     * @param at The time
+     * @return Whether the particles are pulled at the time
+     */
+    bool isPulled(double at) const { return at < 150 && container.particles.size() == 2500; }
+
+    /**
+     * @brief Check if the pulled particles of the membrane input get their extra force
+     * @return Whether the particles are pulled in the current step
+     */
+    bool isPulled() const { return isPulled(time); }
+
+    static constexpr std::array<size_t, 4> pulledParticles {
+        874, 875, 924, 925
+    }; /**< The particles of the membrane input which are pulled up at the start */
+    static constexpr std::array<double, 3> pullForce {
+        0, 0, 0.8
+    }; /**< The force pulling them up */
+
     MixLJParamMap epsilons; /**< The mixed epsilon parameters of the Lennard-Jones potential */
     MixLJParamMap sigmas; /**< The mixed sigma parameters of the Lennard-Jones potential */
     MixLJParamMap alphas; /**< -24 * epsilon */
     MixLJParamMap betas; /**< sigma^6 */
     MixLJParamMap gammas; /**< -2 * sigma^12 */
 
+    MixLJParamMap cutoffs; /**< The cutoffs of the pairs of types, empty without type cutoffs */
+    std::unique_ptr<MultiLevelGrid> levels; /**< The cells of the type cutoffs, if they differ */
+    std::unique_ptr<SubCellGrid> subCells; /**< The cells smaller than the cutoff, if set */
+
     std::map<unsigned, double>
         repulsiveDistances; /**< The repulsive distances for every particle */
 
@@ -37,3 +37,8 @@ std::string Simulation::getOutputFile() const
 {
     return this->writer->out_name;
 }
+
+size_t Simulation::estimateWriterBytes() const
+{
+    return writer->estimateBytes(static_cast<size_t>(container.activeParticleCount));
+}
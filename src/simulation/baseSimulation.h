@@ -1,6 +1,8 @@
 
 #pragma once
 
+#include "analytics/MemoryAccounting.h"
+#include "analytics/MetricsExporter.h"
 #include "analytics/ProgressLogger.h"
 #include "models/ParticleContainer.h"
 #include <map>
@@ -57,6 +59,11 @@ public:
     ParticleContainer& container; /**< The particle container which holds all particles */
     std::map<unsigned, bool>
         stationaryParticleTypes; /**< The types of particles which are stationary */
+    PhaseTimer phaseTimer; /**< The timings of the phases of the simulation loop */
+    unsigned long long particleUpdates =
+        0; /**< Sum of the active particles over all iterations (force+vel+pos updates) */
+    std::unique_ptr<MetricsExporter> metrics; /**< Exporter of live metrics, nullptr if disabled */
+    std::unique_ptr<MemoryTracker> memory; /**< Memory accounting, nullptr if disabled */
 
     /*
      * @brief Destructor of Simulation
@@ -75,6 +82,12 @@ public:
      * */
     std::string getOutputFile() const;
 
+    /**
+     * @brief Estimate the heap memory the writer needs to write one output
+     * @return The estimated bytes (see FileWriter::estimateBytes)
+     */
+    size_t estimateWriterBytes() const;
+
 protected:
     PhysicsStrategy& strategy; /**< The strategy which is used to calculate the physics */
     std::unique_ptr<FileWriter> writer; /**< The output writer */
@@ -49,22 +49,28 @@ LinkedLennardJonesSimulation::LinkedLennardJonesSimulation(
 void LinkedLennardJonesSimulation::runSim()
 {
     while (time < end_time) {
-        strategy.calF(*this);
-        strategy.calV(*this);
-        strategy.calX(*this);
+        phaseTimer.time(Phase::FORCE, [&] { strategy.calF(*this); });
+        phaseTimer.time(Phase::VELOCITY, [&] { strategy.calV(*this); });
+        phaseTimer.time(Phase::POSITION, [&] { strategy.calX(*this); });
 
         ++iteration;
+        particleUpdates += container.activeParticleCount;
         if (iteration % frequency == 0) {
-            writer->plotParticles(*this);
+            phaseTimer.time(Phase::WRITER, [&] { writer->plotParticles(*this); });
         }
         if (iteration % updateFrequency == 0) {
-            cellGrid.updateCells();
+            phaseTimer.time(Phase::UPDATE_CELLS, [&] { cellGrid.updateCells(); });
         }
-        progressLogger.logProgress(iteration);
+        progressLogger.logProgress(iteration, phaseTimer);
+        if (metrics)
+            metrics->update(*this);
+        if (memory)
+            memory->update(*this);
         spdlog::trace("Iteration {} finished.", iteration);
 
         time += delta_t;
     }
+    phaseTimer.logSummary();
 }
 
 void LinkedLennardJonesSimulation::setDomainOrigin(const std::array<double, 3>& domainOrigin)
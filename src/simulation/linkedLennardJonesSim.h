@@ -1,6 +1,7 @@
 
 #pragma once
 #include "models/linked_cell/CellGrid.h"
+#include "models/linked_cell/LoadBalancer.h"
 #include "simulation/lennardJonesSim.h"
 
 /**
@@ -54,6 +55,19 @@ public:
 
     [[nodiscard]] const CellGrid& getGrid() const { return cellGrid; }
 
+    /**
+     * @brief Measure the force calculation time of every cell
+     * @param record True to measure the time
+     */
+    inline void setRecordCellLoad(bool record) { cellGrid.recordLoad = record; }
+
+    /**
+     * @brief Set the number of iterations between two partitions of the balanced force
+     * calculation
+     * @param interval The interval, 0 to only partition the cell columns once
+     */
+    inline void setBalanceInterval(size_t interval) { cellGrid.balancer->setInterval(interval); }
+
     /**
      * @brief Set the origin of the simulation domain
      * @param domainOrigin The origin of the simulation domain
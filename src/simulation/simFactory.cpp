@@ -16,8 +16,15 @@ std::unique_ptr<Simulation> simFactory(
     PhysicsStrategy& strat,
     std::unique_ptr<FileWriter> writePointer,
     std::unique_ptr<FileReader> readPointer,
-    std::unique_ptr<Thermostat> thermostat)
+    std::unique_ptr<Thermostat> thermostat,
+    std::unique_ptr<DomainDecomposition> decomposition)
 {
+    if (decomposition) {
+        // every rank simulates the cells of its own part of the domain
+        params.domain_origin = decomposition->getLocalOrigin();
+        params.domain_size = decomposition->getLocalSize();
+        params.boundaryConfig = decomposition->getLocalBoundaryConfig();
+    }
     bool is2DTmp;
     switch (params.simulation_type) {
     case SimulationType::PLANET:
@@ -147,8 +154,9 @@ std::unique_ptr<Simulation> simFactory(
             params.plot_frequency,
             params.update_frequency,
             params.analysisInterval,
-            true);
-    case SimulationType::MIXED_LJ:
+            true,
+            std::move(decomposition));
+    case SimulationType::MIXED_LJ: {
         spdlog::info("Initializing Mixed LJ + Gravity Simulation with:");
         spdlog::info(
             "delta_t: {}, end_time: {}, epsilon: {}, sigma: {}, plot_frequency: {}",
@@ -181,7 +189,7 @@ std::unique_ptr<Simulation> simFactory(
             is2DTmp ? "None (2D)"
                     : getBoundaryString(params.boundaryConfig.boundaryMap.at(Position::BACK)));
 
-        return std::make_unique<MixedLJSimulation>(
+        auto sim = std::make_unique<MixedLJSimulation>(
             params.start_time,
             params.delta_t,
             params.end_time,
@@ -203,7 +211,20 @@ std::unique_ptr<Simulation> simFactory(
             params.analysisInterval,
             true,
             params.thermo_freq,
-            params.doPerformanceMeasurements);
+            params.doPerformanceMeasurements,
+            std::move(decomposition));
+        if (!params.typeCutoffs.empty())
+            sim->setTypeCutoffs(params.typeCutoffs);
+        sim->setCellSizeFactor(params.cell_size_factor);
+        if (const char* force = sim->getForceOverride()) {
+            if (params.parallel_type != ParallelType::STATIC)
+                spdlog::warn("The forces are calculated {}, the parallel strategy is not used",
+                    force);
+            if (params.cell_load && (sim->getLevels() || sim->getSubCells()))
+                spdlog::warn("The forces are calculated {}, the cell load is not recorded", force);
+        }
+        return sim;
+    }
     case SimulationType::MEMBRANE_LJ:
         spdlog::info("Initializing Membrane Simulation with:");
         spdlog::info(
@@ -260,7 +281,8 @@ std::unique_ptr<Simulation> simFactory(
             params.analysisInterval,
             true,
             params.thermo_freq,
-            params.doPerformanceMeasurements);
+            params.doPerformanceMeasurements,
+            params.respa_steps);
     }
 
     spdlog::error("Invalid simulation type.");
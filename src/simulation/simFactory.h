@@ -1,6 +1,7 @@
 
 #pragma once
 #include "models/ParticleContainer.h"
+#include "models/linked_cell/DomainDecomposition.h"
 #include "physics/strategy.h"
 #include "physics/thermostat/Thermostat.h"
 #include "simulation/baseSimulation.h"
@@ -17,6 +18,10 @@
  * @param strat A reference to the PhysicsStrategy object defining the simulation strategy.
  * @param writePointer A unique pointer to a FileWriter object for writing simulation data.
  * @param readPointer A unique pointer to a FileReader object for reading simulation data.
+ * @param thermostat A unique pointer to the Thermostat used by the mixed simulations.
+ * @param decomposition The decomposition of the domain across MPI ranks, used by the domain
+ * simulations, whose domain in the params is replaced by the local one. nullptr to simulate the
+ * whole domain in this process.
  * @return A unique pointer to a Simulation object representing the initialized simulation.
  */
 std::unique_ptr<Simulation> simFactory(
@@ -25,4 +30,5 @@ std::unique_ptr<Simulation> simFactory(
     PhysicsStrategy& strat,
     std::unique_ptr<FileWriter> writePointer,
     std::unique_ptr<FileReader> readPointer,
-    std::unique_ptr<Thermostat> thermostat);
+    std::unique_ptr<Thermostat> thermostat,
+    std::unique_ptr<DomainDecomposition> decomposition = nullptr);
@@ -0,0 +1,153 @@
+#include "analytics/ScalingStudy.h"
+#include "spdlog/spdlog.h"
+#include <fstream>
+#include <getopt.h>
+#include <sstream>
+#include <string>
+
+namespace {
+
+void printHelp(const char* name)
+{
+    spdlog::info("Usage: {} [options]\n"
+                 "  -t, --threads LIST    Comma separated OpenMP thread counts (default 1,2,4,8)\n"
+                 "  -n, --particles N     Particles, per thread for weak scaling (default 8000)\n"
+                 "  -s, --steps N         Time steps per case (default 100)\n"
+                 "  -m, --mode MODE       strong, weak or both (default both)\n"
+                 "  -P, --parallel TYPE   static, task, balanced, graph, stealing,\n"
+                 "                        both or all (default both)\n"
+                 "  -b, --baseline FILE   CSV of an earlier study to compare against\n"
+                 "  -o, --output NAME     Write NAME.csv and NAME.json (default scaling)\n"
+                 "  -h, --help            Print this help",
+        name);
+}
+
+} // namespace
+
+/**
+ * @brief Strong and weak scaling study of the mixed LJ force strategies over OpenMP thread counts
+ * @details Every thread count is run for every mode and ParallelType on a generated 3D
+ * Rayleigh-Taylor like block (see runScalingCase). Speedup and efficiency are written as CSV and
+ * JSON. With a baseline (the CSV of an earlier study), every case also gets the relative change
+ * of its time against the baseline.
+ */
+int main(int argc, char* argsv[])
+{
+    ScalingConfig config;
+    std::string baselineFile;
+    std::string output = "scaling";
+
+    const option longOptions[] = { { "threads", required_argument, 0, 't' },
+                                   { "particles", required_argument, 0, 'n' },
+                                   { "steps", required_argument, 0, 's' },
+                                   { "mode", required_argument, 0, 'm' },
+                                   { "parallel", required_argument, 0, 'P' },
+                                   { "baseline", required_argument, 0, 'b' },
+                                   { "output", required_argument, 0, 'o' },
+                                   { "help", no_argument, 0, 'h' },
+                                   { 0, 0, 0, 0 } };
+    int opt;
+    try {
+        while ((opt = getopt_long(argc, argsv, "t:n:s:m:P:b:o:h", longOptions, nullptr)) != -1) {
+            std::string arg = optarg ? optarg : "";
+            switch (opt) {
+            case 't': {
+                config.threads.clear();
+                std::stringstream list(arg);
+                std::string threads;
+                while (std::getline(list, threads, ','))
+                    config.threads.push_back(std::stoi(threads));
+                break;
+            }
+            case 'n':
+                config.particles = std::stoul(arg);
+                break;
+            case 's':
+                config.steps = static_cast<unsigned>(std::stoul(arg));
+                break;
+            case 'm':
+                if (arg == "strong")
+                    config.modes = { ScalingMode::STRONG };
+                else if (arg == "weak")
+                    config.modes = { ScalingMode::WEAK };
+                else if (arg != "both")
+                    throw std::invalid_argument("mode " + arg);
+                break;
+            case 'P':
+                if (arg == "static")
+                    config.parallelTypes = { ParallelType::STATIC };
+                else if (arg == "task")
+                    config.parallelTypes = { ParallelType::TASK };
+                else if (arg == "balanced")
+                    config.parallelTypes = { ParallelType::BALANCED };
+                else if (arg == "graph")
+                    config.parallelTypes = { ParallelType::GRAPH };
+                else if (arg == "stealing")
+                    config.parallelTypes = { ParallelType::STEALING };
+                else if (arg == "all")
+                    config.parallelTypes = { ParallelType::STATIC,
+                        ParallelType::TASK,
+                        ParallelType::BALANCED,
+                        ParallelType::GRAPH,
+                        ParallelType::STEALING };
+                else if (arg != "both")
+                    throw std::invalid_argument("parallel type " + arg);
+                break;
+            case 'b':
+                baselineFile = arg;
+                break;
+            case 'o':
+                output = arg;
+                break;
+            default:
+                printHelp(argsv[0]);
+                return opt == 'h' ? 0 : EXIT_FAILURE;
+            }
+        }
+    } catch (const std::exception& e) {
+        spdlog::error("Invalid argument: {}", e.what());
+        printHelp(argsv[0]);
+        return EXIT_FAILURE;
+    }
+    for (int threads : config.threads) {
+        if (threads < 1) {
+            spdlog::error("Thread counts have to be positive");
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<ScalingResult> baseline;
+    if (!baselineFile.empty()) {
+        std::ifstream file(baselineFile);
+        if (!file) {
+            spdlog::error("Could not open baseline {}", baselineFile);
+            return EXIT_FAILURE;
+        }
+        baseline = parseScalingCsv(file);
+    }
+
+    auto results = runScalingStudy(config);
+    if (!baselineFile.empty()) {
+        size_t matched = applyBaseline(results, baseline);
+        spdlog::info(
+            "{} of {} cases found in the baseline {}", matched, results.size(), baselineFile);
+    }
+
+    for (const auto& r : results) {
+        std::string change = r.baselineTime > 0
+            ? fmt::format(", {:+.1f}% against the baseline", 100 * (r.time / r.baselineTime - 1))
+            : "";
+        spdlog::info("{} {} threads {:>3}: speedup {:>6.2f}, efficiency {:>5.1f}%{}",
+            getScalingModeName(r.mode),
+            getParallelTypeName(r.parallelType),
+            r.threads,
+            r.speedup,
+            100 * r.efficiency,
+            change);
+    }
+
+    std::ofstream(output + ".csv") << scalingCsv(results);
+    std::ofstream(output + ".json") << scalingJson(results);
+    spdlog::info("Scaling study written to {}.csv and {}.json", output, output);
+    return 0;
+}
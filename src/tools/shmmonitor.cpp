@@ -0,0 +1,44 @@
+#include "io/shm/ShmFrameReader.h"
+#include "spdlog/spdlog.h"
+#include <array>
+#include <chrono>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Minimal consumer of the shared-memory ring buffer published with writer type 5
+ * @details Usage: shmmonitor [outName]. Prints iteration, particle count and mean velocity of every
+ * received frame until the simulation has ended.
+ */
+int main(int argc, char* argsv[])
+{
+    std::string outName = argc > 1 ? argsv[1] : "sim";
+
+    try {
+        ShmFrameReader reader(outName);
+        ShmFrame frame;
+        while (true) {
+            if (!reader.next(frame)) {
+                if (reader.finished())
+                    break;
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                continue;
+            }
+
+            std::array<double, 3> meanV { 0, 0, 0 };
+            for (const auto& p : frame.particles) {
+                for (size_t i = 0; i < 3; ++i)
+                    meanV[i] += p.v[i];
+            }
+            for (auto& v : meanV)
+                v /= frame.particles.empty() ? 1 : frame.particles.size();
+            spdlog::info("Iteration {}: {} particles, mean velocity ({:.4f}, {:.4f}, {:.4f})",
+                frame.iteration, frame.particles.size(), meanV[0], meanV[1], meanV[2]);
+        }
+        spdlog::info("Simulation ended, {} frames lost", reader.getLostFrames());
+    } catch (const std::exception& e) {
+        spdlog::error("{}", e.what());
+        return EXIT_FAILURE;
+    }
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include "io/fileWriter/VTKWriter.h"
+#include "io/trajectory/TrajectoryReader.h"
+#include "models/Particle.h"
+#include "spdlog/spdlog.h"
+#include <string>
+
+/**
+ * @brief Converts a compressed trajectory (.mtr) written by the TrajectoryWriter to VTU files
+ * @details Usage: traj2vtu <trajectory.mtr> [outName]. One VTU file is written per frame, named
+ * after the iteration of the frame. Fields not stored in the trajectory (mass, force and
+ * optionally velocity and type) are written as zero.
+ */
+int main(int argc, char* argsv[])
+{
+    if (argc < 2 || argc > 3) {
+        spdlog::error("Usage: {} <trajectory.mtr> [outName]", argsv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::string input = argsv[1];
+    std::string outName = argc == 3 ? argsv[2] : input.substr(0, input.rfind(".mtr"));
+
+    try {
+        TrajectoryReader reader(input);
+        TrajectoryFrame frame;
+        outputWriter::VTKWriter writer(outName);
+        size_t frames = 0;
+
+        while (reader.readFrame(frame)) {
+            writer.initializeOutput(static_cast<int>(frame.positions.size()));
+            for (size_t i = 0; i < frame.positions.size(); ++i) {
+                Particle p(frame.positions[i],
+                    (frame.flags & TRAJ_VELOCITIES) ? frame.velocities[i]
+                                                    : std::array<double, 3> { 0, 0, 0 },
+                    0,
+                    (frame.flags & TRAJ_TYPES) ? frame.types[i] : 0);
+                writer.plotParticle(p, i);
+            }
+            writer.writeFile(outName, static_cast<int>(frame.iteration));
+            ++frames;
+        }
+        spdlog::info("Converted {} frames of {} to {}_*.vtu", frames, input, outName);
+    } catch (const std::exception& e) {
+        spdlog::error("Could not convert trajectory: {}", e.what());
+        return EXIT_FAILURE;
+    }
+    return 0;
+}
@@ -0,0 +1,123 @@
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#ifdef MOLSIM_MPI
+#include <mpi.h>
+#endif
+
+/**
+ * @brief Helpers for the ranks of a domain decomposed run (see DomainDecomposition)
+ * @details Without MPI, or before MPI is initialized, there is a single rank and the reductions
+ * return their argument, so callers do not need to distinguish the builds.
+ */
+namespace MPIUtils {
+
+/**
+ * @brief Check whether MPI is initialized and not yet finalized
+ * @return True if MPI can be used
+ */
+inline bool isInitialized()
+{
+#ifdef MOLSIM_MPI
+    int initialized = 0;
+    int finalized = 0;
+    MPI_Initialized(&initialized);
+    MPI_Finalized(&finalized);
+    return initialized && !finalized;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Check whether the master thread of an OpenMP parallel region may communicate
+ * @return True without MPI or if MPI was initialized with at least MPI_THREAD_FUNNELED
+ */
+inline bool isFunneled()
+{
+#ifdef MOLSIM_MPI
+    if (isInitialized()) {
+        int provided = MPI_THREAD_SINGLE;
+        MPI_Query_thread(&provided);
+        return provided >= MPI_THREAD_FUNNELED;
+    }
+#endif
+    return true;
+}
+
+/**
+ * @brief Get the rank of this process
+ * @return The rank in MPI_COMM_WORLD, 0 without MPI
+ */
+inline int getRank()
+{
+    int rank = 0;
+#ifdef MOLSIM_MPI
+    if (isInitialized())
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+    return rank;
+}
+
+/**
+ * @brief Get the number of processes
+ * @return The size of MPI_COMM_WORLD, 1 without MPI
+ */
+inline int getSize()
+{
+    int size = 1;
+#ifdef MOLSIM_MPI
+    if (isInitialized())
+        MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+    return size;
+}
+
+/**
+ * @brief Sum a value over all ranks
+ * @param value The value of this rank
+ * @return The sum of all ranks
+ */
+inline double sum(double value)
+{
+#ifdef MOLSIM_MPI
+    if (getSize() > 1)
+        MPI_Allreduce(MPI_IN_PLACE, &value, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+    return value;
+}
+
+/**
+ * @brief Sum a count over all ranks
+ * @param value The count of this rank
+ * @return The sum of all ranks
+ */
+inline size_t sum(size_t value)
+{
+#ifdef MOLSIM_MPI
+    if (getSize() > 1) {
+        unsigned long long count = value;
+        MPI_Allreduce(MPI_IN_PLACE, &count, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+        value = static_cast<size_t>(count);
+    }
+#endif
+    return value;
+}
+
+/**
+ * @brief Sum a vector over all ranks
+ * @param value The vector of this rank
+ * @return The component-wise sum of all ranks
+ */
+inline std::array<double, 3> sum(std::array<double, 3> value)
+{
+#ifdef MOLSIM_MPI
+    if (getSize() > 1)
+        MPI_Allreduce(MPI_IN_PLACE, value.data(), 3, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+    return value;
+}
+
+} // namespace MPIUtils
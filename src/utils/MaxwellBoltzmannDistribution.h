@@ -10,6 +10,28 @@
 #include <array>
 #include <random>
 
+/**
+ * Get the random engine of the Maxwell-Boltzmann distribution.
+ *
+ * @return The engine, shared by all callers.
+ */
+inline std::default_random_engine& maxwellBoltzmannEngine()
+{
+    // we use a constant seed for repeatability.
+    // random engine needs static lifetime otherwise it would be recreated for every call.
+    static std::default_random_engine randomEngine(42);
+    return randomEngine;
+}
+
+/**
+ * Restart the random velocities from the constant seed, e.g. for every simulation of an ensemble,
+ * so it draws the velocities of a single simulation.
+ */
+inline void resetMaxwellBoltzmannSeed()
+{
+    maxwellBoltzmannEngine().seed(42);
+}
+
 /**
  * Generate a random velocity vector according to the Maxwell-Boltzmann distribution, with a given
  * average velocity.
@@ -22,16 +44,12 @@
 inline std::array<double, 3> maxwellBoltzmannDistributedVelocity(
     double averageVelocity, size_t dimensions)
 {
-    // we use a constant seed for repeatability.
-    // random engine needs static lifetime otherwise it would be recreated for every call.
-    static std::default_random_engine randomEngine(42);
-
     // when adding independent normally distributed values to all velocity components
     // the velocity change is maxwell boltzmann distributed
     std::normal_distribution<double> normalDistribution { 0, 1 };
     std::array<double, 3> randomVelocity {};
     for (size_t i = 0; i < dimensions; ++i) {
-        randomVelocity[i] = averageVelocity * normalDistribution(randomEngine);
+        randomVelocity[i] = averageVelocity * normalDistribution(maxwellBoltzmannEngine());
     }
     return randomVelocity;
 }
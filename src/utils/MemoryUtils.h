@@ -0,0 +1,55 @@
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <vector>
+
+/**
+ * @brief Heap bytes of the STL containers, used for the memory accounting
+ * @details The node sizes follow the libstdc++ layout (a list node has two pointers, a map node a
+ * color and three pointers) and ignore the bookkeeping of the allocator.
+ */
+namespace MemoryUtils {
+
+/** @brief Bytes of a std::list node besides its value */
+constexpr size_t listNodeOverhead = 2 * sizeof(void*);
+
+/** @brief Bytes of a std::map node besides its value */
+constexpr size_t mapNodeOverhead = 4 * sizeof(void*);
+
+/**
+ * @brief Get the heap bytes of a vector
+ * @param v The vector
+ * @return The bytes of its capacity, without the heap bytes of the elements
+ */
+template <typename T>
+inline size_t vectorBytes(const std::vector<T>& v)
+{
+    return v.capacity() * sizeof(T);
+}
+
+/**
+ * @brief Get the heap bytes of a list
+ * @param l The list
+ * @return The bytes of its nodes, without the heap bytes of the elements
+ */
+template <typename T>
+inline size_t listBytes(const std::list<T>& l)
+{
+    return l.size() * (listNodeOverhead + sizeof(T));
+}
+
+/**
+ * @brief Get the heap bytes of a map
+ * @param m The map
+ * @return The bytes of its nodes, without the heap bytes of the keys and values
+ */
+template <typename K, typename V, typename C, typename A>
+inline size_t mapBytes(const std::map<K, V, C, A>& m)
+{
+    return m.size() * (mapNodeOverhead + sizeof(typename std::map<K, V, C, A>::value_type));
+}
+
+} // namespace MemoryUtils
@@ -0,0 +1,222 @@
+
+#include "utils/NumaUtils.h"
+#include <algorithm>
+#include <fstream>
+#include <omp.h>
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+#include <sstream>
+#include <thread>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+/**
+ * @brief Read the first line of a file
+ * @param filename The file
+ * @return The line, empty if the file cannot be read
+ */
+std::string readLine(const std::string& filename)
+{
+    std::ifstream file(filename);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+/**
+ * @brief Get the CPUs the process may run on
+ * @return The CPUs in ascending order
+ */
+std::vector<int> allowedCpus()
+{
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set))
+                cpus.push_back(cpu);
+        }
+    }
+#endif
+    if (cpus.empty()) {
+        for (int cpu = 0; cpu < static_cast<int>(std::thread::hardware_concurrency()); ++cpu)
+            cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+} // namespace
+
+namespace NumaUtils {
+
+std::vector<int> parseCpuList(const std::string& list)
+{
+    std::vector<int> cpus;
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        const size_t dash = range.find('-');
+        try {
+            const int first = std::stoi(range.substr(0, dash));
+            const int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last; ++cpu)
+                cpus.push_back(cpu);
+        } catch (const std::exception&) {
+            // blank or malformed ranges are skipped
+        }
+    }
+    std::sort(cpus.begin(), cpus.end());
+    return cpus;
+}
+
+std::string formatCpuList(const std::vector<int>& cpus)
+{
+    std::string list;
+    for (size_t i = 0; i < cpus.size();) {
+        size_t last = i;
+        while (last + 1 < cpus.size() && cpus[last + 1] == cpus[last] + 1)
+            ++last;
+        list += list.empty() ? "" : ",";
+        list += last == i ? fmt::format("{}", cpus[i]) : fmt::format("{}-{}", cpus[i], cpus[last]);
+        i = last + 1;
+    }
+    return list;
+}
+
+std::map<int, std::vector<int>> getNodes()
+{
+    const std::vector<int> allowed = allowedCpus();
+    std::map<int, std::vector<int>> nodes;
+    for (int node : parseCpuList(readLine("/sys/devices/system/node/online"))) {
+        std::vector<int> cpus;
+        for (int cpu :
+            parseCpuList(readLine(fmt::format("/sys/devices/system/node/node{}/cpulist", node)))) {
+            if (std::binary_search(allowed.begin(), allowed.end(), cpu))
+                cpus.push_back(cpu);
+        }
+        if (!cpus.empty())
+            nodes[node] = cpus;
+    }
+    // without NUMA information all CPUs share the memory
+    if (nodes.empty())
+        nodes[0] = allowed;
+    return nodes;
+}
+
+std::vector<int> pinningOrder(const std::map<int, std::vector<int>>& nodes, PinningType pinning)
+{
+    std::vector<int> order;
+    if (pinning == PinningType::COMPACT) {
+        for (const auto& [node, cpus] : nodes)
+            order.insert(order.end(), cpus.begin(), cpus.end());
+        return order;
+    }
+    // scatter takes the next CPU of every node in turn
+    for (size_t i = 0;; ++i) {
+        const size_t before = order.size();
+        for (const auto& [node, cpus] : nodes) {
+            if (i < cpus.size())
+                order.push_back(cpus[i]);
+        }
+        if (order.size() == before)
+            return order;
+    }
+}
+
+void pinThreads(PinningType pinning)
+{
+    if (pinning == PinningType::UNPINNED)
+        return;
+#ifdef __linux__
+    const std::vector<int> order = pinningOrder(getNodes(), pinning);
+    if (order.empty())
+        return;
+    int failed = 0;
+#pragma omp parallel reduction(+ : failed)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(order[static_cast<size_t>(omp_get_thread_num()) % order.size()], &set);
+        failed += pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0;
+    }
+    if (failed)
+        spdlog::warn("{} threads could not be pinned", failed);
+    if (static_cast<size_t>(omp_get_max_threads()) > order.size())
+        spdlog::warn("{} threads share {} CPUs", omp_get_max_threads(), order.size());
+#else
+    spdlog::warn("Thread pinning is only supported on Linux");
+#endif
+}
+
+bool pinThread(const std::vector<int>& cpus)
+{
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus)
+        CPU_SET(cpu, &set);
+    return !cpus.empty() && pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    spdlog::warn("Thread pinning is only supported on Linux");
+    return false;
+#endif
+}
+
+std::vector<int> getThreadCpus()
+{
+    return allowedCpus();
+}
+
+void logTopology()
+{
+    const std::map<int, std::vector<int>> nodes = getNodes();
+    spdlog::info("NUMA nodes: {}", nodes.size());
+    for (const auto& [node, cpus] : nodes)
+        spdlog::info("  node {}: CPUs {}", node, formatCpuList(cpus));
+
+#ifdef __linux__
+    std::vector<int> threadCpus(static_cast<size_t>(omp_get_max_threads()), -1);
+#pragma omp parallel
+    {
+        const auto thread = static_cast<size_t>(omp_get_thread_num());
+        if (thread < threadCpus.size())
+            threadCpus[thread] = sched_getcpu();
+    }
+    std::map<int, size_t> threadsPerNode;
+    std::string threads;
+    for (size_t thread = 0; thread < threadCpus.size(); ++thread) {
+        threads += fmt::format("{}{}", thread ? " " : "", threadCpus[thread]);
+        for (const auto& [node, cpus] : nodes) {
+            if (std::binary_search(cpus.begin(), cpus.end(), threadCpus[thread]))
+                ++threadsPerNode[node];
+        }
+    }
+    spdlog::info("OpenMP threads on CPUs: {}", threads);
+    std::string perNode;
+    for (const auto& [node, count] : threadsPerNode)
+        perNode += fmt::format("{}node {}: {}", perNode.empty() ? "" : ", ", node, count);
+    spdlog::info("OpenMP threads per NUMA node: {}", perNode);
+#endif
+}
+
+void firstTouch(void* data, size_t bytes)
+{
+    size_t page = 4096;
+#ifdef __linux__
+    page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    char* begin = static_cast<char*>(data);
+    const auto pages = static_cast<long>((bytes + page - 1) / page);
+#pragma omp parallel for schedule(static)
+    for (long p = 0; p < pages; ++p)
+        begin[static_cast<size_t>(p) * page] = 0;
+}
+
+} // namespace NumaUtils
@@ -0,0 +1,115 @@
+
+#pragma once
+
+#include "utils/Params.h"
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Helpers to place threads and memory on the NUMA nodes of a multi-socket machine
+ * @details Linux places a page on the node of the thread that touches it first. The particles
+ * and cells are therefore first touched by the threads of a static OpenMP schedule, which is the
+ * schedule of the loops over them, and the threads can be pinned, so they stay next to their
+ * pages. Without NUMA information in /sys, all CPUs form a single node.
+ */
+namespace NumaUtils {
+
+/**
+ * @brief Parse a CPU list of the Linux sysfs, e.g. "0-3,8-11"
+ * @param list The list
+ * @return The CPUs in ascending order
+ */
+std::vector<int> parseCpuList(const std::string& list);
+
+/**
+ * @brief Format CPUs as a CPU list of the Linux sysfs
+ * @param cpus The CPUs in ascending order
+ * @return The list, e.g. "0-3,8-11"
+ */
+std::string formatCpuList(const std::vector<int>& cpus);
+
+/**
+ * @brief Get the CPUs of every NUMA node the process may run on
+ * @return The CPUs by node, nodes without allowed CPUs are left out
+ */
+std::map<int, std::vector<int>> getNodes();
+
+/**
+ * @brief Order the CPUs of the nodes in which the threads are pinned to them
+ * @param nodes The CPUs per node
+ * @param pinning Compact fills a node before the next one, scatter alternates the nodes
+ * @return The CPU of every thread, repeated if there are more threads than CPUs
+ */
+std::vector<int> pinningOrder(const std::map<int, std::vector<int>>& nodes, PinningType pinning);
+
+/**
+ * @brief Pin every OpenMP thread to a single CPU
+ * @details Must be called before the particles are allocated, so the first touch and the loops
+ * run on the same CPUs. The threads are reused by later parallel regions of the same size.
+ * @param pinning The placement, unpinned leaves the threads to the OpenMP runtime
+ */
+void pinThreads(PinningType pinning);
+
+/**
+ * @brief Pin the calling thread to a set of CPUs
+ * @details The nested parallel regions of the thread inherit the CPUs, e.g. the teams of the
+ * thread groups of an ensemble.
+ * @param cpus The CPUs
+ * @return Whether the thread was pinned
+ */
+bool pinThread(const std::vector<int>& cpus);
+
+/**
+ * @brief Get the CPUs the calling thread may run on
+ * @return The CPUs in ascending order
+ */
+std::vector<int> getThreadCpus();
+
+/**
+ * @brief Log the NUMA nodes and the CPU and node every OpenMP thread runs on
+ */
+void logTopology();
+
+/**
+ * @brief Touch the pages of a fresh allocation with the threads of a static schedule
+ * @param data The first byte
+ * @param bytes The number of bytes
+ */
+void firstTouch(void* data, size_t bytes);
+
+/**
+ * @brief Reserve the storage of an empty vector and first touch it in parallel
+ * @details Elements constructed later stay on the pages touched here, so a static loop over the
+ * vector finds its chunk on the node of its thread.
+ * @param v The vector, its storage is only replaced if it is empty
+ * @param n The number of elements
+ */
+template <typename T>
+inline void reserveFirstTouch(std::vector<T>& v, size_t n)
+{
+    if (!v.empty() || v.capacity() >= n)
+        return;
+    v.reserve(n);
+    firstTouch(v.data(), n * sizeof(T));
+}
+
+/**
+ * @brief Get the name of a pinning
+ * @param pinning The pinning
+ * @return The name used on the command line
+ */
+inline const char* getPinningName(PinningType pinning)
+{
+    switch (pinning) {
+    case PinningType::COMPACT:
+        return "compact";
+    case PinningType::SCATTER:
+        return "scatter";
+    default:
+        return "none";
+    }
+}
+
+} // namespace NumaUtils
@@ -1,20 +1,46 @@
 
 #pragma once
+#include "io/fileWriter/OutputFilter.h"
 #include "physics/boundaryConditions/BoundaryConfig.h"
 #include <array>
+#include <cstdlib>
 #include <string>
 #include "models/molecules/Molecule.h"
 #include <memory>
+#include <spdlog/spdlog.h>
 
 enum ReaderType { STANDARD, CLUSTER, EMPTY, ASCII, XML };
 
-enum class WriterType { XYZ, VTK, XML, EMPTY };
+enum class WriterType { XYZ, VTK, XML, EMPTY, TRAJ, SHM };
 
 enum SimulationType { PLANET, LJ, LINKED_LJ, DOMAIN_LJ, MIXED_LJ, MEMBRANE_LJ };
 
 enum ThermostatType { CLASSICAL, INDIVIDUAL, NONE };
 
-enum ParallelType { STATIC, TASK };
+enum ParallelType { STATIC, TASK, BALANCED, GRAPH, STEALING };
+
+enum PinningType { UNPINNED, COMPACT, SCATTER };
+
+/**
+ * @brief Get the name of a parallel strategy
+ * @param type The strategy
+ * @return The name used on the command line
+ */
+inline const char* getParallelTypeName(ParallelType type)
+{
+    switch (type) {
+    case ParallelType::TASK:
+        return "task";
+    case ParallelType::BALANCED:
+        return "balanced";
+    case ParallelType::GRAPH:
+        return "graph";
+    case ParallelType::STEALING:
+        return "stealing";
+    default:
+        return "static";
+    }
+}
 
 class Params {
 public:
@@ -73,6 +99,8 @@ public:
     std::vector<std::pair<double, double>> particleTypes;
     // map to particle types
     std::map<unsigned, std::pair<double, double>> typesMap;
+    // cutoff radius per particle type, the cutoff of a pair is their mean (at most the cutoff)
+    std::map<unsigned, double> typeCutoffs;
     // Flag for measuring performance -> will not use any io and time the simulation
     bool doPerformanceMeasurements = false;
     // List of all types which should be immobile
@@ -83,8 +111,78 @@ public:
     std::string outName = "analysis";
     // The interval to run the analyzer
     size_t analysisInterval = 100000;
+    // quantisation step of the positions in the compressed trajectory
+    double traj_precision = 0.001;
+    // quantisation step of the velocities in the compressed trajectory
+    double traj_velocity_precision = 0.001;
+    // store velocities in the compressed trajectory
+    bool traj_velocities = false;
+    // store particle types in the compressed trajectory
+    bool traj_types = true;
+    // fields, region, types and stride of the written particles
+    OutputFilter output_filter;
+    // maximum number of forked snapshot processes writing output, 0 to write synchronously
+    unsigned snapshots = 0;
+    // number of frames kept in the shared-memory ring buffer
+    unsigned shm_slots = 4;
+    // file to write the Chrome trace of the per-thread work to, empty to disable tracing
+    std::string trace_file;
+    // count hardware events per phase and thread with perf_event_open
+    bool perf_counters = false;
+    // write the load of every linked cell next to the particle output
+    bool cell_load = false;
+    // file to periodically write live metrics to in the Prometheus text format, empty to disable
+    std::string metrics_file;
+    // minimum number of seconds between two metrics exports
+    double metrics_interval = 10;
+    // account the memory of the data structures and report its peak and steady state
+    bool memory_report = false;
+    // only predict the peak memory from the input and exit without simulating
+    bool dry_run = false;
+    // number of particles the dry run predicts the memory for, 0 to count them in the input
+    size_t dry_run_particles = 0;
+    // number of force calculations between two partitions of the balanced parallel strategy
+    size_t balance_interval = 100;
+    // placement of the OpenMP threads on the CPUs of the NUMA nodes
+    PinningType thread_pinning = PinningType::UNPINNED;
+    // inner steps of the bonded membrane forces per time step (r-RESPA), 1 to disable
+    unsigned respa_steps = 1;
+    // size of the force calculation cells relative to the cutoff, 1 for the cells of the grid
+    double cell_size_factor = 1;
+    // number of MPI ranks per dimension the domain is split into, all 0 to choose them
+    std::array<int, 3> rank_grid { 0, 0, 0 };
+    // the input file lists the runs of an ensemble, which run concurrently in one process
+    bool ensemble = false;
+    // number of thread groups running the ensemble, 0 for one per run up to one per thread
+    size_t ensemble_groups = 0;
     // Molecules in the simulation
     std::vector<std::unique_ptr<Molecule>> molecules {};
 
+    /**
+     * @brief Set the inner steps of the bonded membrane forces, exits if there are none
+     * @param steps The inner steps per time step
+     */
+    inline void setRespaSteps(unsigned steps)
+    {
+        if (steps == 0) {
+            spdlog::error("The number of RESPA inner steps must be at least 1");
+            exit(EXIT_FAILURE);
+        }
+        respa_steps = steps;
+    }
+
+    /**
+     * @brief Set the size of the force calculation cells, exits if it is not in (0, 1]
+     * @param factor The size relative to the cutoff
+     */
+    inline void setCellSizeFactor(double factor)
+    {
+        if (!(factor > 0 && factor <= 1)) {
+            spdlog::error("The cell size factor must be in (0, 1]");
+            exit(EXIT_FAILURE);
+        }
+        cell_size_factor = factor;
+    }
+
     // TODO read the molecules from the input file (set any particle as root, will be overwritten)
 };
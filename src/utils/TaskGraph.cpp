@@ -0,0 +1,53 @@
+
+#include "utils/TaskGraph.h"
+#include <spdlog/spdlog.h>
+
+size_t TaskGraph::addTask(std::function<void()> work)
+{
+    tasks.push_back({ std::move(work), {}, 0 });
+    return tasks.size() - 1;
+}
+
+void TaskGraph::addDependency(size_t before, size_t after)
+{
+    tasks.at(before).successors.push_back(after);
+    ++tasks.at(after).predecessors;
+}
+
+void TaskGraph::run()
+{
+    pending = std::make_unique<std::atomic<size_t>[]>(tasks.size());
+    for (size_t task = 0; task < tasks.size(); ++task)
+        pending[task].store(tasks[task].predecessors, std::memory_order_relaxed);
+    finished.store(0, std::memory_order_relaxed);
+
+#pragma omp parallel
+#pragma omp single
+    for (size_t task = 0; task < tasks.size(); ++task) {
+        if (tasks[task].predecessors == 0) {
+#pragma omp task firstprivate(task)
+            execute(task);
+        }
+    }
+
+    // the tasks of a cycle never become ready
+    if (finished.load() != tasks.size()) {
+        spdlog::error("Only {} of {} tasks of the task graph ran, the dependencies form a cycle",
+            finished.load(),
+            tasks.size());
+        exit(EXIT_FAILURE);
+    }
+}
+
+void TaskGraph::execute(size_t task)
+{
+    tasks[task].work();
+    finished.fetch_add(1, std::memory_order_relaxed);
+    for (size_t successor : tasks[task].successors) {
+        // the last predecessor to finish spawns the successor and publishes its results to it
+        if (pending[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+#pragma omp task firstprivate(successor)
+            execute(successor);
+        }
+    }
+}
@@ -0,0 +1,65 @@
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * @class TaskGraph
+ * @brief Runs tasks as OpenMP tasks as soon as all tasks they depend on have finished
+ * @details Every task counts its unfinished predecessors. The thread finishing the last
+ * predecessor of a task spawns it, so there is no barrier between the stages of a graph and the
+ * idle threads of the OpenMP team take the spawned tasks from the other threads.
+ */
+class TaskGraph {
+public:
+    /**
+     * @brief Add a task
+     * @param work The work of the task
+     * @return The id of the task
+     */
+    size_t addTask(std::function<void()> work);
+
+    /**
+     * @brief Let a task wait for another one
+     * @param before The task that has to finish first
+     * @param after The task that waits for it
+     */
+    void addDependency(size_t before, size_t after);
+
+    /**
+     * @brief Run all tasks in a new OpenMP parallel region and return once they finished
+     * @details The tasks without predecessors are spawned in the order they were added. A graph
+     * can be run several times.
+     */
+    void run();
+
+    /**
+     * @brief Get the number of tasks
+     * @return The number of tasks
+     */
+    inline size_t size() const { return tasks.size(); }
+
+private:
+    /**
+     * @brief A task and its successors
+     */
+    struct Task {
+        std::function<void()> work; /**< The work of the task */
+        std::vector<size_t> successors; /**< The tasks waiting for this one */
+        size_t predecessors = 0; /**< The number of tasks this one waits for */
+    };
+
+    /**
+     * @brief Run a task and spawn the successors that no longer wait for another task
+     * @param task The id of the task
+     */
+    void execute(size_t task);
+
+    std::vector<Task> tasks; /**< The tasks by id */
+    std::unique_ptr<std::atomic<size_t>[]> pending; /**< The unfinished predecessors by id */
+    std::atomic<size_t> finished { 0 }; /**< The tasks finished in the current run */
+};
@@ -0,0 +1,82 @@
+
+#include "utils/WorkStealing.h"
+#include <omp.h>
+
+WorkStealingScheduler::WorkStealingScheduler(size_t chunksPerThread)
+    : chunksPerThread(chunksPerThread > 0 ? chunksPerThread : 1)
+{
+}
+
+std::vector<WorkChunk> WorkStealingScheduler::split(
+    const std::vector<size_t>& weights, size_t parts)
+{
+    std::vector<WorkChunk> result;
+    size_t total = 0;
+    for (size_t weight : weights)
+        total += weight;
+    const double target =
+        static_cast<double>(total) / static_cast<double>(parts > 0 ? parts : 1);
+
+    // a chunk ends once the weight before it reaches the next multiple of the target
+    size_t begin = 0;
+    size_t prefix = 0;
+    for (size_t item = 0; item < weights.size(); ++item) {
+        prefix += weights[item];
+        if (static_cast<double>(prefix) >= static_cast<double>(result.size() + 1) * target) {
+            result.push_back({ begin, item + 1 });
+            begin = item + 1;
+        }
+    }
+    if (begin < weights.size())
+        result.push_back({ begin, weights.size() });
+    return result;
+}
+
+void WorkStealingScheduler::run(
+    const std::vector<size_t>& weights, const std::function<void(size_t)>& work)
+{
+    const auto threads = static_cast<size_t>(omp_get_max_threads());
+    chunks = split(weights, threads * chunksPerThread);
+    deques = std::vector<WorkDeque>(threads);
+    steals.store(0);
+    // every thread starts with consecutive chunks, i.e. neighbouring items
+    for (size_t chunk = 0; chunk < chunks.size(); ++chunk)
+        deques[chunk * threads / chunks.size()].chunks.push_back(chunk);
+
+#pragma omp parallel num_threads(static_cast<int>(threads))
+    {
+        const auto thread = static_cast<size_t>(omp_get_thread_num());
+        size_t chunk = 0;
+        // no chunks are added during a run, so a thread is done once all deques are empty
+        while (pop(thread, chunk) || steal(thread, chunk)) {
+            for (size_t item = chunks[chunk].begin; item < chunks[chunk].end; ++item)
+                work(item);
+        }
+    }
+}
+
+bool WorkStealingScheduler::pop(size_t thread, size_t& chunk)
+{
+    WorkDeque& own = deques[thread];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (own.chunks.empty())
+        return false;
+    chunk = own.chunks.front();
+    own.chunks.pop_front();
+    return true;
+}
+
+bool WorkStealingScheduler::steal(size_t thread, size_t& chunk)
+{
+    for (size_t offset = 1; offset < deques.size(); ++offset) {
+        WorkDeque& victim = deques[(thread + offset) % deques.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.chunks.empty())
+            continue;
+        chunk = victim.chunks.back();
+        victim.chunks.pop_back();
+        steals.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
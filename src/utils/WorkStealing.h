@@ -0,0 +1,93 @@
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief A run of consecutive work items, i.e. all items in [begin, end)
+ */
+struct WorkChunk {
+    size_t begin; /**< The first item */
+    size_t end; /**< The item after the last one */
+};
+
+/**
+ * @class WorkStealingScheduler
+ * @brief Runs weighted work items on the threads of an OpenMP parallel region, where idle threads
+ * steal chunks of items from the others
+ * @details The items are cut into chunks of about the same weight, several per thread, and every
+ * thread gets a deque of consecutive chunks. A thread takes the chunks from the front of its own
+ * deque, so it moves through neighbouring items, and once it is empty it steals from the back of
+ * the deques of the other threads, i.e. the chunks their owners would reach last.
+ */
+class WorkStealingScheduler {
+public:
+    /**
+     * @brief Construct a new work stealing scheduler
+     * @param chunksPerThread The number of chunks per thread to cut the items into (default = 8)
+     */
+    explicit WorkStealingScheduler(size_t chunksPerThread = 8);
+
+    /**
+     * @brief Run the work of every item once in a new OpenMP parallel region
+     * @param weights The estimated cost of every item
+     * @param work The work of an item, called with its index
+     */
+    void run(const std::vector<size_t>& weights, const std::function<void(size_t)>& work);
+
+    /**
+     * @brief Get the number of chunks of the last run
+     * @return The chunks
+     */
+    inline size_t getChunkCount() const { return chunks.size(); }
+
+    /**
+     * @brief Get the number of chunks stolen in the last run
+     * @return The stolen chunks
+     */
+    inline size_t getSteals() const { return steals.load(); }
+
+    /**
+     * @brief Cut weighted items into consecutive chunks of about the same weight
+     * @param weights The weight of every item
+     * @param parts The number of chunks to cut the items into
+     * @return The chunks, fewer than parts if single items weigh more than a chunk
+     */
+    static std::vector<WorkChunk> split(const std::vector<size_t>& weights, size_t parts);
+
+private:
+    /**
+     * @brief The chunks of a thread, aligned so that the locks of two threads do not share a
+     * cache line
+     */
+    struct alignas(64) WorkDeque {
+        std::mutex mutex; /**< Guards the chunks */
+        std::deque<size_t> chunks; /**< The chunks left to calculate */
+    };
+
+    /**
+     * @brief Take the next chunk of a thread from the front of its own deque
+     * @param thread The thread
+     * @param chunk The taken chunk
+     * @return Whether there was a chunk left
+     */
+    bool pop(size_t thread, size_t& chunk);
+
+    /**
+     * @brief Take a chunk from the back of the deque of another thread
+     * @param thread The stealing thread
+     * @param chunk The stolen chunk
+     * @return Whether any other thread had a chunk left
+     */
+    bool steal(size_t thread, size_t& chunk);
+
+    size_t chunksPerThread; /**< The chunks per thread to cut the items into */
+    std::vector<WorkChunk> chunks; /**< The chunks of the current run */
+    std::vector<WorkDeque> deques; /**< The deque of every thread */
+    std::atomic<size_t> steals { 0 }; /**< The chunks stolen in the current run */
+};
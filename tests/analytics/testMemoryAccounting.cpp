@@ -0,0 +1,150 @@
+
+#include "analytics/Analyzer.h"
+#include "analytics/MemoryAccounting.h"
+#include "io/fileReader/emptyReader.h"
+#include "io/fileWriter/TrajectoryWriter.h"
+#include "io/fileWriter/emptyWriter.h"
+#include "models/generators/CuboidParticleCluster.h"
+#include "models/generators/ParticleGenerator.h"
+#include "models/molecules/Membrane.h"
+#include "physics/stratFactory.h"
+#include "physics/thermostat/ThermostatFactory.h"
+#include "simulation/MixedLJSimulation.h"
+#include "utils/Params.h"
+#include <gtest/gtest.h>
+
+class MemoryAccountingTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        spdlog::set_level(spdlog::level::off);
+        // a uniform 10x10 block filling the periodic 12x12 domain
+        ParticleGenerator generator(container);
+        generator.registerCluster(std::make_unique<CuboidParticleCluster>(
+            std::array<double, 3> { 0.6, 0.6, 0 },
+            10,
+            10,
+            1,
+            1.2,
+            1,
+            std::array<double, 3> { 0, 0, 0 },
+            0.1,
+            2,
+            std::map<unsigned, bool> {},
+            1));
+        generator.generateClusters();
+
+        params.simulation_type = SimulationType::MIXED_LJ;
+        params.writer_type = WriterType::EMPTY;
+        params.domain_origin = { 0, 0, 0 };
+        params.domain_size = { 12, 12, 0 };
+        params.cutoff = 3;
+        params.boundaryConfig = BoundaryConfig(BoundaryType::PERIODIC,
+            BoundaryType::PERIODIC,
+            BoundaryType::SOFT_REFLECTIVE,
+            BoundaryType::SOFT_REFLECTIVE);
+        params.bins = { 4, 2, 1 };
+    }
+
+    ParticleContainer container {};
+    PhysicsStrategy strat = stratFactory(SimulationType::MIXED_LJ, ParallelType::STATIC);
+    Params params;
+};
+
+// test if the tracker keeps the peak of every category and the mean of the second half
+TEST(MemoryTrackerTest, testPeakAndSteadyState)
+{
+    MemoryTracker tracker;
+    for (size_t bytes : { 100, 400, 200, 300 }) {
+        MemoryUsage usage;
+        usage[MemoryCategory::PARTICLES] = bytes;
+        usage[MemoryCategory::WRITER] = 500 - bytes;
+        tracker.add(usage);
+    }
+
+    EXPECT_EQ(tracker.getSampleCount(), 4);
+    EXPECT_EQ(tracker.getPeak()[MemoryCategory::PARTICLES], 400);
+    EXPECT_EQ(tracker.getPeak()[MemoryCategory::WRITER], 400);
+    EXPECT_EQ(tracker.getPeakTotal(), 500);
+    EXPECT_EQ(tracker.getSteadyState()[MemoryCategory::PARTICLES], 250);
+    EXPECT_EQ(tracker.getSteadyState()[MemoryCategory::WRITER], 250);
+    EXPECT_EQ(tracker.getSteadyState().total(), 500);
+
+    std::string table = memoryTable({ { "peak", tracker.getPeak() } }, 10);
+    EXPECT_NE(table.find("bytes/particle"), std::string::npos);
+    EXPECT_NE(table.find("total"), std::string::npos);
+    std::string json = memoryJson(tracker.getPeak(), tracker.getSteadyState(), 10);
+    EXPECT_NE(json.find("\"particles\": 400"), std::string::npos);
+    EXPECT_NE(json.find("\"bytesPerParticle\": 50"), std::string::npos);
+}
+
+// test if the data structures of a running simulation are measured and match the prediction
+TEST_F(MemoryAccountingTest, testMeasureAndPredict)
+{
+    MixedLJSimulation sim(0,
+        0.0005,
+        0.005,
+        container,
+        strat,
+        std::make_unique<EmptyFileWriter>(),
+        std::make_unique<EmptyFileReader>(""),
+        {},
+        { { 1, { 1, 1 } } },
+        params.domain_origin,
+        params.domain_size,
+        params.cutoff,
+        params.boundaryConfig,
+        std::make_unique<Analyzer>(params.bins, ""),
+        0,
+        thermostatFactory(ThermostatType::CLASSICAL, 0, 0, 10, 2),
+        10,
+        10,
+        100,
+        true,
+        1000);
+    sim.runSim();
+
+    MemoryUsage measured = measureMemory(sim);
+    EXPECT_EQ(measured[MemoryCategory::PARTICLES], 100 * sizeof(Particle));
+    EXPECT_EQ(measured[MemoryCategory::CELLS], sim.getGrid().getMemoryBytes());
+    EXPECT_GT(measured[MemoryCategory::GHOSTS], 40 * sizeof(Particle));
+    EXPECT_EQ(measured[MemoryCategory::TOPOLOGY], 0);
+    EXPECT_EQ(measured[MemoryCategory::ANALYZER], 2 * 8 * sizeof(double));
+
+    MemoryUsage predicted = predictMemory(params, 100, 0);
+    EXPECT_EQ(predicted[MemoryCategory::PARTICLES], measured[MemoryCategory::PARTICLES]);
+    EXPECT_EQ(predicted[MemoryCategory::ANALYZER], measured[MemoryCategory::ANALYZER]);
+    // the empty grid is measured, the particle lists are derived from the particle count
+    EXPECT_NEAR(predicted[MemoryCategory::CELLS], measured[MemoryCategory::CELLS], 100 * 8);
+    // a quarter of the particles is within one cell of each periodic side
+    EXPECT_EQ(predicted[MemoryCategory::GHOSTS] / (sizeof(Particle) + 32), 50);
+}
+
+// test if the membrane topology is measured and bounded by its prediction
+TEST_F(MemoryAccountingTest, testTopology)
+{
+    Membrane membrane { { 0, 0, 0 }, 10, 10, 1, 1, 1, { 0, 0, 0 }, 0, 3, 1, 1, 20 };
+    ParticleContainer membraneContainer {};
+    membrane.generateMolecule(membraneContainer, 1);
+    const size_t measured = membrane.getTopologyBytes();
+    EXPECT_GT(measured, 0);
+
+    // the particles on the edges have fewer neighbors than predicted
+    params.simulation_type = SimulationType::MEMBRANE_LJ;
+    const size_t predicted = predictMemory(params, 0, 100)[MemoryCategory::TOPOLOGY];
+    EXPECT_GE(predicted, measured);
+    EXPECT_LT(predicted, measured * 13 / 10);
+
+    // membranes are ignored by other simulations
+    params.simulation_type = SimulationType::MIXED_LJ;
+    EXPECT_EQ(predictMemory(params, 0, 100)[MemoryCategory::TOPOLOGY], 0);
+}
+
+// test if the writers estimate the memory of one output
+TEST(MemoryWriterTest, testEstimate)
+{
+    EXPECT_EQ(EmptyFileWriter().estimateBytes(1000), 0);
+    outputWriter::TrajectoryWriter trajectory("", 0.001, 0.001, false, true);
+    // positions and types in the frame, their quantised integers and the payload
+    EXPECT_EQ(trajectory.estimateBytes(1000), 1000 * (24 + 4 + 2 * (24 + 8)));
+}
@@ -0,0 +1,77 @@
+
+#include "analytics/MetricsExporter.h"
+#include "io/fileReader/emptyReader.h"
+#include "io/fileWriter/emptyWriter.h"
+#include "physics/forceCal/forceCal.h"
+#include "physics/locationCal/locationCal.h"
+#include "physics/strategy.h"
+#include "physics/velocityCal/velocityCal.h"
+#include "simulation/planetSim.h"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+
+class MetricsExporterTest : public ::testing::Test {
+protected:
+    PhysicsStrategy strat { location_stroemer_verlet, velocity_stroemer_verlet, force_gravity };
+    ParticleContainer particles { std::vector<Particle> {
+        Particle { { 0, 0, 0 }, { 1, 0, 0 }, 1, 0 },
+        Particle { { 1, 0, 0 }, { 0, 2, 0 }, 2, 0 } } };
+    PlanetSimulation sim { 0,
+                           0.01,
+                           0.095,
+                           particles,
+                           strat,
+                           std::make_unique<EmptyFileWriter>(),
+                           std::make_unique<EmptyFileReader>(""),
+                           {},
+                           4 };
+};
+
+// test if the metrics of a finished run are formatted in the Prometheus text format
+TEST_F(MetricsExporterTest, testFormat)
+{
+    spdlog::set_level(spdlog::level::off);
+    sim.runSim();
+    MetricsExporter exporter("", 10, 2);
+    // reset the particles to known velocities for the temperature
+    particles.particles[0].setV({ 1, 0, 0 });
+    particles.particles[1].setV({ 0, 2, 0 });
+    std::string metrics = exporter.format(sim);
+
+    EXPECT_NE(metrics.find("# TYPE molsim_iteration gauge\nmolsim_iteration 10\n"),
+        std::string::npos);
+    EXPECT_NE(metrics.find("molsim_particles 2\n"), std::string::npos);
+    EXPECT_NE(metrics.find("molsim_particle_updates_total 20\n"), std::string::npos);
+    // (1 * 1 + 2 * 4) / (2 particles * 2 dimensions)
+    EXPECT_NE(metrics.find("molsim_temperature 2.25\n"), std::string::npos);
+    // the writer ran in iteration 8
+    EXPECT_NE(metrics.find("molsim_output_lag_iterations 2\n"), std::string::npos);
+    EXPECT_NE(metrics.find("molsim_phase_calls_total{phase=\"calF\"} 10\n"), std::string::npos);
+}
+
+// test if the metrics file is written and only rewritten after the interval
+TEST_F(MetricsExporterTest, testWrite)
+{
+    std::string name = (std::filesystem::temp_directory_path() / "molsim_metrics.prom").string();
+    MetricsExporter exporter(name, 3600, 3);
+    ASSERT_TRUE(exporter.write(sim));
+    EXPECT_FALSE(std::filesystem::exists(name + ".tmp"));
+
+    std::ifstream file(name);
+    std::stringstream content;
+    content << file.rdbuf();
+    EXPECT_NE(content.str().find("molsim_iteration 0\n"), std::string::npos);
+
+    sim.iteration = 5;
+    exporter.update(sim);
+    std::ifstream again(name);
+    content.str("");
+    content << again.rdbuf();
+    EXPECT_NE(content.str().find("molsim_iteration 0\n"), std::string::npos);
+    std::filesystem::remove(name);
+
+    MetricsExporter invalid("/nonexistent/dir/metrics.prom", 0, 3);
+    EXPECT_FALSE(invalid.write(sim));
+}
@@ -0,0 +1,39 @@
+
+#include "analytics/PerfCounters.h"
+#include <gtest/gtest.h>
+
+// test if counted work is accounted to its phase, if counters are available on this system
+TEST(PerfCountersTest, testPhases)
+{
+    PhaseTimer timer;
+    if (!timer.enableCounters())
+        GTEST_SKIP() << "perf_event_open is not permitted on this system";
+    const PerfCounters* counters = timer.getCounters();
+    ASSERT_NE(counters, nullptr);
+    EXPECT_GE(counters->getThreadCount(), 1);
+
+    volatile double sum = 0;
+    timer.time(Phase::FORCE, [&] {
+        for (int i = 0; i < 1000000; ++i)
+            sum = sum + i;
+    });
+    timer.time(Phase::WRITER, [] {});
+
+    if (counters->isAvailable(Counter::INSTRUCTIONS)) {
+        auto force = counters->getTotal(Phase::FORCE)[static_cast<size_t>(Counter::INSTRUCTIONS)];
+        auto writer = counters->getTotal(Phase::WRITER)[static_cast<size_t>(Counter::INSTRUCTIONS)];
+        EXPECT_GT(force, 1000000);
+        EXPECT_LT(writer, force);
+    }
+    EXPECT_EQ(counters->getTotal(Phase::VELOCITY), CounterValues {});
+    EXPECT_NE(timer.summary().find("instructions"), std::string::npos);
+}
+
+// test if the counters stay disabled by default
+TEST(PerfCountersTest, testDisabled)
+{
+    PhaseTimer timer;
+    EXPECT_EQ(timer.getCounters(), nullptr);
+    EXPECT_EQ(timer.summary().find("instructions"), std::string::npos);
+    EXPECT_STREQ(PerfCounters::getName(Counter::LLC_MISSES), "llcMisses");
+}
@@ -0,0 +1,56 @@
+
+#include "analytics/PhaseTimer.h"
+#include "io/fileReader/emptyReader.h"
+#include "io/fileWriter/emptyWriter.h"
+#include "physics/forceCal/forceCal.h"
+#include "physics/locationCal/locationCal.h"
+#include "physics/strategy.h"
+#include "physics/velocityCal/velocityCal.h"
+#include "simulation/planetSim.h"
+#include <gtest/gtest.h>
+
+// test if recorded durations are aggregated per phase
+TEST(PhaseTimerTest, testRecord)
+{
+    PhaseTimer timer;
+    timer.record(Phase::FORCE, std::chrono::milliseconds(2));
+    timer.record(Phase::FORCE, std::chrono::milliseconds(6));
+    timer.record(Phase::WRITER, std::chrono::milliseconds(4));
+
+    const PhaseStats& force = timer.getStats(Phase::FORCE);
+    EXPECT_EQ(force.calls, 2);
+    EXPECT_DOUBLE_EQ(force.min, 0.002);
+    EXPECT_DOUBLE_EQ(force.max, 0.006);
+    EXPECT_DOUBLE_EQ(force.mean(), 0.004);
+    EXPECT_EQ(timer.getStats(Phase::VELOCITY).calls, 0);
+    EXPECT_DOUBLE_EQ(timer.getStats(Phase::VELOCITY).mean(), 0);
+    EXPECT_DOUBLE_EQ(timer.getTotal(), 0.012);
+
+    std::string summary = timer.summary();
+    EXPECT_NE(summary.find("calF"), std::string::npos);
+    EXPECT_NE(summary.find("writer"), std::string::npos);
+    EXPECT_EQ(summary.find("calV"), std::string::npos);
+}
+
+// test if every step of a simulation is timed
+TEST(PhaseTimerTest, testSimulation)
+{
+    ParticleContainer particles { std::vector<Particle> {
+        Particle { { 0, 0, 0 }, { 0, 1, 0 }, 1, 0 },
+        Particle { { 1, 0, 0 }, { 0, 0, 0 }, 1, 0 } } };
+    PhysicsStrategy strat { location_stroemer_verlet, velocity_stroemer_verlet, force_gravity };
+    PlanetSimulation sim { 0,
+        0.1,
+        1,
+        particles,
+        strat,
+        std::make_unique<EmptyFileWriter>(),
+        std::make_unique<EmptyFileReader>(""),
+        {},
+        5 };
+    sim.runSim();
+
+    EXPECT_EQ(sim.phaseTimer.getStats(Phase::FORCE).calls, sim.iteration);
+    EXPECT_EQ(sim.phaseTimer.getStats(Phase::POSITION).calls, sim.iteration);
+    EXPECT_EQ(sim.phaseTimer.getStats(Phase::WRITER).calls, sim.iteration / 5);
+}
@@ -0,0 +1,71 @@
+
+#include "analytics/RunReport.h"
+#include "io/fileReader/emptyReader.h"
+#include "io/fileWriter/emptyWriter.h"
+#include "physics/forceCal/forceCal.h"
+#include "physics/locationCal/locationCal.h"
+#include "physics/strategy.h"
+#include "physics/velocityCal/velocityCal.h"
+#include "simulation/linkedLennardJonesSim.h"
+#include "simulation/planetSim.h"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+// test if the pair checks follow the cell stencil and only close pairs are counted as in cutoff
+TEST(RunReportTest, testCountPairs)
+{
+    ParticleContainer particles { std::vector<Particle> {
+        Particle { { 1, 1, 0 }, { 0, 0, 0 }, 1, 0 },
+        Particle { { 1.5, 1, 0 }, { 0, 0, 0 }, 1, 0 },
+        Particle { { 3.6, 1, 0 }, { 0, 0, 0 }, 1, 0 },
+        Particle { { 9, 9, 0 }, { 0, 0, 0 }, 1, 0 } } };
+    CellGrid grid { { 0, 0, 0 }, { 10, 10, 1 }, 2.5 };
+    grid.addParticlesFromContainer(particles);
+
+    PairStatistics stats = countPairs(grid);
+    // one pair inside the first cell, two pairs with its right neighbour
+    EXPECT_EQ(stats.checks, 3);
+    EXPECT_EQ(stats.inCutoff, 2);
+}
+
+// test if the report contains the run statistics
+TEST(RunReportTest, testReport)
+{
+    std::string input = (std::filesystem::temp_directory_path() / "molsim_report_input").string();
+    std::ofstream(input) << "input";
+    Params params;
+    params.input_file = input;
+    params.parallel_type = ParallelType::TASK;
+
+    ParticleContainer particles { std::vector<Particle> {
+        Particle { { 0, 0, 0 }, { 0, 1, 0 }, 1, 0 },
+        Particle { { 1, 0, 0 }, { 0, 0, 0 }, 1, 0 },
+        Particle { { 0, 1, 0 }, { 0, 0, 0 }, 1, 0 } } };
+    PhysicsStrategy strat { location_stroemer_verlet, velocity_stroemer_verlet, force_gravity };
+    PlanetSimulation sim { 0,
+        0.1,
+        1,
+        particles,
+        strat,
+        std::make_unique<EmptyFileWriter>(),
+        std::make_unique<EmptyFileReader>(""),
+        {} };
+    sim.runSim();
+    EXPECT_EQ(sim.particleUpdates, 3ULL * sim.iteration);
+
+    std::string report = runReportJson(sim, params, 2);
+    EXPECT_NE(report.find("\"parallelType\": \"task\""), std::string::npos);
+    EXPECT_NE(report.find(fmt::format("\"iterations\": {}", sim.iteration)), std::string::npos);
+    EXPECT_NE(report.find("\"pairChecks\": 3"), std::string::npos);
+    EXPECT_NE(report.find(fmt::format("\"inputHash\": \"{:016x}\"", hashFile(input))),
+        std::string::npos);
+    EXPECT_NE(report.find("\"calF\": { \"calls\": "), std::string::npos);
+    EXPECT_EQ(report.find("\"thermostat\""), std::string::npos);
+    EXPECT_GT(peakResidentSetSize(), 0);
+
+    // the FNV-1a hash of "input"
+    EXPECT_EQ(hashFile(input), 0x1ebbae8f5810b65bULL);
+    EXPECT_EQ(hashFile(input + "_missing"), 0);
+    std::filesystem::remove(input);
+}
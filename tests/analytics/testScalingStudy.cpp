@@ -0,0 +1,82 @@
+
+#include "analytics/ScalingStudy.h"
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace {
+
+ScalingResult makeResult(ScalingMode mode, int threads, double time)
+{
+    ScalingResult r;
+    r.mode = mode;
+    r.threads = threads;
+    r.particles = mode == ScalingMode::WEAK ? 1000 * threads : 1000;
+    r.steps = 10;
+    r.time = time;
+    return r;
+}
+
+} // namespace
+
+// test if speedup and efficiency are computed against the smallest thread count
+TEST(ScalingStudyTest, testSpeedup)
+{
+    std::vector<ScalingResult> results { makeResult(ScalingMode::STRONG, 1, 8),
+                                         makeResult(ScalingMode::STRONG, 4, 4),
+                                         makeResult(ScalingMode::WEAK, 1, 2),
+                                         makeResult(ScalingMode::WEAK, 4, 2.5) };
+    computeSpeedup(results);
+
+    EXPECT_DOUBLE_EQ(results[0].speedup, 1);
+    EXPECT_DOUBLE_EQ(results[0].efficiency, 1);
+    EXPECT_DOUBLE_EQ(results[1].speedup, 2);
+    EXPECT_DOUBLE_EQ(results[1].efficiency, 0.5);
+    EXPECT_DOUBLE_EQ(results[3].efficiency, 0.8);
+    EXPECT_DOUBLE_EQ(results[3].speedup, 3.2);
+}
+
+// test if written results are read back as baseline and matched per case
+TEST(ScalingStudyTest, testBaseline)
+{
+    std::vector<ScalingResult> baseline { makeResult(ScalingMode::STRONG, 1, 8),
+                                          makeResult(ScalingMode::STRONG, 2, 5) };
+    baseline[1].parallelType = ParallelType::TASK;
+    computeSpeedup(baseline);
+    std::stringstream csv(scalingCsv(baseline));
+    auto parsed = parseScalingCsv(csv);
+    ASSERT_EQ(parsed.size(), 2);
+    EXPECT_EQ(parsed[1].parallelType, ParallelType::TASK);
+    EXPECT_EQ(parsed[1].threads, 2);
+    EXPECT_DOUBLE_EQ(parsed[1].time, 5);
+
+    std::vector<ScalingResult> results { makeResult(ScalingMode::STRONG, 1, 10),
+                                         makeResult(ScalingMode::STRONG, 2, 5),
+                                         makeResult(ScalingMode::WEAK, 1, 1) };
+    EXPECT_EQ(applyBaseline(results, parsed), 1);
+    EXPECT_DOUBLE_EQ(results[0].baselineTime, 8);
+    // the baseline of 2 threads used the task strategy
+    EXPECT_DOUBLE_EQ(results[1].baselineTime, 0);
+
+    std::string json = scalingJson(results);
+    EXPECT_NE(json.find("\"change\": 0.2500"), std::string::npos);
+    EXPECT_NE(scalingCsv(results).find(",8.000000,0.2500\n"), std::string::npos);
+}
+
+// test if a small study runs every case
+TEST(ScalingStudyTest, testRunStudy)
+{
+    ScalingConfig config;
+    config.threads = { 1, 2 };
+    config.particles = 125;
+    config.steps = 3;
+    auto results = runScalingStudy(config);
+
+    ASSERT_EQ(results.size(), 8);
+    EXPECT_EQ(results[0].particles, 125);
+    EXPECT_EQ(results[4].mode, ScalingMode::WEAK);
+    EXPECT_EQ(results[5].particles, 250);
+    for (const auto& r : results) {
+        EXPECT_GT(r.time, 0);
+        EXPECT_GT(r.mups, 0);
+    }
+}
@@ -0,0 +1,58 @@
+
+#include "analytics/Tracer.h"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <omp.h>
+#include <sstream>
+
+// test if nothing is recorded while the tracer is disabled
+TEST(TracerTest, testDisabled)
+{
+    Tracer::disable();
+    {
+        TraceScope scope("work", "test");
+    }
+    EXPECT_EQ(Tracer::getEventCount(), 0);
+}
+
+// test if every thread records its spans and full buffers drop events
+TEST(TracerTest, testRecord)
+{
+    Tracer::enable(4);
+#pragma omp parallel for
+    for (int i = 0; i < 8; ++i) {
+        TraceScope scope("work", "test", i);
+    }
+    EXPECT_EQ(Tracer::getEventCount() + Tracer::getDroppedEvents(), 8);
+    if (omp_get_max_threads() == 1) {
+        EXPECT_EQ(Tracer::getDroppedEvents(), 4);
+    }
+    Tracer::disable();
+}
+
+// test if the dump is a Chrome trace with complete events
+TEST(TracerTest, testDump)
+{
+    std::string name = (std::filesystem::temp_directory_path() / "molsim_trace.json").string();
+    Tracer::enable();
+    {
+        TraceScope scope("work", "test", 42);
+    }
+    {
+        TraceScope scope("other", "test");
+    }
+    Tracer::dump(name);
+    Tracer::disable();
+
+    std::ifstream file(name);
+    std::stringstream content;
+    content << file.rdbuf();
+    std::string trace = content.str();
+    EXPECT_EQ(trace.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0);
+    EXPECT_NE(trace.find("\"name\":\"work\",\"cat\":\"test\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"args\":{\"index\":42}"), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"other\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"M\""), std::string::npos);
+    std::filesystem::remove(name);
+}
@@ -0,0 +1,88 @@
+
+#pragma once
+
+#include "analytics/Analyzer.h"
+#include "io/fileReader/emptyReader.h"
+#include "io/fileWriter/emptyWriter.h"
+#include "physics/strategy.h"
+#include "physics/thermostat/ThermostatFactory.h"
+#include "simulation/MixedLJSimulation.h"
+#include "utils/ArrayUtils.h"
+#include <functional>
+#include <map>
+#include <random>
+
+/**
+ * @brief Place particles at random positions in a cube, no two closer than a distance, so no
+ * force dominates the sums
+ * @param count The number of particles
+ * @param low The lower bound of every coordinate
+ * @param high The upper bound of every coordinate
+ * @param minDistance The smallest distance of two particles
+ * @param seed The seed of the positions
+ * @param create Creates the particle of an index at a position
+ * @return The particles
+ */
+inline ParticleContainer createRandomParticles(size_t count,
+    double low,
+    double high,
+    double minDistance,
+    unsigned seed,
+    const std::function<Particle(const std::array<double, 3>&, size_t)>& create)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> position(low, high);
+    std::vector<Particle> particles;
+    while (particles.size() < count) {
+        std::array<double, 3> x { position(generator), position(generator), position(generator) };
+        bool overlaps = false;
+        for (const Particle& other : particles)
+            overlaps |= ArrayUtils::L2Norm(other.getX() - x) < minDistance;
+        if (!overlaps)
+            particles.push_back(create(x, particles.size()));
+    }
+    return ParticleContainer { particles };
+}
+
+/**
+ * @brief Create a 3D mixed LJ simulation of a cube without gravity, thermostat or output
+ * @param container The particles
+ * @param strat The strategy
+ * @param endTime The end time, the time step is 0.0005
+ * @param ljParams The epsilon and sigma of every type
+ * @param domainSize The size of the cube
+ * @param cutoff The cutoff radius
+ * @param boundary The boundary of every side
+ * @return The simulation
+ */
+inline std::unique_ptr<MixedLJSimulation> createMixedLJSimulation(ParticleContainer& container,
+    PhysicsStrategy& strat,
+    double endTime,
+    const std::map<unsigned, std::pair<double, double>>& ljParams,
+    double domainSize,
+    double cutoff,
+    BoundaryType boundary)
+{
+    return std::make_unique<MixedLJSimulation>(0,
+        0.0005,
+        endTime,
+        container,
+        strat,
+        std::make_unique<EmptyFileWriter>(),
+        std::make_unique<EmptyFileReader>(""),
+        std::map<unsigned, bool> {},
+        ljParams,
+        std::array<double, 3> { 0, 0, 0 },
+        std::array<double, 3> { domainSize, domainSize, domainSize },
+        cutoff,
+        BoundaryConfig(boundary, boundary, boundary, boundary, boundary, boundary),
+        std::make_unique<Analyzer>(std::array<size_t, 3> { 1, 1, 1 }, ""),
+        0,
+        thermostatFactory(ThermostatType::CLASSICAL, 0, 0, 10, 3),
+        0,
+        10,
+        0,
+        true,
+        0,
+        false);
+}
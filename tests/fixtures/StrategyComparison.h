@@ -0,0 +1,156 @@
+
+#pragma once
+
+#include "analytics/Analyzer.h"
+#include "io/fileReader/emptyReader.h"
+#include "io/fileWriter/emptyWriter.h"
+#include "models/generators/CuboidParticleCluster.h"
+#include "models/generators/ParticleGenerator.h"
+#include "physics/stratFactory.h"
+#include "physics/thermostat/ThermostatFactory.h"
+#include "simulation/MixedLJSimulation.h"
+#include <gtest/gtest.h>
+#include <map>
+
+/**
+ * @brief A block of particles in a mixed LJ domain, run under different parallel strategies
+ */
+struct BlockSetup {
+    std::array<double, 3> corner; /**< The lower left corner of the block */
+    std::array<size_t, 3> size; /**< The particles of the block per dimension */
+    double spacing; /**< The distance of neighbouring particles */
+    std::array<double, 3> velocity; /**< The initial velocity of the block */
+    std::array<double, 3> domainSize; /**< The size of the domain, 0 in z for 2D */
+    double endTime; /**< The end time of the runs */
+    BoundaryConfig config; /**< The boundaries of the domain */
+    unsigned updateFrequency = 1; /**< The iterations between two cell updates */
+};
+
+/**
+ * @brief Get the dense block in one corner of a 2D domain, which leaves most cells empty
+ * @return The setup of the block
+ */
+inline BlockSetup denseCorner()
+{
+    return { { 1, 1, 0 },
+        { 8, 8, 1 },
+        1.1225,
+        { 0, 0, 0 },
+        { 30, 30, 0 },
+        0.1,
+        BoundaryConfig(BoundaryType::SOFT_REFLECTIVE,
+            BoundaryType::SOFT_REFLECTIVE,
+            BoundaryType::SOFT_REFLECTIVE,
+            BoundaryType::SOFT_REFLECTIVE) };
+}
+
+/**
+ * @class StrategyComparison
+ * @brief Runs the same block under a parallel strategy and under the static strategy
+ * @details The simulations are accessible before they run, e.g. to set the balance interval, and
+ * afterwards, e.g. to check the phases of the strategy.
+ */
+class StrategyComparison {
+public:
+    /**
+     * @brief Generate the block twice and set up both simulations
+     * @param type The parallel strategy compared with the static one
+     * @param setup The block and its domain
+     */
+    StrategyComparison(ParallelType type, const BlockSetup& setup)
+        : staticStrat(stratFactory(SimulationType::MIXED_LJ, ParallelType::STATIC))
+        , strat(stratFactory(SimulationType::MIXED_LJ, type))
+    {
+        spdlog::set_level(spdlog::level::off);
+        const size_t dimensions = setup.domainSize[2] > 0 ? 3 : 2;
+        ParticleGenerator generator(reference);
+        generator.registerCluster(std::make_unique<CuboidParticleCluster>(setup.corner,
+            setup.size[0],
+            setup.size[1],
+            setup.size[2],
+            setup.spacing,
+            1,
+            setup.velocity,
+            0.5,
+            dimensions,
+            std::map<unsigned, bool> {},
+            1));
+        generator.generateClusters();
+        particles = ParticleContainer(reference.particles);
+
+        serial = createSimulation(reference, staticStrat, setup, dimensions);
+        sim = createSimulation(particles, strat, setup, dimensions);
+    }
+
+    /**
+     * @brief Run both simulations
+     */
+    void run()
+    {
+        serial->runSim();
+        sim->runSim();
+    }
+
+    /**
+     * @brief Check that the strategy ends with the particles of the static strategy
+     */
+    void expectMatchesStatic() const
+    {
+        ASSERT_EQ(particles.activeParticleCount, reference.activeParticleCount);
+        ASSERT_EQ(particles.particles.size(), reference.particles.size());
+        for (size_t i = 0; i < reference.particles.size(); ++i) {
+            const Particle& expected = reference.particles[i];
+            const Particle& actual = particles.particles[i];
+            ASSERT_EQ(actual.getActivity(), expected.getActivity());
+            for (size_t d = 0; d < 3; ++d) {
+                EXPECT_NEAR(actual.getX()[d], expected.getX()[d], 1e-9);
+                EXPECT_NEAR(actual.getV()[d], expected.getV()[d], 1e-9);
+            }
+        }
+    }
+
+    ParticleContainer reference {}; /**< The particles of the static strategy */
+    ParticleContainer particles {}; /**< The particles of the compared strategy */
+    PhysicsStrategy staticStrat; /**< The static strategy */
+    PhysicsStrategy strat; /**< The compared strategy */
+    std::unique_ptr<MixedLJSimulation> serial; /**< The simulation of the static strategy */
+    std::unique_ptr<MixedLJSimulation> sim; /**< The simulation of the compared strategy */
+
+private:
+    /**
+     * @brief Create a simulation of the block
+     * @param container The particles
+     * @param strategy The strategy
+     * @param setup The block and its domain
+     * @param dimensions The dimensions of the domain
+     * @return The simulation
+     */
+    static std::unique_ptr<MixedLJSimulation> createSimulation(ParticleContainer& container,
+        PhysicsStrategy& strategy,
+        const BlockSetup& setup,
+        size_t dimensions)
+    {
+        return std::make_unique<MixedLJSimulation>(0,
+            0.0005,
+            setup.endTime,
+            container,
+            strategy,
+            std::make_unique<EmptyFileWriter>(),
+            std::make_unique<EmptyFileReader>(""),
+            std::map<unsigned, bool> {},
+            std::map<unsigned, std::pair<double, double>> { { 1, { 1, 1 } } },
+            std::array<double, 3> { 0, 0, 0 },
+            setup.domainSize,
+            3,
+            setup.config,
+            nullptr,
+            -12.44,
+            thermostatFactory(ThermostatType::CLASSICAL, 0, 0, 10, dimensions),
+            1000,
+            setup.updateFrequency,
+            1000,
+            true,
+            0,
+            false);
+    }
+};
@@ -0,0 +1,63 @@
+
+#include "analytics/CellLoad.h"
+#include "io/fileWriter/CellLoadWriter.h"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+
+class cellLoadTest : public ::testing::Test {
+protected:
+    ParticleContainer particles { std::vector<Particle> {
+        Particle { { 1, 1, 0 }, { 0, 0, 0 }, 1, 0 },
+        Particle { { 1.5, 1, 0 }, { 0, 0, 0 }, 1, 0 },
+        Particle { { 3.6, 1, 0 }, { 0, 0, 0 }, 1, 0 } } };
+    CellGrid grid { { 0, 0, 0 }, { 10, 5, 0 }, 2.5 };
+
+    cellLoadTest() { grid.addParticlesFromContainer(particles); }
+};
+
+// test if the force time is only measured while the grid records the load
+TEST_F(cellLoadTest, testScope)
+{
+    Cell& cell = *grid.cells[1][1][0];
+    {
+        CellLoadScope load(grid, cell);
+    }
+    EXPECT_EQ(cell.forceTime, 0);
+
+    grid.recordLoad = true;
+    {
+        CellLoadScope load(grid, cell);
+    }
+    EXPECT_GT(cell.forceTime, 0);
+}
+
+// test if the load is written as image data with one value per cell
+TEST_F(cellLoadTest, testWriteLoad)
+{
+    std::string name = (std::filesystem::temp_directory_path() / "molsim").string();
+    grid.cells[1][1][0]->forceTime = 4;
+    outputWriter::CellLoadWriter::writeLoad(grid, name, 20, 2);
+    EXPECT_EQ(grid.cells[1][1][0]->forceTime, 0);
+
+    std::ifstream file(name + "_load_0020.vti");
+    ASSERT_TRUE(file.is_open());
+    std::stringstream content;
+    content << file.rdbuf();
+    std::string vti = content.str();
+
+    // 4 x 2 cells plus the halo layer in x and y
+    EXPECT_NE(vti.find("WholeExtent=\"0 6 0 4 0 0\""), std::string::npos);
+    EXPECT_NE(vti.find("Origin=\"-2.5 -2.5 0\""), std::string::npos);
+    // the first cell row is halo, the second starts with the cell of the first two particles
+    EXPECT_NE(vti.find("Name=\"particles\" format=\"ascii\">\n          0 0 0 0 0 0 0 2 1 0"),
+        std::string::npos);
+    EXPECT_NE(vti.find("Name=\"pairChecks\" format=\"ascii\">\n          0 0 0 0 0 0 0 3 0 0"),
+        std::string::npos);
+    EXPECT_NE(vti.find("Name=\"interactions\" format=\"ascii\">\n          0 0 0 0 0 0 0 2 0 0"),
+        std::string::npos);
+    EXPECT_NE(vti.find("Name=\"forceTime\" format=\"ascii\">\n          0 0 0 0 0 0 0 2 0 0"),
+        std::string::npos);
+    std::filesystem::remove(name + "_load_0020.vti");
+}
@@ -0,0 +1,75 @@
+
+#include "io/fileReader/emptyReader.h"
+#include "io/fileWriter/XYZWriter.h"
+#include "physics/forceCal/forceCal.h"
+#include "physics/locationCal/locationCal.h"
+#include "physics/strategy.h"
+#include "physics/velocityCal/velocityCal.h"
+#include "simulation/planetSim.h"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+// test if field, type and region lists are parsed and invalid lists are rejected
+TEST(outputFilterTest, testParse)
+{
+    OutputFilter filter;
+    EXPECT_TRUE(filter.selectsAll());
+
+    EXPECT_TRUE(filter.setFields("type, velocity"));
+    EXPECT_FALSE(filter.writeMass);
+    EXPECT_TRUE(filter.writeVelocity);
+    EXPECT_FALSE(filter.writeForce);
+    EXPECT_TRUE(filter.writeType);
+    EXPECT_FALSE(filter.setFields("type,position"));
+    EXPECT_TRUE(filter.writeType);
+
+    EXPECT_TRUE(filter.setTypes("1,3"));
+    EXPECT_EQ(filter.types, (std::set<int> { 1, 3 }));
+    EXPECT_FALSE(filter.setTypes("1,a"));
+
+    EXPECT_TRUE(filter.setRegion("0,0,-1,10,5,1"));
+    EXPECT_EQ(filter.regionMax, (std::array<double, 3> { 10, 5, 1 }));
+    EXPECT_FALSE(filter.setRegion("0,0,0,1,1"));
+    EXPECT_FALSE(filter.selectsAll());
+}
+
+// test if particles are selected by region, type and id
+TEST(outputFilterTest, testAccepts)
+{
+    OutputFilter filter;
+    filter.setRegion("0,0,0,10,10,10");
+    filter.setTypes("1");
+    filter.stride = 2;
+
+    EXPECT_TRUE(filter.accepts(Particle { { 5, 5, 5 }, { 0, 0, 0 }, 1, 1, 4 }));
+    EXPECT_TRUE(filter.accepts(Particle { { 10, 0, 5 }, { 0, 0, 0 }, 1, 1, 0 }));
+    EXPECT_FALSE(filter.accepts(Particle { { 5, 5, 5 }, { 0, 0, 0 }, 1, 1, 3 }));
+    EXPECT_FALSE(filter.accepts(Particle { { 5, 5, 5 }, { 0, 0, 0 }, 1, 0, 4 }));
+    EXPECT_FALSE(filter.accepts(Particle { { 5, 11, 5 }, { 0, 0, 0 }, 1, 1, 4 }));
+}
+
+// test if the XYZWriter only writes the selected particles
+TEST(outputFilterTest, testXYZWriter)
+{
+    std::string name = (std::filesystem::temp_directory_path() / "molsim_filter_test").string();
+    ParticleContainer particles { {} };
+    particles = std::vector<Particle> { Particle { { 0, 0, 0 }, { 0, 0, 0 }, 1, 0, 0 },
+                                        Particle { { 1, 0, 0 }, { 0, 0, 0 }, 1, 1, 1 },
+                                        Particle { { 2, 0, 0 }, { 0, 0, 0 }, 1, 1, 2 } };
+    PhysicsStrategy strat { location_stroemer_verlet, velocity_stroemer_verlet, force_gravity };
+    auto writer = std::make_unique<outputWriter::XYZWriter>(name);
+    writer->filter.setTypes("1");
+    auto* writerPtr = writer.get();
+    PlanetSimulation sim {
+        0, 0.01, 1, particles, strat, std::move(writer), std::make_unique<EmptyFileReader>(""), {}
+    };
+
+    writerPtr->plotParticles(sim);
+
+    std::ifstream file(name + "_0000.xyz");
+    size_t count;
+    file >> count;
+    EXPECT_EQ(count, 2);
+    std::filesystem::remove(name + "_0000.xyz");
+}
@@ -0,0 +1,139 @@
+
+#include "io/fileReader/emptyReader.h"
+#include "io/fileWriter/SharedMemoryWriter.h"
+#include "io/shm/ShmFrameReader.h"
+#include "physics/forceCal/forceCal.h"
+#include "physics/locationCal/locationCal.h"
+#include "physics/strategy.h"
+#include "physics/velocityCal/velocityCal.h"
+#include "simulation/planetSim.h"
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+class sharedMemoryTest : public ::testing::Test {
+protected:
+    std::string name = "shm_test_" + std::to_string(getpid());
+    ParticleContainer particles { std::vector<Particle> {
+        Particle { { 0, 1, 2 }, { 3, 4, 5 }, 1, 7 },
+        Particle { { 1, 1, 1 }, { 0, 0, 0 }, 1, 2 } } };
+    PhysicsStrategy strat { location_stroemer_verlet, velocity_stroemer_verlet, force_gravity };
+};
+
+// test if published frames are read in order with their particle data
+TEST_F(sharedMemoryTest, testPublishAndRead)
+{
+    auto writer = std::make_unique<outputWriter::SharedMemoryWriter>(name, 4);
+    auto* writerPtr = writer.get();
+    PlanetSimulation sim {
+        0, 0.01, 1, particles, strat, std::move(writer), std::make_unique<EmptyFileReader>(""), {}
+    };
+
+    writerPtr->plotParticles(sim);
+    ShmFrameReader reader(name);
+    ShmFrame frame;
+    ASSERT_TRUE(reader.next(frame));
+    EXPECT_EQ(frame.sequence, 1);
+    ASSERT_EQ(frame.particles.size(), 2);
+    EXPECT_EQ(frame.particles[0].x[2], 2);
+    EXPECT_EQ(frame.particles[0].v[1], 4);
+    EXPECT_EQ(frame.particles[0].type, 7);
+    EXPECT_EQ(frame.particles[1].type, 2);
+    EXPECT_FALSE(reader.next(frame));
+
+    sim.iteration = 10;
+    writerPtr->plotParticles(sim);
+    ASSERT_TRUE(reader.next(frame));
+    EXPECT_EQ(frame.iteration, 10);
+    EXPECT_FALSE(reader.finished());
+    EXPECT_EQ(reader.getLostFrames(), 0);
+}
+
+// test if a slow reader skips overwritten frames instead of stalling the writer
+TEST_F(sharedMemoryTest, testSlowReader)
+{
+    auto writer = std::make_unique<outputWriter::SharedMemoryWriter>(name, 2);
+    auto* writerPtr = writer.get();
+    PlanetSimulation sim {
+        0, 0.01, 1, particles, strat, std::move(writer), std::make_unique<EmptyFileReader>(""), {}
+    };
+
+    writerPtr->plotParticles(sim);
+    ShmFrameReader reader(name);
+    for (unsigned i = 1; i <= 5; ++i) {
+        sim.iteration = i;
+        writerPtr->plotParticles(sim);
+    }
+
+    ShmFrame frame;
+    ASSERT_TRUE(reader.next(frame));
+    EXPECT_EQ(frame.iteration, 4);
+    ASSERT_TRUE(reader.next(frame));
+    EXPECT_EQ(frame.iteration, 5);
+    EXPECT_FALSE(reader.next(frame));
+    EXPECT_EQ(reader.getLostFrames(), 4);
+}
+
+// test if attaching to a missing segment fails
+TEST_F(sharedMemoryTest, testMissing)
+{
+    EXPECT_THROW(ShmFrameReader reader(name + "_missing"), std::runtime_error);
+}
+
+// test if the ring of a running simulation is not replaced by a second writer of the same name
+TEST_F(sharedMemoryTest, testLiveSegment)
+{
+    auto writer = std::make_unique<outputWriter::SharedMemoryWriter>(name, 2);
+    auto* writerPtr = writer.get();
+    PlanetSimulation sim {
+        0, 0.01, 1, particles, strat, std::move(writer), std::make_unique<EmptyFileReader>(""), {}
+    };
+    writerPtr->plotParticles(sim);
+
+    outputWriter::SharedMemoryWriter second(name, 2);
+    EXPECT_EXIT(second.plotParticles(sim), ::testing::ExitedWithCode(EXIT_FAILURE), "");
+
+    // the consumers of the first ring stay attached
+    ShmFrameReader reader(name);
+    ShmFrame frame;
+    EXPECT_TRUE(reader.next(frame));
+}
+
+// test if the ring left over by a crashed simulation is replaced
+TEST_F(sharedMemoryTest, testStaleSegment)
+{
+    pid_t crashed = fork();
+    if (crashed == 0)
+        _exit(EXIT_SUCCESS);
+    waitpid(crashed, nullptr, 0);
+
+    const std::string segment = shmSegmentName(name);
+    const size_t size = shmSegmentSize(1, 1);
+    int fd = shm_open(segment.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(ftruncate(fd, static_cast<off_t>(size)), 0);
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    ASSERT_NE(memory, MAP_FAILED);
+    auto* header = static_cast<ShmRingHeader*>(memory);
+    header->version = SHM_RING_VERSION;
+    header->slotCount = 1;
+    header->slotCapacity = 1;
+    header->producer = crashed;
+    header->magic.store(SHM_RING_MAGIC);
+    munmap(memory, size);
+
+    auto writer = std::make_unique<outputWriter::SharedMemoryWriter>(name, 2);
+    auto* writerPtr = writer.get();
+    PlanetSimulation sim {
+        0, 0.01, 1, particles, strat, std::move(writer), std::make_unique<EmptyFileReader>(""), {}
+    };
+    writerPtr->plotParticles(sim);
+
+    ShmFrameReader reader(name);
+    ShmFrame frame;
+    ASSERT_TRUE(reader.next(frame));
+    EXPECT_EQ(frame.particles.size(), 2);
+}
@@ -0,0 +1,115 @@
+
+#include "io/fileReader/emptyReader.h"
+#include "io/fileWriter/SnapshotWriter.h"
+#include "io/fileWriter/TrajectoryWriter.h"
+#include "io/trajectory/TrajectoryReader.h"
+#include "physics/forceCal/forceCal.h"
+#include "physics/locationCal/locationCal.h"
+#include "physics/strategy.h"
+#include "physics/velocityCal/velocityCal.h"
+#include "simulation/planetSim.h"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+// writes the number of particles and the iteration, or fails if requested
+class CountWriter : public FileWriter {
+public:
+    explicit CountWriter(std::string out_name, bool fail = false)
+        : FileWriter(out_name)
+        , fail(fail)
+    {
+    }
+
+    void plotParticles(const Simulation& s) override
+    {
+        if (fail)
+            throw std::runtime_error("disk full");
+        std::ofstream file(out_name + "_" + std::to_string(s.iteration));
+        file << s.container.view().size();
+    }
+
+    bool fail;
+};
+
+class snapshotWriterTest : public ::testing::Test {
+protected:
+    std::string name = (std::filesystem::temp_directory_path() / "molsim_snapshot_test").string();
+    ParticleContainer particles { std::vector<Particle> {
+        Particle { { 0, 0, 0 }, { 0, 0, 0 }, 1 }, Particle { { 1, 0, 0 }, { 0, 0, 0 }, 1 } } };
+    PhysicsStrategy strat { location_stroemer_verlet, velocity_stroemer_verlet, force_gravity };
+};
+
+// test if snapshots are written by the children and the number of children is bounded
+TEST_F(snapshotWriterTest, testSnapshots)
+{
+    auto writer
+        = std::make_unique<outputWriter::SnapshotWriter>(std::make_unique<CountWriter>(name), 2);
+    auto* writerPtr = writer.get();
+    PlanetSimulation sim {
+        0, 0.01, 1, particles, strat, std::move(writer), std::make_unique<EmptyFileReader>(""), {}
+    };
+
+    for (unsigned i = 0; i < 5; ++i) {
+        sim.iteration = i;
+        writerPtr->plotParticles(sim);
+        EXPECT_LE(writerPtr->getRunningSnapshots(), 2);
+    }
+    writerPtr->waitAll();
+    EXPECT_EQ(writerPtr->getRunningSnapshots(), 0);
+    EXPECT_EQ(writerPtr->getFailedSnapshots(), 0);
+
+    for (unsigned i = 0; i < 5; ++i) {
+        std::ifstream file(name + "_" + std::to_string(i));
+        size_t count = 0;
+        file >> count;
+        EXPECT_EQ(count, 2);
+        std::filesystem::remove(name + "_" + std::to_string(i));
+    }
+}
+
+// test if failing snapshots are reported to the parent
+TEST_F(snapshotWriterTest, testFailure)
+{
+    auto writer = std::make_unique<outputWriter::SnapshotWriter>(
+        std::make_unique<CountWriter>(name, true), 1);
+    auto* writerPtr = writer.get();
+    PlanetSimulation sim {
+        0, 0.01, 1, particles, strat, std::move(writer), std::make_unique<EmptyFileReader>(""), {}
+    };
+
+    writerPtr->plotParticles(sim);
+    writerPtr->plotParticles(sim);
+    writerPtr->waitAll();
+    EXPECT_EQ(writerPtr->getFailedSnapshots(), 2);
+}
+
+// test if the frames of a trajectory, which are appended to one file, are all written
+TEST_F(snapshotWriterTest, testTrajectory)
+{
+    auto writer = std::make_unique<outputWriter::SnapshotWriter>(
+        std::make_unique<outputWriter::TrajectoryWriter>(name, 1e-3, 1e-3, false, false), 4);
+    auto* writerPtr = writer.get();
+    PlanetSimulation sim {
+        0, 0.01, 1, particles, strat, std::move(writer), std::make_unique<EmptyFileReader>(""), {}
+    };
+
+    for (unsigned i = 0; i < 5; ++i) {
+        sim.iteration = i;
+        writerPtr->plotParticles(sim);
+        EXPECT_EQ(writerPtr->getRunningSnapshots(), 0);
+    }
+    writerPtr->waitAll();
+
+    TrajectoryReader reader(name + ".mtr");
+    TrajectoryFrame frame;
+    for (unsigned i = 0; i < 5; ++i) {
+        ASSERT_TRUE(reader.readFrame(frame));
+        EXPECT_EQ(frame.iteration, i);
+        ASSERT_EQ(frame.positions.size(), 2);
+        EXPECT_NEAR(frame.positions[1][0], 1, 1e-3);
+    }
+    EXPECT_FALSE(reader.readFrame(frame));
+    std::filesystem::remove(name + ".mtr");
+}
@@ -0,0 +1,140 @@
+
+#include "io/fileReader/emptyReader.h"
+#include "io/fileWriter/TrajectoryWriter.h"
+#include "io/trajectory/TrajectoryCodec.h"
+#include "io/trajectory/TrajectoryReader.h"
+#include "physics/forceCal/forceCal.h"
+#include "physics/locationCal/locationCal.h"
+#include "physics/strategy.h"
+#include "physics/velocityCal/velocityCal.h"
+#include "simulation/planetSim.h"
+#include <cmath>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <sstream>
+
+class trajectoryTest : public ::testing::Test {
+protected:
+    double precision = 1e-3;
+    TrajectoryFrame frame;
+
+    trajectoryTest()
+    {
+        // a 2D grid with some noise and a few particles far away
+        frame.positionPrecision = precision;
+        frame.velocityPrecision = precision;
+        frame.flags = TRAJ_VELOCITIES | TRAJ_TYPES;
+        for (int x = 0; x < 40; ++x) {
+            for (int y = 0; y < 25; ++y) {
+                double noise = std::sin(x * 7 + y * 13) * 0.05;
+                frame.positions.push_back({ x * 1.1225 + noise, y * 1.1225 - noise, 0 });
+                frame.velocities.push_back({ noise, -2 * noise, 0 });
+                frame.types.push_back(y < 12 ? 0 : 1);
+            }
+        }
+        frame.positions.push_back({ -1e6, 3e5, 42.5 });
+        frame.velocities.push_back({ 1e4, 0, -1e4 });
+        frame.types.push_back(-7);
+        frame.iteration = 1234;
+        frame.time = 17.276;
+    }
+};
+
+// test if positions, velocities and types survive encoding within the precision
+TEST_F(trajectoryTest, testRoundTrip)
+{
+    std::stringstream stream;
+    trajectory::writeHeader(stream);
+    trajectory::writeFrame(stream, frame);
+    trajectory::writeFrame(stream, frame);
+
+    TrajectoryFrame decoded;
+    trajectory::readHeader(stream);
+    for (int n = 0; n < 2; ++n) {
+        ASSERT_TRUE(trajectory::readFrame(stream, decoded));
+        EXPECT_EQ(decoded.iteration, frame.iteration);
+        EXPECT_DOUBLE_EQ(decoded.time, frame.time);
+        ASSERT_EQ(decoded.positions.size(), frame.positions.size());
+        ASSERT_EQ(decoded.velocities.size(), frame.velocities.size());
+        EXPECT_EQ(decoded.types, frame.types);
+        for (size_t i = 0; i < frame.positions.size(); ++i) {
+            for (size_t d = 0; d < 3; ++d) {
+                EXPECT_NEAR(decoded.positions[i][d], frame.positions[i][d], precision / 2);
+                EXPECT_NEAR(decoded.velocities[i][d], frame.velocities[i][d], precision / 2);
+            }
+        }
+    }
+    EXPECT_FALSE(trajectory::readFrame(stream, decoded));
+}
+
+// test if a frame is much smaller than the raw double representation
+TEST_F(trajectoryTest, testCompression)
+{
+    std::stringstream stream;
+    frame.flags = TRAJ_TYPES;
+    trajectory::writeFrame(stream, frame);
+
+    size_t raw = frame.positions.size() * 3 * sizeof(double);
+    EXPECT_LT(stream.str().size() * 3, raw);
+}
+
+// test if truncated, oversized and foreign files are rejected
+TEST_F(trajectoryTest, testCorrupted)
+{
+    std::stringstream stream;
+    trajectory::writeFrame(stream, frame);
+    std::string data = stream.str();
+
+    std::stringstream truncated(data.substr(0, data.size() - 10));
+    TrajectoryFrame decoded;
+    EXPECT_THROW(trajectory::readFrame(truncated, decoded), std::runtime_error);
+
+    // the particle count and the payload size are bounded by the file
+    const size_t sizeOffset = sizeof(uint32_t);
+    const size_t countOffset = sizeOffset + sizeof(uint64_t) + sizeof(uint32_t) + sizeof(double);
+    for (size_t offset : { sizeOffset, countOffset }) {
+        std::string corrupted = data;
+        const uint64_t huge = uint64_t { 1 } << 60;
+        corrupted.replace(offset, sizeof(huge), reinterpret_cast<const char*>(&huge), sizeof(huge));
+        std::stringstream oversized(corrupted);
+        EXPECT_THROW(trajectory::readFrame(oversized, decoded), std::runtime_error);
+    }
+
+    std::stringstream foreign("not a trajectory");
+    EXPECT_THROW(trajectory::readHeader(foreign), std::runtime_error);
+}
+
+// test if the writer appends one frame per call which can be read back
+TEST_F(trajectoryTest, testWriterReader)
+{
+    std::string name = (std::filesystem::temp_directory_path() / "molsim_traj_test").string();
+    ParticleContainer particles { {} };
+    particles = std::vector<Particle> { Particle { { 0.5, 1.25, 0 }, { 1, 0, 0 }, 1, 2 },
+                                        Particle { { 3.3331, -4, 0 }, { 0, 1, 0 }, 1, 5 } };
+    PhysicsStrategy strat { location_stroemer_verlet, velocity_stroemer_verlet, force_gravity };
+    auto writer = std::make_unique<outputWriter::TrajectoryWriter>(
+        name, precision, precision, false, true);
+    auto* writerPtr = writer.get();
+    PlanetSimulation sim {
+        0, 0.01, 1, particles, strat, std::move(writer), std::make_unique<EmptyFileReader>(""), {}
+    };
+
+    writerPtr->plotParticles(sim);
+    sim.iteration = 10;
+    writerPtr->plotParticles(sim);
+    // flushed after every frame, so the file can be read while the simulation is running
+    TrajectoryReader reader(name + ".mtr");
+    TrajectoryFrame decoded;
+    ASSERT_TRUE(reader.readFrame(decoded));
+    EXPECT_EQ(decoded.iteration, 0);
+    ASSERT_TRUE(reader.readFrame(decoded));
+    EXPECT_EQ(decoded.iteration, 10);
+    EXPECT_FALSE(reader.readFrame(decoded));
+
+    ASSERT_EQ(decoded.positions.size(), 2);
+    EXPECT_TRUE(decoded.velocities.empty());
+    EXPECT_EQ(decoded.types, (std::vector<int> { 2, 5 }));
+    EXPECT_NEAR(decoded.positions[1][0], 3.3331, precision / 2);
+
+    std::filesystem::remove(name + ".mtr");
+}
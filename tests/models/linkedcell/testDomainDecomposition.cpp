@@ -0,0 +1,151 @@
+
+#include "analytics/Analyzer.h"
+#include "io/fileReader/emptyReader.h"
+#include "io/fileWriter/emptyWriter.h"
+#include "models/generators/CuboidParticleCluster.h"
+#include "models/generators/ParticleGenerator.h"
+#include "models/linked_cell/CellGrid.h"
+#include "models/linked_cell/DomainDecomposition.h"
+#include "physics/stratFactory.h"
+#include "physics/thermostat/ThermostatFactory.h"
+#include "simulation/MixedLJSimulation.h"
+#include <gtest/gtest.h>
+#include <map>
+
+// test if the domain is split along whole cells and the sides are connected to the right ranks
+TEST(DomainDecomposition, testGeometry)
+{
+    BoundaryConfig config(BoundaryType::PERIODIC,
+        BoundaryType::PERIODIC,
+        BoundaryType::SOFT_REFLECTIVE,
+        BoundaryType::SOFT_REFLECTIVE);
+    DomainDecomposition upperRight(3, 4, { 0, 0, 0 }, { 12, 12, 0 }, 3, config);
+
+    EXPECT_EQ(upperRight.getRankGrid(), (std::array<int, 3> { 2, 2, 1 }));
+    EXPECT_EQ(upperRight.getCoordinates(), (std::array<int, 3> { 1, 1, 0 }));
+    EXPECT_EQ(upperRight.getLocalOrigin(), (std::array<double, 3> { 6, 6, 0 }));
+    EXPECT_EQ(upperRight.getLocalSize(), (std::array<double, 3> { 6, 6, 0 }));
+    EXPECT_EQ(upperRight.getNeighbor(Position::LEFT), 1);
+    EXPECT_EQ(upperRight.getNeighbor(Position::RIGHT), 1);
+    EXPECT_EQ(upperRight.getNeighbor(Position::BOTTOM), 2);
+    EXPECT_EQ(upperRight.getNeighbor(Position::TOP), -1);
+
+    const auto& local = upperRight.getLocalBoundaryConfig().boundaryMap;
+    EXPECT_EQ(local.at(Position::LEFT), BoundaryType::RANK);
+    EXPECT_EQ(local.at(Position::RIGHT), BoundaryType::RANK);
+    EXPECT_EQ(local.at(Position::BOTTOM), BoundaryType::RANK);
+    EXPECT_EQ(local.at(Position::TOP), BoundaryType::SOFT_REFLECTIVE);
+
+    // the last rank of a dimension takes the cells that are left over
+    DomainDecomposition uneven(2, 3, { 0, 0, 0 }, { 12, 12, 0 }, 3, config, { 3, 1, 1 });
+    EXPECT_EQ(uneven.getLocalOrigin(), (std::array<double, 3> { 6, 0, 0 }));
+    EXPECT_EQ(uneven.getLocalSize(), (std::array<double, 3> { 6, 12, 0 }));
+}
+
+// test if only the cells next to an exchanged halo wait for the halo exchange
+TEST(DomainDecomposition, testSplitCells)
+{
+    BoundaryConfig config(BoundaryType::PERIODIC,
+        BoundaryType::PERIODIC,
+        BoundaryType::SOFT_REFLECTIVE,
+        BoundaryType::SOFT_REFLECTIVE);
+    DomainDecomposition upperRight(3, 4, { 0, 0, 0 }, { 24, 24, 0 }, 3, config);
+    CellGrid grid(upperRight.getLocalOrigin(), upperRight.getLocalSize(), 3);
+    upperRight.splitCells(grid);
+
+    // the 4x4 local cells are exchanged on the left, right and bottom, but not on the top
+    ASSERT_EQ(upperRight.getInteriorCells().size(), 6);
+    EXPECT_EQ(upperRight.getBoundaryCells().size(), 10);
+    for (const CellIndex& index : upperRight.getInteriorCells()) {
+        EXPECT_GE(index[0], 2);
+        EXPECT_LE(index[0], 3);
+        EXPECT_GE(index[1], 2);
+        EXPECT_LE(index[1], 4);
+        EXPECT_EQ(index[2], 0);
+    }
+}
+
+// test if the rank grid with the smallest halo is chosen
+TEST(DomainDecomposition, testChooseRankGrid)
+{
+    EXPECT_EQ(DomainDecomposition::chooseRankGrid(6, { 6, 3, 1 }, 2),
+        (std::array<int, 3> { 3, 2, 1 }));
+    EXPECT_EQ(DomainDecomposition::chooseRankGrid(8, { 4, 4, 4 }, 3),
+        (std::array<int, 3> { 2, 2, 2 }));
+    // the z dimension of a 2D domain is never split
+    EXPECT_EQ(DomainDecomposition::chooseRankGrid(4, { 1, 4, 4 }, 2),
+        (std::array<int, 3> { 1, 4, 1 }));
+    EXPECT_EQ(DomainDecomposition::chooseRankGrid(5, { 4, 4, 1 }, 2),
+        (std::array<int, 3> { 0, 0, 0 }));
+}
+
+// test if a single rank exchanging the halos with itself matches the periodic boundaries
+TEST(DomainDecomposition, testSelfExchangeMatchesPeriodic)
+{
+    spdlog::set_level(spdlog::level::off);
+    ParticleContainer reference {};
+    ParticleGenerator generator(reference);
+    generator.registerCluster(std::make_unique<CuboidParticleCluster>(
+        std::array<double, 3> { 0, 0, 0 },
+        10,
+        10,
+        1,
+        1.2,
+        1,
+        std::array<double, 3> { 0, 0, 0 },
+        0.5,
+        2,
+        std::map<unsigned, bool> {},
+        1));
+    // the particles on the periodic sides cross them
+    generator.generateClusters();
+    ParticleContainer decomposed(reference.particles);
+
+    const BoundaryConfig config(BoundaryType::PERIODIC,
+        BoundaryType::PERIODIC,
+        BoundaryType::PERIODIC,
+        BoundaryType::PERIODIC);
+    PhysicsStrategy strat = stratFactory(SimulationType::MIXED_LJ, ParallelType::STATIC);
+    auto makeSim = [&](ParticleContainer& container,
+                       std::unique_ptr<DomainDecomposition> decomposition) {
+        return std::make_unique<MixedLJSimulation>(0,
+            0.0005,
+            0.1,
+            container,
+            strat,
+            std::make_unique<EmptyFileWriter>(),
+            std::make_unique<EmptyFileReader>(""),
+            std::map<unsigned, bool> {},
+            std::map<unsigned, std::pair<double, double>> { { 1, { 1, 1 } } },
+            std::array<double, 3> { 0, 0, 0 },
+            std::array<double, 3> { 12, 12, 0 },
+            3,
+            decomposition ? decomposition->getLocalBoundaryConfig() : config,
+            nullptr,
+            0,
+            thermostatFactory(ThermostatType::CLASSICAL, 0, 0, 10, 2),
+            1000,
+            1,
+            1000,
+            true,
+            0,
+            false,
+            std::move(decomposition));
+    };
+
+    auto serial = makeSim(reference, nullptr);
+    auto single = makeSim(decomposed,
+        std::make_unique<DomainDecomposition>(0, 1, std::array<double, 3> { 0, 0, 0 },
+            std::array<double, 3> { 12, 12, 0 }, 3, config));
+    serial->runSim();
+    single->runSim();
+
+    ASSERT_EQ(decomposed.activeParticleCount, reference.activeParticleCount);
+    std::map<size_t, std::array<double, 3>> positions;
+    for (auto& particle : reference)
+        positions[particle.getID()] = particle.getX();
+    for (auto& particle : decomposed) {
+        for (size_t d = 0; d < 3; ++d)
+            EXPECT_NEAR(particle.getX()[d], positions.at(particle.getID())[d], 1e-9);
+    }
+}
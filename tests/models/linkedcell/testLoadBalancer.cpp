@@ -0,0 +1,94 @@
+
+#include "fixtures/StrategyComparison.h"
+#include "models/linked_cell/LoadBalancer.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+/**
+ * @brief Check that the blocks cover every column exactly once
+ * @param blocks The blocks of a partition
+ * @param xColumns The number of columns in x
+ * @param yColumns The number of columns in y
+ */
+void expectCovered(const std::vector<ColumnBlock>& blocks, size_t xColumns, size_t yColumns)
+{
+    std::vector<int> covered(xColumns * yColumns, 0);
+    for (const ColumnBlock& block : blocks) {
+        for (size_t x = block.xBegin; x < block.xEnd; ++x) {
+            for (size_t y = block.yBegin; y < block.yEnd; ++y)
+                ++covered[(x - 1) * yColumns + (y - 1)];
+        }
+    }
+    for (int count : covered)
+        EXPECT_EQ(count, 1);
+}
+
+} // namespace
+
+// test if columns of the same cost are split into blocks of the same size
+TEST(LoadBalancer, testBisectUniform)
+{
+    std::vector<ColumnBlock> blocks =
+        LoadBalancer::bisect(std::vector<double>(64, 1.0), 8, 8, 4);
+
+    ASSERT_EQ(blocks.size(), 4);
+    for (const ColumnBlock& block : blocks)
+        EXPECT_EQ(block.size(), 16);
+    expectCovered(blocks, 8, 8);
+
+    // without any measured cost every column counts the same
+    blocks = LoadBalancer::bisect(std::vector<double>(64, 0.0), 8, 8, 4);
+    for (const ColumnBlock& block : blocks)
+        EXPECT_EQ(block.size(), 16);
+}
+
+// test if a dense region is shared between the blocks
+TEST(LoadBalancer, testBisectSkewed)
+{
+    // the columns with x <= 2 cost ten times as much as the others
+    std::vector<double> cost(64, 1.0);
+    for (size_t i = 0; i < 16; ++i)
+        cost[i] = 10;
+    std::vector<ColumnBlock> blocks = LoadBalancer::bisect(cost, 8, 8, 4);
+
+    ASSERT_EQ(blocks.size(), 4);
+    expectCovered(blocks, 8, 8);
+    const double total = 16 * 10 + 48;
+    for (const ColumnBlock& block : blocks) {
+        double blockCost = 0;
+        for (size_t x = block.xBegin; x < block.xEnd; ++x) {
+            for (size_t y = block.yBegin; y < block.yEnd; ++y)
+                blockCost += cost[(x - 1) * 8 + (y - 1)];
+        }
+        // the uniform split would give one block 80% of the cost
+        EXPECT_LT(blockCost, 0.35 * total);
+    }
+}
+
+// test if surplus blocks are empty when there are fewer columns than blocks
+TEST(LoadBalancer, testBisectMorePartsThanColumns)
+{
+    std::vector<ColumnBlock> blocks = LoadBalancer::bisect(std::vector<double>(3, 1.0), 3, 1, 5);
+
+    ASSERT_EQ(blocks.size(), 5);
+    size_t empty = 0;
+    for (const ColumnBlock& block : blocks)
+        empty += block.size() == 0;
+    EXPECT_EQ(empty, 2);
+    expectCovered(blocks, 3, 1);
+}
+
+// test if the balanced force calculation matches the static one and rebalances periodically
+TEST(LoadBalancer, testBalancedMatchesStatic)
+{
+    StrategyComparison comparison(ParallelType::BALANCED, denseCorner());
+    comparison.sim->setBalanceInterval(10);
+    comparison.run();
+
+    const LoadBalancer& balancer = *comparison.sim->getGrid().balancer;
+    EXPECT_GT(balancer.getRebalanceCount(), 10);
+    EXPECT_GE(balancer.getImbalance(), 1);
+    expectCovered(balancer.getBlocks(), 10, 10);
+    comparison.expectMatchesStatic();
+}
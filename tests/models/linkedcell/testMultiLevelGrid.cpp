@@ -0,0 +1,125 @@
+
+#include "analytics/PairStatistics.h"
+#include "fixtures/MixedLJFixtures.h"
+#include "models/linked_cell/MultiLevelGrid.h"
+#include "physics/forceCal/forceCal.h"
+#include "physics/stratFactory.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+/**
+ * @brief Create a mixture of many small particles of type 1 and few large ones of type 2
+ */
+ParticleContainer createMixture()
+{
+    return createRandomParticles(1020, 0.5, 29.5, 0.8, 42, [](const auto& x, size_t index) {
+        const bool large = index >= 1000;
+        return Particle(x, { 0, 0, 0 }, large ? 10 : 1, large ? 2 : 1);
+    });
+}
+
+/**
+ * @brief Create a mixed LJ simulation of the mixture with the cutoff of the large particles
+ */
+std::unique_ptr<MixedLJSimulation> createSimulation(
+    ParticleContainer& container, PhysicsStrategy& strat)
+{
+    return createMixedLJSimulation(container,
+        strat,
+        0.001,
+        { { 1, { 1, 1 } }, { 2, { 1, 3 } } },
+        30,
+        7.5,
+        BoundaryType::OUTFLOW);
+}
+
+} // namespace
+
+// test if the types are grouped into levels with cells matched to their cutoff
+TEST(MultiLevelGrid, testLevels)
+{
+    CellGrid grid { { 0, 0, 0 }, { 30, 30, 30 }, 7.5 };
+    MultiLevelGrid levels(grid, { { { 1, 1 }, 2.5 }, { { 1, 2 }, 5 }, { { 2, 2 }, 7.5 } });
+
+    ASSERT_EQ(levels.getLevels().size(), 2);
+    const CellLevel& small = levels.getLevels()[0];
+    EXPECT_EQ(small.types, std::vector<int> { 1 });
+    // the levels span the domain and the halo of the grid
+    for (size_t d = 0; d < 3; ++d) {
+        EXPECT_EQ(small.dimensions[d], 18);
+        EXPECT_NEAR(small.cellSize[d], 2.5, 1e-12);
+        EXPECT_EQ(levels.getLevels()[1].dimensions[d], 6);
+    }
+    EXPECT_DOUBLE_EQ(levels.cutoffSquared(2, 1), 25);
+    EXPECT_DOUBLE_EQ(levels.cutoffSquared(1, 2), 25);
+}
+
+// test if the forces of the levels match direct summation with the cutoff of every pair and if
+// the pair checks drop compared to the cells of the largest cutoff
+TEST(MultiLevelGrid, testForcesMatchDirectSummation)
+{
+    spdlog::set_level(spdlog::level::off);
+    ParticleContainer container = createMixture();
+    PhysicsStrategy strat = stratFactory(SimulationType::MIXED_LJ, ParallelType::STATIC);
+    auto sim = createSimulation(container, strat);
+
+    sim->setTypeCutoffs({ { 2, 7.5 } });
+    EXPECT_EQ(sim->getLevels(), nullptr);
+    sim->setTypeCutoffs({ { 1, 2.5 }, { 2, 7.5 } });
+    ASSERT_NE(sim->getLevels(), nullptr);
+    EXPECT_DOUBLE_EQ(sim->getCutoff(1, 2), 5);
+
+    force_mixed_LJ_gravity_levels(*sim);
+
+    std::vector<std::array<double, 3>> expected(container.particles.size(), { 0, 0, 0 });
+    unsigned long long inCutoff = 0;
+    for (size_t i = 0; i < container.particles.size(); ++i) {
+        for (size_t j = i + 1; j < container.particles.size(); ++j) {
+            const Particle& p1 = container.particles[i];
+            const Particle& p2 = container.particles[j];
+            const int type1 = p1.getType();
+            const int type2 = p2.getType();
+            std::array<double, 3> delta = p1.getX() - p2.getX();
+            double distSquared = ArrayUtils::DotProduct(delta);
+            double cutoff = sim->getCutoff(type1, type2);
+            if (distSquared > cutoff * cutoff)
+                continue;
+            ++inCutoff;
+            double dist6 = std::pow(distSquared, 3);
+            double beta = sim->getBeta(type1, type2);
+            double gamma = sim->getGamma(type1, type2);
+            std::array<double, 3> force = (sim->getAlpha(type1, type2) / distSquared)
+                * (beta / dist6 + gamma / (dist6 * dist6)) * delta;
+            expected[i] = expected[i] + force;
+            expected[j] = expected[j] - force;
+        }
+    }
+    for (size_t i = 0; i < container.particles.size(); ++i) {
+        for (size_t d = 0; d < 3; ++d) {
+            EXPECT_NEAR(container.particles[i].getF()[d],
+                expected[i][d],
+                1e-9 * std::max(1.0, std::abs(expected[i][d])));
+        }
+    }
+
+    PairStatistics levelPairs = countLevelPairs(*sim->getLevels());
+    PairStatistics cellPairs = countPairs(sim->getGrid());
+    EXPECT_EQ(levelPairs.inCutoff, inCutoff);
+    EXPECT_LT(levelPairs.checks * 4, cellPairs.checks);
+}
+
+// test if a run with type cutoffs calculates its forces on the levels
+TEST(MultiLevelGrid, testRunUsesLevels)
+{
+    spdlog::set_level(spdlog::level::off);
+    ParticleContainer container = createMixture();
+    PhysicsStrategy strat = stratFactory(SimulationType::MIXED_LJ, ParallelType::GRAPH);
+    auto sim = createSimulation(container, strat);
+    sim->setTypeCutoffs({ { 1, 2.5 } });
+
+    sim->runSim();
+
+    EXPECT_EQ(sim->phaseTimer.getStats(Phase::TASK_GRAPH).calls, 0);
+    EXPECT_EQ(sim->phaseTimer.getStats(Phase::FORCE).calls, sim->iteration);
+}
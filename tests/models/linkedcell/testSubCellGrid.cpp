@@ -0,0 +1,144 @@
+
+#include "analytics/PairStatistics.h"
+#include "fixtures/MixedLJFixtures.h"
+#include "models/linked_cell/SubCellGrid.h"
+#include "physics/forceCal/forceCal.h"
+#include "physics/stratFactory.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+/**
+ * @brief Create a random fluid of two particle types
+ */
+ParticleContainer createFluid()
+{
+    return createRandomParticles(1500, 0.2, 14.8, 0.9, 7, [](const auto& x, size_t index) {
+        return Particle(x, { 0, 0, 0 }, 1, index % 2 ? 1 : 2);
+    });
+}
+
+/**
+ * @brief Create a mixed LJ simulation of the fluid
+ */
+std::unique_ptr<MixedLJSimulation> createSimulation(
+    ParticleContainer& container, PhysicsStrategy& strat, BoundaryType boundary)
+{
+    return createMixedLJSimulation(container,
+        strat,
+        0.005,
+        { { 1, { 1, 1 } }, { 2, { 1, 1.2 } } },
+        15,
+        3,
+        boundary);
+}
+
+} // namespace
+
+// test if the stencils hold the half of the cells within the cutoff at their closest points
+TEST(SubCellGrid, testHalfShell)
+{
+    EXPECT_EQ(SubCellGrid::halfShell({ 1, 1, 1 }, 1, 3).size(), 13);
+    EXPECT_EQ(SubCellGrid::halfShell({ 1, 1, 0 }, 1, 2).size(), 4);
+    // no cells are further apart than the cutoff for half the cutoff
+    EXPECT_EQ(SubCellGrid::halfShell({ 0.5, 0.5, 0.5 }, 1, 3).size(), (5 * 5 * 5 - 1) / 2);
+    // the corners of the cells of a third of the cutoff are pruned
+    const auto thirds = SubCellGrid::halfShell({ 1, 1, 1 }, 3, 3);
+    EXPECT_EQ(thirds.size(), (7 * 7 * 7 - 8 - 1) / 2);
+    EXPECT_EQ(SubCellGrid::halfShell({ 1, 1, 0 }, 4, 2).size(), (9 * 9 - 4 - 1) / 2);
+
+    for (const auto& offset : thirds) {
+        // every pair of cells is visited once
+        EXPECT_TRUE(offset[0] > 0 || (offset[0] == 0 && offset[1] > 0)
+            || (offset[0] == 0 && offset[1] == 0 && offset[2] > 0));
+        double distanceSquared = 0;
+        for (int coordinate : offset)
+            distanceSquared += std::pow(std::max(0, std::abs(coordinate) - 1), 2);
+        EXPECT_LE(distanceSquared, 9);
+    }
+}
+
+// test if the cells of the grid are split into sub cells of the factor
+TEST(SubCellGrid, testDimensions)
+{
+    spdlog::set_level(spdlog::level::off);
+    CellGrid grid { { 0, 0, 0 }, { 30, 30, 30 }, 3 };
+    SubCellGrid halves(grid, 0.5);
+    SubCellGrid thirds(grid, 0.4);
+    for (size_t d = 0; d < 3; ++d) {
+        EXPECT_EQ(halves.getDimensions()[d], 24);
+        EXPECT_NEAR(halves.getCellSize()[d], 1.5, 1e-12);
+        // the cells are not smaller than the factor
+        EXPECT_EQ(thirds.getDimensions()[d], 24);
+    }
+
+    CellGrid flat { { 0, 0, 0 }, { 30, 30, 0 }, 3 };
+    SubCellGrid flatThirds(flat, 1.0 / 3);
+    EXPECT_EQ(flatThirds.getDimensions()[0], 36);
+    EXPECT_EQ(flatThirds.getDimensions()[2], 1);
+    EXPECT_EQ(flatThirds.getStencil().size(), 24);
+}
+
+// test if the forces on the sub cells match the forces on the cells and if the pair checks drop
+TEST(SubCellGrid, testForcesMatchLinkedCells)
+{
+    spdlog::set_level(spdlog::level::off);
+    ParticleContainer container = createFluid();
+    PhysicsStrategy strat = stratFactory(SimulationType::MIXED_LJ, ParallelType::STATIC);
+    auto sim = createSimulation(container, strat, BoundaryType::OUTFLOW);
+
+    EXPECT_EQ(sim->getForceOverride(), nullptr);
+    force_mixed_LJ_gravity_lc(*sim);
+    std::vector<std::array<double, 3>> expected;
+    for (const Particle& p : container.particles)
+        expected.push_back(p.getF());
+    const PairStatistics cellPairs = countPairs(sim->getGrid());
+
+    for (double factor : { 0.5, 1.0 / 3 }) {
+        sim->setCellSizeFactor(factor);
+        ASSERT_NE(sim->getSubCells(), nullptr);
+        // the sub cells replace the cell traversal of the strategy
+        EXPECT_NE(sim->getForceOverride(), nullptr);
+        force_mixed_LJ_gravity_subcells(*sim);
+        for (size_t i = 0; i < container.particles.size(); ++i) {
+            for (size_t d = 0; d < 3; ++d) {
+                EXPECT_NEAR(container.particles[i].getF()[d],
+                    expected[i][d],
+                    1e-9 * std::max(1.0, std::abs(expected[i][d])));
+            }
+        }
+
+        const PairStatistics subCellPairs =
+            countSubCellPairs(*sim->getSubCells(), sim->getGrid().cutoffRadiusSquared);
+        EXPECT_EQ(subCellPairs.inCutoff, cellPairs.inCutoff);
+        EXPECT_LT(subCellPairs.checks * 3, cellPairs.checks * 2);
+    }
+
+    sim->setCellSizeFactor(1);
+    EXPECT_EQ(sim->getSubCells(), nullptr);
+}
+
+// test if a periodic run on sub cells matches the run on the cells of the grid
+TEST(SubCellGrid, testPeriodicRunMatchesCells)
+{
+    spdlog::set_level(spdlog::level::off);
+    ParticleContainer cellContainer = createFluid();
+    ParticleContainer subCellContainer = createFluid();
+    PhysicsStrategy strat = stratFactory(SimulationType::MIXED_LJ, ParallelType::GRAPH);
+    auto cellSim = createSimulation(cellContainer, strat, BoundaryType::PERIODIC);
+    auto subCellSim = createSimulation(subCellContainer, strat, BoundaryType::PERIODIC);
+    subCellSim->setCellSizeFactor(0.5);
+
+    cellSim->runSim();
+    subCellSim->runSim();
+
+    EXPECT_EQ(subCellSim->phaseTimer.getStats(Phase::TASK_GRAPH).calls, 0);
+    EXPECT_EQ(subCellSim->phaseTimer.getStats(Phase::FORCE).calls, subCellSim->iteration);
+    for (size_t i = 0; i < cellContainer.particles.size(); ++i) {
+        for (size_t d = 0; d < 3; ++d) {
+            EXPECT_NEAR(subCellContainer.particles[i].getX()[d],
+                cellContainer.particles[i].getX()[d],
+                1e-9);
+        }
+    }
+}
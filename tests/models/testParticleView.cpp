@@ -0,0 +1,39 @@
+
+#include "models/ParticleContainer.h"
+#include "models/ParticleView.h"
+#include <gtest/gtest.h>
+
+// test if the view skips inactive particles and references the stored particles
+TEST(particleViewTest, testActiveParticles)
+{
+    ParticleContainer container { {} };
+    for (size_t i = 0; i < 5; ++i)
+        container.addParticle(Particle { { double(i), 0, 0 }, { 0, 1, 0 }, 2, int(i) });
+    container.removeParticle(container.particles[0]);
+    container.removeParticle(container.particles[3]);
+
+    ParticleView view = container.view();
+    EXPECT_EQ(view.size(), 3);
+    EXPECT_FALSE(view.empty());
+
+    std::vector<int> types;
+    for (auto p : view) {
+        types.push_back(p.type());
+        EXPECT_EQ(p.x()[0], double(p.type()));
+        EXPECT_EQ(p.m(), 2);
+        EXPECT_TRUE(p.active());
+        // no copies are made
+        EXPECT_EQ(&p.particle(), &container.particles[p.type()]);
+    }
+    EXPECT_EQ(types, (std::vector<int> { 1, 2, 4 }));
+    EXPECT_EQ(&container.getContainer(), &container.particles);
+}
+
+// test if an empty container gives an empty view
+TEST(particleViewTest, testEmpty)
+{
+    ParticleContainer container { {} };
+    ParticleView view = container.view();
+    EXPECT_TRUE(view.empty());
+    EXPECT_FALSE(view.begin() != view.end());
+}
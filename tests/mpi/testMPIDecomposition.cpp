@@ -0,0 +1,204 @@
+
+#include "analytics/Analyzer.h"
+#include "io/fileReader/emptyReader.h"
+#include "io/fileWriter/emptyWriter.h"
+#include "models/generators/CuboidParticleCluster.h"
+#include "models/generators/ParticleGenerator.h"
+#include "models/linked_cell/DomainDecomposition.h"
+#include "physics/stratFactory.h"
+#include "physics/thermostat/ThermostatFactory.h"
+#include "simulation/MixedLJSimulation.h"
+#include "utils/MPIUtils.h"
+#include <gtest/gtest.h>
+#include <map>
+
+/**
+ * @brief The position of a particle gathered from all ranks
+ */
+struct GatheredParticle {
+    size_t id; /**< The id of the particle */
+    std::array<double, 3> x; /**< The position of the particle */
+};
+
+class MPIDecompositionTest : public ::testing::Test {
+protected:
+    void SetUp() override { spdlog::set_level(spdlog::level::off); }
+
+    /**
+     * @brief Generate a block of particles filling the domain
+     * @details Every rank generates the same particles, so every rank can run the reference. The
+     * particles start on the periodic sides and on the sides between the ranks.
+     */
+    void generate()
+    {
+        ParticleGenerator generator(reference);
+        generator.registerCluster(std::make_unique<CuboidParticleCluster>(
+            std::array<double, 3> { 0, 0, 0 },
+            10,
+            10,
+            dimensions == 3 ? 10 : 1,
+            1.2,
+            1,
+            std::array<double, 3> { 0, 0, 0 },
+            0.5,
+            dimensions,
+            std::map<unsigned, bool> {},
+            1));
+        generator.generateClusters();
+    }
+
+    /**
+     * @brief Create a mixed simulation of the periodic 12x12(x12) domain
+     * @param container The particles
+     * @param decomposition The decomposition, nullptr for the whole domain
+     * @return The simulation
+     */
+    std::unique_ptr<MixedLJSimulation> makeSim(
+        ParticleContainer& container, std::unique_ptr<DomainDecomposition> decomposition)
+    {
+        std::array<double, 3> origin { 0, 0, 0 };
+        std::array<double, 3> size { 12, 12, dimensions == 3 ? 12.0 : 0.0 };
+        BoundaryConfig boundaryConfig = config;
+        if (decomposition) {
+            origin = decomposition->getLocalOrigin();
+            size = decomposition->getLocalSize();
+            boundaryConfig = decomposition->getLocalBoundaryConfig();
+        }
+        return std::make_unique<MixedLJSimulation>(0,
+            0.0005,
+            endTime,
+            container,
+            strat,
+            std::make_unique<EmptyFileWriter>(),
+            std::make_unique<EmptyFileReader>(""),
+            std::map<unsigned, bool> {},
+            std::map<unsigned, std::pair<double, double>> { { 1, { 1, 1 } } },
+            origin,
+            size,
+            3,
+            boundaryConfig,
+            nullptr,
+            0,
+            thermostatFactory(ThermostatType::CLASSICAL, 0, 0, 10, dimensions),
+            1000,
+            1,
+            1000,
+            true,
+            0,
+            false,
+            std::move(decomposition));
+    }
+
+    /**
+     * @brief Gather the positions of the particles of all ranks
+     * @param container The particles of this rank
+     * @return The positions of all particles by id
+     */
+    static std::map<size_t, std::array<double, 3>> gather(ParticleContainer& container)
+    {
+        std::vector<GatheredParticle> local;
+        for (auto& particle : container)
+            local.push_back({ particle.getID(), particle.getX() });
+
+        const int bytes = static_cast<int>(local.size() * sizeof(GatheredParticle));
+        std::vector<int> counts(MPIUtils::getSize());
+        MPI_Allgather(&bytes, 1, MPI_INT, counts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+        std::vector<int> displacements(counts.size(), 0);
+        for (size_t rank = 1; rank < counts.size(); ++rank)
+            displacements[rank] = displacements[rank - 1] + counts[rank - 1];
+
+        std::vector<GatheredParticle> all(
+            (displacements.back() + counts.back()) / sizeof(GatheredParticle));
+        MPI_Allgatherv(local.data(),
+            bytes,
+            MPI_BYTE,
+            all.data(),
+            counts.data(),
+            displacements.data(),
+            MPI_BYTE,
+            MPI_COMM_WORLD);
+
+        std::map<size_t, std::array<double, 3>> positions;
+        for (const auto& particle : all)
+            positions[particle.id] = particle.x;
+        return positions;
+    }
+
+    /**
+     * @brief Run the reference and the decomposed simulation and compare the particles
+     * @param rankGrid The ranks per dimension, 0 to choose them
+     */
+    void compare(std::array<int, 3> rankGrid = { 0, 0, 0 })
+    {
+        generate();
+        ParticleContainer decomposed(reference.particles);
+        auto serial = makeSim(reference, nullptr);
+        auto distributed = makeSim(decomposed,
+            std::make_unique<DomainDecomposition>(MPIUtils::getRank(),
+                MPIUtils::getSize(),
+                std::array<double, 3> { 0, 0, 0 },
+                std::array<double, 3> { 12, 12, dimensions == 3 ? 12.0 : 0.0 },
+                3,
+                config,
+                rankGrid));
+        serial->runSim();
+        distributed->runSim();
+
+        std::map<size_t, std::array<double, 3>> positions = gather(decomposed);
+        ASSERT_EQ(positions.size(), static_cast<size_t>(reference.activeParticleCount));
+        for (auto& particle : reference) {
+            for (size_t d = 0; d < 3; ++d)
+                EXPECT_NEAR(positions.at(particle.getID())[d], particle.getX()[d], 1e-9);
+        }
+    }
+
+    size_t dimensions = 2;
+    double endTime = 0.1;
+    BoundaryConfig config { BoundaryType::PERIODIC,
+                            BoundaryType::PERIODIC,
+                            BoundaryType::PERIODIC,
+                            BoundaryType::PERIODIC };
+    ParticleContainer reference {};
+    PhysicsStrategy strat = stratFactory(SimulationType::MIXED_LJ, ParallelType::STATIC);
+};
+
+// test if the ranks of the automatically chosen grid reproduce the single process run
+TEST_F(MPIDecompositionTest, testMatchesSingleProcess)
+{
+    compare();
+}
+
+// test if a split along a single dimension reproduces the single process run
+TEST_F(MPIDecompositionTest, testMatchesSingleProcessSlabs)
+{
+    compare({ MPIUtils::getSize(), 1, 1 });
+}
+
+// test if the edge and corner halos of a 3D domain are forwarded between the ranks
+TEST_F(MPIDecompositionTest, testMatchesSingleProcess3D)
+{
+    dimensions = 3;
+    endTime = 0.03;
+    config = BoundaryConfig(BoundaryType::PERIODIC,
+        BoundaryType::PERIODIC,
+        BoundaryType::PERIODIC,
+        BoundaryType::PERIODIC,
+        BoundaryType::PERIODIC,
+        BoundaryType::PERIODIC);
+    compare();
+}
+
+int main(int argc, char** argv)
+{
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+    ::testing::InitGoogleTest(&argc, argv);
+    // only the first rank reports, but all ranks take part in every test
+    if (MPIUtils::getRank() > 0) {
+        auto& listeners = ::testing::UnitTest::GetInstance()->listeners();
+        delete listeners.Release(listeners.default_result_printer());
+    }
+    const int result = RUN_ALL_TESTS();
+    MPI_Finalize();
+    return result;
+}
@@ -1,5 +1,6 @@
 
 #include "io/fileReader/emptyReader.h"
+#include "io/fileWriter/emptyWriter.h"
 #include "io/fileWriter/VTKWriter.h"
 #include "models/Particle.h"
 #include "models/molecules/Membrane.h"
@@ -332,3 +333,193 @@ TEST_F(calcForceMembrane, calcForceMembraneLJNonNeighbors)
         EXPECT_TRUE(
             ArrayUtils::L2Norm(sim.container.particles[i].getF() - expectedForces[i]) > PRESICION);
 }
+
+// Test if the bonded forces of the inner steps match the harmonic forces on the particles
+TEST_F(calcForceMembrane, calcBondedForcesBuffer)
+{
+    double r0 = 2;
+    double r = 1;
+    double k = 20;
+
+    particles = std::vector<Particle> {};
+    Membrane mem { z, 3, 3, 1, r, 1, z, 0, 3, 1, r0, k };
+    std::vector<std::unique_ptr<Molecule>> memVec {};
+    memVec.push_back(std::make_unique<Membrane>(mem));
+
+    MembraneSimulation sim(
+        start_time,
+        delta_t,
+        end_time,
+        particles,
+        strat,
+        std::move(writer),
+        std::move(fileReader),
+        {},
+        { { 1, { 1, 0.1 } } },
+        domainOrigin,
+        domainSize,
+        cutoff,
+        BoundaryConfig(
+            BoundaryType::OUTFLOW,
+            BoundaryType::OUTFLOW,
+            BoundaryType::OUTFLOW,
+            BoundaryType::OUTFLOW,
+            BoundaryType::OUTFLOW,
+            BoundaryType::OUTFLOW),
+        std::make_unique<Analyzer>(std::array<size_t, 3> { 1, 0, 4 }, ""),
+        0,
+        thermostatFactory(ThermostatType::CLASSICAL, 0, 0, 0, 0),
+        std::move(memVec));
+
+    sim.getMolecules()[0]->calculateIntraMolecularForces(sim);
+    std::vector<std::array<double, 3>> forces(sim.container.particles.size(), { 0, 0, 0 });
+    sim.getMolecules()[0]->calculateBondedForces(sim.container, forces);
+
+    for (size_t i = 0; i < sim.container.particles.size(); i++)
+        for (int j = 0; j < 3; j++)
+            EXPECT_NEAR(forces[i][j], sim.container.particles[i].getF()[j], PRESICION);
+}
+
+// Test if multiple time stepping only depends on the inner time step if there are no slow forces,
+// and if it stays close to the plain integration with the inner time step
+TEST_F(calcForceMembrane, respaMatchesSmallTimeStep)
+{
+    PhysicsStrategy membraneStrat { location_stroemer_verlet,
+                                    velocity_stroemer_verlet,
+                                    force_membrane };
+    // the bonds are stretched and oscillate stiffly, the small sigma leaves no slow forces
+    auto makeSim = [&](ParticleContainer& container, double dt, unsigned respaSteps) {
+        std::vector<std::unique_ptr<Molecule>> memVec {};
+        memVec.push_back(std::make_unique<Membrane>(
+            std::array<double, 3> { -1, -1, 0 }, 3, 3, 1, 1, 1, z, 0, 3, 1, 1.2, 300));
+        return std::make_unique<MembraneSimulation>(
+            start_time,
+            dt,
+            0.5,
+            container,
+            membraneStrat,
+            std::make_unique<EmptyFileWriter>(),
+            std::make_unique<EmptyFileReader>(""),
+            std::map<unsigned, bool> {},
+            std::map<unsigned, std::pair<double, double>> { { 1, { 1, 0.1 } } },
+            domainOrigin,
+            domainSize,
+            cutoff,
+            BoundaryConfig(
+                BoundaryType::OUTFLOW,
+                BoundaryType::OUTFLOW,
+                BoundaryType::OUTFLOW,
+                BoundaryType::OUTFLOW,
+                BoundaryType::OUTFLOW,
+                BoundaryType::OUTFLOW),
+            std::make_unique<Analyzer>(std::array<size_t, 3> { 1, 0, 4 }, ""),
+            0,
+            thermostatFactory(ThermostatType::CLASSICAL, 0, 0, 0, 0),
+            std::move(memVec),
+            0,
+            10,
+            0,
+            false,
+            0,
+            false,
+            respaSteps);
+    };
+    ParticleContainer plainParticles { {} };
+    ParticleContainer halfParticles { {} };
+    ParticleContainer respaParticles { {} };
+    auto plain = makeSim(plainParticles, 0.0025, 1);
+    auto half = makeSim(halfParticles, 0.005, 2);
+    auto respa = makeSim(respaParticles, 0.01, 4);
+    const std::vector<Particle> start = respa->container.particles;
+
+    plain->runSim();
+    half->runSim();
+    respa->runSim();
+
+    // the slow forces of the first positions are calculated before the first step
+    EXPECT_EQ((respa->phaseTimer.getStats(Phase::FORCE).calls - 1) * 4,
+        plain->phaseTimer.getStats(Phase::FORCE).calls);
+    EXPECT_EQ((respa->phaseTimer.getStats(Phase::FORCE).calls - 1) * 2,
+        half->phaseTimer.getStats(Phase::FORCE).calls - 1);
+    EXPECT_EQ(respa->phaseTimer.getStats(Phase::INNER_STEPS).calls + 1,
+        respa->phaseTimer.getStats(Phase::FORCE).calls);
+    EXPECT_EQ(plain->phaseTimer.getStats(Phase::INNER_STEPS).calls, 0);
+
+    double moved = 0;
+    ASSERT_EQ(respa->container.particles.size(), plain->container.particles.size());
+    for (size_t i = 0; i < respa->container.particles.size(); i++) {
+        const Particle& p = respa->container.particles[i];
+        moved = std::max(moved, ArrayUtils::L2Norm(p.getX() - start[i].getX()));
+        for (int j = 0; j < 3; j++) {
+            EXPECT_NEAR(p.getX()[j], half->container.particles[i].getX()[j], 1e-9);
+            EXPECT_NEAR(p.getX()[j], plain->container.particles[i].getX()[j], 1e-2);
+        }
+    }
+    EXPECT_GT(moved, 0.1);
+}
+
+// Test if the velocities of multiple time stepping match the positions with slow forces, i.e. if
+// every step closes with the half kick of the slow forces of its new positions
+TEST_F(calcForceMembrane, respaVelocitiesMatchSmallTimeStep)
+{
+    PhysicsStrategy membraneStrat { location_stroemer_verlet,
+                                    velocity_stroemer_verlet,
+                                    force_membrane };
+    const double gravity = -2;
+    // the uniform gravity moves the center of mass only, so it leaves the bonds to the inner steps
+    auto makeSim = [&](ParticleContainer& container, double dt, unsigned respaSteps) {
+        std::vector<std::unique_ptr<Molecule>> memVec {};
+        memVec.push_back(std::make_unique<Membrane>(
+            std::array<double, 3> { -1, -1, 0 }, 3, 3, 1, 1, 1, z, 0, 3, 1, 1.2, 300));
+        return std::make_unique<MembraneSimulation>(
+            start_time,
+            dt,
+            0.5,
+            container,
+            membraneStrat,
+            std::make_unique<EmptyFileWriter>(),
+            std::make_unique<EmptyFileReader>(""),
+            std::map<unsigned, bool> {},
+            std::map<unsigned, std::pair<double, double>> { { 1, { 1, 0.1 } } },
+            domainOrigin,
+            domainSize,
+            cutoff,
+            BoundaryConfig(
+                BoundaryType::OUTFLOW,
+                BoundaryType::OUTFLOW,
+                BoundaryType::OUTFLOW,
+                BoundaryType::OUTFLOW,
+                BoundaryType::OUTFLOW,
+                BoundaryType::OUTFLOW),
+            std::make_unique<Analyzer>(std::array<size_t, 3> { 1, 0, 4 }, ""),
+            gravity,
+            thermostatFactory(ThermostatType::CLASSICAL, 0, 0, 0, 0),
+            std::move(memVec),
+            0,
+            10,
+            0,
+            false,
+            0,
+            false,
+            respaSteps);
+    };
+    ParticleContainer halfParticles { {} };
+    ParticleContainer respaParticles { {} };
+    auto half = makeSim(halfParticles, 0.005, 2);
+    auto respa = makeSim(respaParticles, 0.01, 4);
+
+    half->runSim();
+    respa->runSim();
+
+    std::array<double, 3> momentum { 0, 0, 0 };
+    ASSERT_EQ(respa->container.particles.size(), half->container.particles.size());
+    for (size_t i = 0; i < respa->container.particles.size(); i++) {
+        const Particle& p = respa->container.particles[i];
+        momentum = momentum + p.getM() * p.getV();
+        for (int j = 0; j < 3; j++)
+            EXPECT_NEAR(p.getV()[j], half->container.particles[i].getV()[j], 1e-9);
+    }
+    // the bonds cancel, so the center of mass falls freely
+    const double mass = static_cast<double>(respa->container.particles.size());
+    EXPECT_NEAR(momentum[1] / mass, gravity * respa->iteration * 0.01, 1e-9);
+}
@@ -0,0 +1,69 @@
+
+#include "fixtures/StrategyComparison.h"
+#include <gtest/gtest.h>
+
+class StepTaskGraphTest : public ::testing::Test {
+protected:
+    /**
+     * @brief Run the static phases and the task graph on the same particles and compare them
+     * @param config The boundaries of the domain
+     * @param dimensions The dimensions of the domain
+     * @param updateFrequency The iterations between two cell updates
+     */
+    void compare(const BoundaryConfig& config, size_t dimensions, unsigned updateFrequency)
+    {
+        const bool is3D = dimensions == 3;
+        // a moving block reaching the sides of the domain
+        StrategyComparison comparison(ParallelType::GRAPH,
+            { { 0.5, 0.5, is3D ? 0.5 : 0.0 },
+                { 10, 10, is3D ? 10u : 1u },
+                1.2,
+                { 4, 2, is3D ? 1.0 : 0.0 },
+                { 12, 12, is3D ? 12.0 : 0.0 },
+                is3D ? 0.03 : 0.1,
+                config,
+                updateFrequency });
+        comparison.run();
+
+        const MixedLJSimulation& steps = *comparison.sim;
+        EXPECT_EQ(steps.phaseTimer.getStats(Phase::TASK_GRAPH).calls, steps.iteration);
+        EXPECT_EQ(steps.phaseTimer.getStats(Phase::FORCE).calls, 0);
+        comparison.expectMatchesStatic();
+    }
+};
+
+// test if the task graph matches the phases with periodic boundaries
+TEST_F(StepTaskGraphTest, testMatchesPhasesPeriodic)
+{
+    compare(BoundaryConfig(BoundaryType::PERIODIC,
+                BoundaryType::PERIODIC,
+                BoundaryType::PERIODIC,
+                BoundaryType::PERIODIC),
+        2,
+        1);
+}
+
+// test if the task graph matches the phases when particles leave through an outflow boundary and
+// stay in their old cells between the cell updates
+TEST_F(StepTaskGraphTest, testMatchesPhasesOutflow)
+{
+    compare(BoundaryConfig(BoundaryType::OUTFLOW,
+                BoundaryType::OUTFLOW,
+                BoundaryType::SOFT_REFLECTIVE,
+                BoundaryType::OUTFLOW),
+        2,
+        10);
+}
+
+// test if the task graph matches the phases in a 3D domain
+TEST_F(StepTaskGraphTest, testMatchesPhases3D)
+{
+    compare(BoundaryConfig(BoundaryType::PERIODIC,
+                BoundaryType::PERIODIC,
+                BoundaryType::SOFT_REFLECTIVE,
+                BoundaryType::SOFT_REFLECTIVE,
+                BoundaryType::OUTFLOW,
+                BoundaryType::OUTFLOW),
+        3,
+        1);
+}
@@ -0,0 +1,101 @@
+
+#include "simulation/EnsembleRunner.h"
+#include "utils/MaxwellBoltzmannDistribution.h"
+#include <gtest/gtest.h>
+
+// test if the braces of a word expand to every combination of their values
+TEST(EnsembleRunner, testExpand)
+{
+    EXPECT_EQ(EnsembleRunner::expand("-x"), std::vector<std::string> { "-x" });
+    EXPECT_EQ(EnsembleRunner::expand("sigma={1,1.2}"),
+        (std::vector<std::string> { "sigma=1", "sigma=1.2" }));
+    EXPECT_EQ(EnsembleRunner::expand("out_{a,b}_{1,2}"),
+        (std::vector<std::string> { "out_a_1", "out_a_2", "out_b_1", "out_b_2" }));
+}
+
+// test if the threads are split into one group per run, but not more groups than threads
+TEST(EnsembleRunner, testPartition)
+{
+    EXPECT_EQ(EnsembleRunner::partition(4, 16, 0), (std::pair<size_t, size_t> { 4, 4 }));
+    EXPECT_EQ(EnsembleRunner::partition(32, 8, 0), (std::pair<size_t, size_t> { 8, 1 }));
+    EXPECT_EQ(EnsembleRunner::partition(32, 8, 2), (std::pair<size_t, size_t> { 2, 4 }));
+    EXPECT_EQ(EnsembleRunner::partition(2, 8, 5), (std::pair<size_t, size_t> { 2, 4 }));
+}
+
+// test if a sweep runs every combination with its own parameters and output
+TEST(EnsembleRunner, testSweep)
+{
+    spdlog::set_level(spdlog::level::off);
+    EnsembleRunner runner({ "MolSim", "-w", "3" }, 0);
+    runner.addLine("data/eingabe-sonne.txt end_time={0.14,0.28} delta_t={0.014,0.007}");
+    runner.addLine("data/eingabe-sonne.txt -d 0.014 -e 0.07 output=sun");
+
+    const std::vector<EnsembleRun>& runs = runner.getRuns();
+    ASSERT_EQ(runs.size(), 5);
+    EXPECT_EQ(runs[1].params->end_time, 0.14);
+    EXPECT_EQ(runs[1].params->delta_t, 0.007);
+    EXPECT_EQ(runs[1].params->output_file, "sim_1");
+    EXPECT_EQ(runs[4].params->output_file, "sun");
+    EXPECT_EQ(runs[4].params->writer_type, WriterType::EMPTY);
+
+    runner.run();
+    const std::vector<unsigned> iterations { 10, 20, 20, 40, 5 };
+    for (size_t i = 0; i < runs.size(); ++i)
+        EXPECT_EQ(runs[i].iterations, iterations[i]);
+}
+
+// test if the options of a run keep the log of the ensemble
+TEST(EnsembleRunner, testLogLevel)
+{
+    spdlog::set_level(spdlog::level::warn);
+    EnsembleRunner runner({ "MolSim", "-w", "3" }, 0);
+    runner.addLine("data/eingabe-sonne.txt -p");
+    runner.addLine("data/eingabe-sonne.txt -l 0");
+    EXPECT_TRUE(runner.getRuns()[0].params->doPerformanceMeasurements);
+    EXPECT_EQ(spdlog::get_level(), spdlog::level::warn);
+    spdlog::set_level(spdlog::level::off);
+}
+
+// test if every run draws the random velocities from the seed
+TEST(EnsembleRunner, testSeed)
+{
+    resetMaxwellBoltzmannSeed();
+    const std::array<double, 3> seeded = maxwellBoltzmannDistributedVelocity(1, 3);
+    EXPECT_NE(maxwellBoltzmannDistributedVelocity(1, 3), seeded);
+    resetMaxwellBoltzmannSeed();
+    EXPECT_EQ(maxwellBoltzmannDistributedVelocity(1, 3), seeded);
+}
+
+// test if the parameters of a run are checked like those of an XML input
+TEST(EnsembleRunner, testInvalidParameter)
+{
+    Params params;
+    EnsembleRunner::setParameter(params, "respa_steps", "4");
+    EnsembleRunner::setParameter(params, "cell_size_factor", "0.5");
+    EXPECT_EQ(params.respa_steps, 4);
+    EXPECT_EQ(params.cell_size_factor, 0.5);
+    EXPECT_EXIT(EnsembleRunner::setParameter(params, "respa_steps", "0"),
+        testing::ExitedWithCode(EXIT_FAILURE),
+        "");
+    EXPECT_EXIT(EnsembleRunner::setParameter(params, "cell_size_factor", "1.5"),
+        testing::ExitedWithCode(EXIT_FAILURE),
+        "");
+}
+
+// test if every run writes its own metrics and ignores the options which record the process or fork
+TEST(EnsembleRunner, testProcessOptions)
+{
+    spdlog::set_level(spdlog::level::off);
+    EnsembleRunner runner({ "MolSim", "-w", "3", "--metrics=metrics", "--trace=trace" }, 0);
+    runner.addLine("data/eingabe-sonne.txt end_time={0.14,0.28} --counters --memory --snapshots=2");
+
+    const std::vector<EnsembleRun>& runs = runner.getRuns();
+    ASSERT_EQ(runs.size(), 2);
+    for (size_t i = 0; i < runs.size(); ++i) {
+        EXPECT_EQ(runs[i].params->metrics_file, "metrics_" + std::to_string(i));
+        EXPECT_TRUE(runs[i].params->trace_file.empty());
+        EXPECT_FALSE(runs[i].params->perf_counters);
+        EXPECT_TRUE(runs[i].params->memory_report);
+        EXPECT_EQ(runs[i].params->snapshots, 0);
+    }
+}
@@ -0,0 +1,110 @@
+
+#include "utils/NumaUtils.h"
+#include <gtest/gtest.h>
+#include <omp.h>
+#include <thread>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// test if the CPU lists of the sysfs are read and written
+TEST(NumaUtils, testCpuList)
+{
+    EXPECT_EQ(NumaUtils::parseCpuList("0-3,8-9,12"), (std::vector<int> { 0, 1, 2, 3, 8, 9, 12 }));
+    EXPECT_EQ(NumaUtils::parseCpuList(""), std::vector<int> {});
+    EXPECT_EQ(NumaUtils::formatCpuList({ 0, 1, 2, 3, 8, 9, 12 }), "0-3,8-9,12");
+    EXPECT_EQ(NumaUtils::formatCpuList({}), "");
+}
+
+// test if compact fills the nodes one after another and scatter alternates them
+TEST(NumaUtils, testPinningOrder)
+{
+    const std::map<int, std::vector<int>> nodes { { 0, { 0, 1, 2 } }, { 1, { 4, 5 } } };
+
+    EXPECT_EQ(NumaUtils::pinningOrder(nodes, PinningType::COMPACT),
+        (std::vector<int> { 0, 1, 2, 4, 5 }));
+    EXPECT_EQ(NumaUtils::pinningOrder(nodes, PinningType::SCATTER),
+        (std::vector<int> { 0, 4, 1, 5, 2 }));
+}
+
+// test if every CPU of the nodes may be used by the process
+TEST(NumaUtils, testNodes)
+{
+    const std::map<int, std::vector<int>> nodes = NumaUtils::getNodes();
+
+    ASSERT_FALSE(nodes.empty());
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(set), &set), 0);
+    for (const auto& [node, cpus] : nodes) {
+        EXPECT_FALSE(cpus.empty());
+        for (int cpu : cpus)
+            EXPECT_TRUE(CPU_ISSET(cpu, &set));
+    }
+#endif
+}
+
+// test if the threads run on the CPUs of the pinning order
+TEST(NumaUtils, testPinThreads)
+{
+#ifdef __linux__
+    const std::vector<int> order =
+        NumaUtils::pinningOrder(NumaUtils::getNodes(), PinningType::SCATTER);
+    std::vector<cpu_set_t> previous(static_cast<size_t>(omp_get_max_threads()));
+#pragma omp parallel
+    pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &previous[omp_get_thread_num()]);
+
+    NumaUtils::pinThreads(PinningType::SCATTER);
+    std::vector<int> cpus(previous.size(), -1);
+#pragma omp parallel
+    cpus[omp_get_thread_num()] = sched_getcpu();
+    for (size_t thread = 0; thread < cpus.size(); ++thread)
+        EXPECT_EQ(cpus[thread], order[thread % order.size()]);
+
+    // the threads are shared with the other tests
+#pragma omp parallel
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &previous[omp_get_thread_num()]);
+#else
+    GTEST_SKIP() << "Thread pinning is only supported on Linux";
+#endif
+}
+
+// test if the nested team of a pinned thread runs on its block of CPUs, like an ensemble group
+TEST(NumaUtils, testPinThread)
+{
+#ifdef __linux__
+    const std::vector<int> allowed = NumaUtils::getThreadCpus();
+    const std::vector<int> block(
+        allowed.begin(), allowed.begin() + std::min<std::ptrdiff_t>(2, allowed.size()));
+    std::vector<std::vector<int>> teamCpus(2);
+    // a new thread keeps the pinning away from the threads of the other tests
+    std::thread group([&] {
+        ASSERT_TRUE(NumaUtils::pinThread(block));
+#pragma omp parallel num_threads(2)
+        teamCpus[omp_get_thread_num()] = NumaUtils::getThreadCpus();
+    });
+    group.join();
+    for (const std::vector<int>& cpus : teamCpus)
+        EXPECT_EQ(cpus, block);
+#else
+    GTEST_SKIP() << "Thread pinning is only supported on Linux";
+#endif
+}
+
+// test if the first touch keeps the reserved storage for the elements
+TEST(NumaUtils, testReserveFirstTouch)
+{
+    std::vector<double> values;
+    NumaUtils::reserveFirstTouch(values, 100000);
+    ASSERT_GE(values.capacity(), 100000);
+    const double* data = values.data();
+    values.resize(100000, 1.0);
+
+    EXPECT_EQ(values.data(), data);
+    EXPECT_EQ(values.back(), 1.0);
+    // a filled vector is left alone
+    NumaUtils::reserveFirstTouch(values, 200000);
+    EXPECT_EQ(values.data(), data);
+}
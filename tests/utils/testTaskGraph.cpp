@@ -0,0 +1,54 @@
+
+#include "utils/TaskGraph.h"
+#include <gtest/gtest.h>
+#include <mutex>
+
+// test if every task runs once and after all tasks it depends on
+TEST(TaskGraph, testDependencies)
+{
+    TaskGraph graph;
+    std::mutex mutex;
+    std::vector<size_t> order;
+    std::vector<size_t> ids;
+    for (size_t i = 0; i < 50; ++i) {
+        ids.push_back(graph.addTask([&, i] {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(i);
+        }));
+    }
+    // every task waits for its half and, if odd, for its predecessor
+    for (size_t i = 1; i < 50; ++i) {
+        graph.addDependency(ids[i / 2], ids[i]);
+        if (i % 2)
+            graph.addDependency(ids[i - 1], ids[i]);
+    }
+
+    for (int run = 0; run < 2; ++run) {
+        order.clear();
+        graph.run();
+
+        ASSERT_EQ(order.size(), 50);
+        std::vector<size_t> position(50);
+        for (size_t p = 0; p < order.size(); ++p)
+            position[order[p]] = p;
+        for (size_t i = 1; i < 50; ++i) {
+            EXPECT_LT(position[i / 2], position[i]);
+            if (i % 2)
+                EXPECT_LT(position[i - 1], position[i]);
+        }
+    }
+}
+
+// test if the tasks of a cycle are reported
+TEST(TaskGraph, testCycle)
+{
+    TaskGraph graph;
+    const size_t a = graph.addTask([] {});
+    const size_t b = graph.addTask([] {});
+    graph.addDependency(a, b);
+    graph.addDependency(b, a);
+
+    // the threads of an earlier parallel region do not survive a plain fork
+    ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    EXPECT_EXIT(graph.run(), ::testing::ExitedWithCode(EXIT_FAILURE), "");
+}
@@ -0,0 +1,98 @@
+
+#include "fixtures/StrategyComparison.h"
+#include "utils/WorkStealing.h"
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <omp.h>
+#include <thread>
+
+// test if the chunks are consecutive and of about the same weight
+TEST(WorkStealing, testSplit)
+{
+    std::vector<WorkChunk> chunks = WorkStealingScheduler::split(std::vector<size_t>(64, 1), 8);
+
+    ASSERT_EQ(chunks.size(), 8);
+    for (size_t c = 0; c < chunks.size(); ++c) {
+        EXPECT_EQ(chunks[c].begin, 8 * c);
+        EXPECT_EQ(chunks[c].end, 8 * c + 8);
+    }
+
+    // a heavy item fills a chunk on its own
+    std::vector<size_t> weights(16, 1);
+    weights[3] = 100;
+    chunks = WorkStealingScheduler::split(weights, 4);
+    ASSERT_FALSE(chunks.empty());
+    EXPECT_EQ(chunks.front().begin, 0);
+    EXPECT_EQ(chunks.front().end, 4);
+    EXPECT_EQ(chunks.back().end, 16);
+    for (size_t c = 1; c < chunks.size(); ++c)
+        EXPECT_EQ(chunks[c].begin, chunks[c - 1].end);
+
+    EXPECT_TRUE(WorkStealingScheduler::split({}, 4).empty());
+}
+
+// test if every item, e.g. a cell column, runs exactly once, also when the items are very uneven
+TEST(WorkStealing, testRunsEveryItemOnce)
+{
+    std::vector<size_t> weights(200, 1);
+    for (size_t i = 0; i < 20; ++i)
+        weights[i] = 50;
+    std::vector<std::atomic<int>> runs(weights.size());
+
+    WorkStealingScheduler scheduler(4);
+    for (int run = 0; run < 2; ++run) {
+        scheduler.run(weights, [&](size_t item) { runs[item].fetch_add(1); });
+
+        EXPECT_GT(scheduler.getChunkCount(), 0);
+        EXPECT_LE(scheduler.getSteals(), scheduler.getChunkCount());
+    }
+    for (const std::atomic<int>& count : runs)
+        EXPECT_EQ(count.load(), 2);
+}
+
+// test if idle threads steal the chunks of a thread that is held up by its first item
+TEST(WorkStealing, testStealsUnderImbalance)
+{
+    if (omp_get_max_threads() < 2)
+        GTEST_SKIP() << "Stealing needs a second thread";
+    // the estimate is uniform, but the first item of the first thread takes much longer
+    std::vector<size_t> weights(64, 1);
+    std::vector<std::atomic<int>> runs(weights.size());
+
+    WorkStealingScheduler scheduler(2);
+    scheduler.run(weights, [&](size_t item) {
+        if (item == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        runs[item].fetch_add(1);
+    });
+
+    EXPECT_GT(scheduler.getSteals(), 0);
+    for (const std::atomic<int>& count : runs)
+        EXPECT_EQ(count.load(), 1);
+}
+
+// test if a run without items and a run with fewer chunks than threads terminate
+TEST(WorkStealing, testEmptyQueueTerminates)
+{
+    WorkStealingScheduler scheduler;
+    size_t calls = 0;
+    scheduler.run({}, [&](size_t) { ++calls; });
+    EXPECT_EQ(calls, 0);
+    EXPECT_EQ(scheduler.getChunkCount(), 0);
+    EXPECT_EQ(scheduler.getSteals(), 0);
+
+    // most threads start with an empty deque
+    std::atomic<size_t> items { 0 };
+    scheduler.run({ 1 }, [&](size_t) { items.fetch_add(1); });
+    EXPECT_EQ(items.load(), 1);
+    EXPECT_EQ(scheduler.getChunkCount(), 1);
+}
+
+// test if the work stealing force calculation matches the static one
+TEST(WorkStealing, testStealingMatchesStatic)
+{
+    StrategyComparison comparison(ParallelType::STEALING, denseCorner());
+    comparison.run();
+    comparison.expectMatchesStatic();
+}